@@ -32,6 +32,12 @@ namespace EE::Resource
             return false;
         }
 
+        if ( !UpdateSchema() )
+        {
+            Disconnect();
+            return false;
+        }
+
         return true;
     }
 
@@ -49,11 +55,86 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    bool CompiledResourceDatabase::UpdateSchema()
+    {
+        EE_ASSERT( m_pDatabase != nullptr );
+
+        // Multiple compiler processes can connect at the same time, so the version check and the migration need to be atomic
+        // An immediate transaction takes the write lock up front, any other process will wait on the busy timeout
+        int32_t result = sqlite3_exec( m_pDatabase, "BEGIN IMMEDIATE TRANSACTION;", nullptr, nullptr, nullptr );
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        if ( !UpdateSchemaInternal() )
+        {
+            sqlite3_exec( m_pDatabase, "ROLLBACK TRANSACTION;", nullptr, nullptr, nullptr );
+            return false;
+        }
+
+        result = sqlite3_exec( m_pDatabase, "COMMIT TRANSACTION;", nullptr, nullptr, nullptr );
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            sqlite3_exec( m_pDatabase, "ROLLBACK TRANSACTION;", nullptr, nullptr, nullptr );
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompiledResourceDatabase::UpdateSchemaInternal()
+    {
+        // Get the schema version of the existing database
+        //-------------------------------------------------------------------------
+
+        sqlite3_stmt* pStatement = nullptr;
+        int32_t result = sqlite3_prepare_v2( m_pDatabase, "PRAGMA user_version;", -1, &pStatement, nullptr );
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        int32_t schemaVersion = 0;
+        if ( sqlite3_step( pStatement ) == SQLITE_ROW )
+        {
+            schemaVersion = sqlite3_column_int( pStatement, 0 );
+        }
+
+        sqlite3_finalize( pStatement );
+
+        // Recreate outdated databases, this just means that all resources will be checked and recompiled as needed
+        //-------------------------------------------------------------------------
+
+        if ( schemaVersion != s_schemaVersion )
+        {
+            if ( !DropTables() )
+            {
+                return false;
+            }
+
+            sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, "PRAGMA user_version = %d;", s_schemaVersion );
+            result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
+            if ( result != SQLITE_OK )
+            {
+                m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+                return false;
+            }
+        }
+
+        return CreateTables();
+    }
+
     bool CompiledResourceDatabase::CreateTables()
     {
         EE_ASSERT( m_pDatabase != nullptr );
 
-        constexpr char const* const statement = "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceTimestampHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );";
+        constexpr char const* const statement = "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceContentHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );"
+                                                "CREATE TABLE IF NOT EXISTS `FileContentHashes` ( `FilePath` TEXT PRIMARY KEY, `FileSize` INTEGER, `FileTimestamp` INTEGER, `ContentHash` INTEGER );"
+                                                "CREATE TABLE IF NOT EXISTS `CompileCache` ( `FilePath` TEXT PRIMARY KEY, `FileSize` INTEGER, `LastUsedTime` INTEGER );";
         sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement );
         int32_t result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
 
@@ -70,7 +151,7 @@ namespace EE::Resource
     {
         EE_ASSERT( m_pDatabase != nullptr );
 
-        constexpr char const* const statement = "DROP TABLE IF EXISTS `CompiledResources`;";
+        constexpr char const* const statement = "DROP TABLE IF EXISTS `CompiledResources`;DROP TABLE IF EXISTS `FileContentHashes`;DROP TABLE IF EXISTS `CompileCache`;";
         sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement );
         int32_t result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
 
@@ -116,7 +197,7 @@ namespace EE::Resource
 
             outRecord.m_compilerVersion = sqlite3_column_int( pStatement, 2 );
             outRecord.m_fileTimestamp = sqlite3_column_int64( pStatement, 3 );
-            outRecord.m_sourceTimestampHash = sqlite3_column_int64( pStatement, 4 );
+            outRecord.m_sourceContentHash = (uint64_t) sqlite3_column_int64( pStatement, 4 );
         }
 
         result = sqlite3_finalize( pStatement );
@@ -133,8 +214,151 @@ namespace EE::Resource
     {
         EE_ASSERT( IsConnected() );
 
-        constexpr char const* const statement = "BEGIN TRANSACTION;INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceTimestampHash` ) VALUES ( \"%s\", %d, %d, %llu, %llu );END TRANSACTION;";
-        sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement, record.m_resourceID.GetResourcePath().c_str(), (uint32_t)record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, record.m_sourceTimestampHash );
+        // Note: sqlite integers are signed so hashes are stored as their signed bit pattern
+        constexpr char const* const statement = "BEGIN TRANSACTION;INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceContentHash` ) VALUES ( \"%s\", %d, %d, %llu, %lld );END TRANSACTION;";
+        sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement, record.m_resourceID.GetResourcePath().c_str(), (uint32_t)record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, (int64_t) record.m_sourceContentHash );
+        int32_t result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
+
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompiledResourceDatabase::GetFileContentHashRecord( FileSystem::Path const& filePath, FileContentHashRecord& outRecord ) const
+    {
+        EE_ASSERT( IsConnected() );
+        outRecord.Clear();
+
+        // Prepare the statement
+        //-------------------------------------------------------------------------
+
+        constexpr char const* const statement = "SELECT * FROM `FileContentHashes` WHERE `FilePath` = \"%s\";";
+        sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement, filePath.c_str() );
+
+        sqlite3_stmt* pStatement = nullptr;
+        int32_t result = sqlite3_prepare_v2( m_pDatabase, m_statementBuffer, -1, &pStatement, nullptr );
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        // Execute prepared statement
+        //-------------------------------------------------------------------------
+
+        while ( sqlite3_step( pStatement ) == SQLITE_ROW )
+        {
+            outRecord.m_filePath = filePath;
+            outRecord.m_fileSize = sqlite3_column_int64( pStatement, 1 );
+            outRecord.m_fileTimestamp = sqlite3_column_int64( pStatement, 2 );
+            outRecord.m_contentHash = (uint64_t) sqlite3_column_int64( pStatement, 3 );
+        }
+
+        result = sqlite3_finalize( pStatement );
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompiledResourceDatabase::WriteFileContentHashRecord( FileContentHashRecord const& record )
+    {
+        EE_ASSERT( IsConnected() );
+        EE_ASSERT( record.IsValid() );
+
+        constexpr char const* const statement = "INSERT OR REPLACE INTO `FileContentHashes` ( `FilePath`, `FileSize`, `FileTimestamp`, `ContentHash` ) VALUES ( \"%s\", %llu, %llu, %lld );";
+        sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement, record.m_filePath.c_str(), record.m_fileSize, record.m_fileTimestamp, (int64_t) record.m_contentHash );
+        int32_t result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
+
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompiledResourceDatabase::WriteCompileCacheRecord( CompileCacheRecord const& record )
+    {
+        EE_ASSERT( IsConnected() );
+        EE_ASSERT( record.IsValid() );
+
+        constexpr char const* const statement = "INSERT OR REPLACE INTO `CompileCache` ( `FilePath`, `FileSize`, `LastUsedTime` ) VALUES ( \"%s\", %llu, strftime( '%%s', 'now' ) );";
+        sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement, record.m_filePath.c_str(), record.m_fileSize );
+        int32_t result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
+
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompiledResourceDatabase::GetCompileCacheRecordsToEvict( uint64_t maxCacheSize, TVector<CompileCacheRecord>& outRecords ) const
+    {
+        EE_ASSERT( IsConnected() );
+        outRecords.clear();
+
+        // Prepare the statement
+        //-------------------------------------------------------------------------
+
+        constexpr char const* const statement = "SELECT `FilePath`, `FileSize` FROM `CompileCache` ORDER BY `LastUsedTime` DESC;";
+
+        sqlite3_stmt* pStatement = nullptr;
+        int32_t result = sqlite3_prepare_v2( m_pDatabase, statement, -1, &pStatement, nullptr );
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        // Execute prepared statement - keep the most recently used entries that fit, everything else gets evicted
+        //-------------------------------------------------------------------------
+
+        uint64_t totalSize = 0;
+        while ( sqlite3_step( pStatement ) == SQLITE_ROW )
+        {
+            uint64_t const fileSize = (uint64_t) sqlite3_column_int64( pStatement, 1 );
+            totalSize += fileSize;
+
+            if ( totalSize > maxCacheSize )
+            {
+                auto& record = outRecords.emplace_back();
+                record.m_filePath = FileSystem::Path( (char const*) sqlite3_column_text( pStatement, 0 ) );
+                record.m_fileSize = fileSize;
+            }
+        }
+
+        result = sqlite3_finalize( pStatement );
+        if ( result != SQLITE_OK )
+        {
+            m_errorMessage = String( sqlite3_errstr( result ) ) + " (" + sqlite3_errmsg( m_pDatabase ) + ")";
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CompiledResourceDatabase::DeleteCompileCacheRecord( FileSystem::Path const& filePath )
+    {
+        EE_ASSERT( IsConnected() );
+
+        constexpr char const* const statement = "DELETE FROM `CompileCache` WHERE `FilePath` = \"%s\";";
+        sqlite3_snprintf( s_defaultStatementBufferSize, m_statementBuffer, statement, filePath.c_str() );
         int32_t result = sqlite3_exec( m_pDatabase, m_statementBuffer, nullptr, nullptr, nullptr );
 
         if ( result != SQLITE_OK )
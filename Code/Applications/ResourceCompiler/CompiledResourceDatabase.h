@@ -2,6 +2,7 @@
 
 #include "System/Resource/ResourceID.h"
 #include "System/FileSystem/FileSystemPath.h"
+#include "System/Types/Arrays.h"
 
 //-------------------------------------------------------------------------
 
@@ -19,7 +20,28 @@ namespace EE::Resource
         ResourceID            m_resourceID;
         int32_t               m_compilerVersion = -1;         // The compiler version used for the last compilation
         uint64_t              m_fileTimestamp = 0;            // The timestamp of the resource file
-        uint64_t              m_sourceTimestampHash = 0;      // The timestamp hash of any source assets used in the compilation
+        uint64_t              m_sourceContentHash = 0;        // The combined content hash of the resource file and any source assets used in the compilation
+    };
+
+    // Memoized content hash for a file, only valid as long as the file size and timestamp match
+    struct FileContentHashRecord final
+    {
+        inline bool IsValid() const { return m_filePath.IsValid(); }
+        inline void Clear() { *this = FileContentHashRecord(); }
+
+        FileSystem::Path      m_filePath;
+        uint64_t              m_fileSize = 0;
+        uint64_t              m_fileTimestamp = 0;
+        uint64_t              m_contentHash = 0;
+    };
+
+    // An entry in the local compile cache, used for the LRU eviction of cached compiled resources
+    struct CompileCacheRecord final
+    {
+        inline bool IsValid() const { return m_filePath.IsValid(); }
+
+        FileSystem::Path      m_filePath;
+        uint64_t              m_fileSize = 0;
     };
 
     //-------------------------------------------------------------------------
@@ -28,6 +50,9 @@ namespace EE::Resource
     {
         constexpr static uint32_t const s_defaultStatementBufferSize = 8096;
 
+        // Increment this whenever the table layout changes, outdated databases are recreated on connection
+        constexpr static int32_t const s_schemaVersion = 3;
+
     public:
 
         ~CompiledResourceDatabase();
@@ -47,8 +72,28 @@ namespace EE::Resource
         // Update or create a record for a given ID
         bool WriteRecord( CompiledResourceRecord const& record );
 
+        // Try to get the memoized content hash for a file
+        bool GetFileContentHashRecord( FileSystem::Path const& filePath, FileContentHashRecord& outRecord ) const;
+
+        // Update or create the memoized content hash for a file
+        bool WriteFileContentHashRecord( FileContentHashRecord const& record );
+
+        // Update or create a compile cache entry, this also marks the entry as most recently used
+        bool WriteCompileCacheRecord( CompileCacheRecord const& record );
+
+        // Get all the least recently used compile cache entries that need to be removed to get the cache below the specified size
+        bool GetCompileCacheRecordsToEvict( uint64_t maxCacheSize, TVector<CompileCacheRecord>& outRecords ) const;
+
+        // Remove a compile cache entry
+        bool DeleteCompileCacheRecord( FileSystem::Path const& filePath );
+
     private:
 
+        bool UpdateSchema();
+
+        // The actual migration, needs to be called from within a transaction
+        bool UpdateSchemaInternal();
+
         bool CreateTables();
 
         bool DropTables();
@@ -0,0 +1,121 @@
+#include "ResourceArchiveBuilder.h"
+#include "System/Resource/ResourceArchive.h"
+#include "System/FileSystem/FileSystemUtils.h"
+#include "System/FileSystem/FileStreams.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/Math/Math.h"
+#include "System/Log.h"
+#include <EASTL/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    struct ArchiveSourceFile
+    {
+        ResourceID          m_resourceID;
+        FileSystem::Path    m_filePath;
+    };
+
+    //-------------------------------------------------------------------------
+
+    bool BuildResourceArchive( FileSystem::Path const& compiledResourceDirectoryPath, FileSystem::Path const& archivePath )
+    {
+        EE_ASSERT( compiledResourceDirectoryPath.IsValid() && compiledResourceDirectoryPath.IsDirectoryPath() );
+        EE_ASSERT( archivePath.IsValid() && archivePath.IsFilePath() );
+
+        // Gather all compiled resources
+        //-------------------------------------------------------------------------
+
+        TVector<FileSystem::Path> compiledFiles;
+        if ( !FileSystem::GetDirectoryContents( compiledResourceDirectoryPath, compiledFiles, FileSystem::DirectoryReaderOutput::OnlyFiles ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive Builder", "Failed to read compiled resource directory: %s", compiledResourceDirectoryPath.c_str() );
+            return false;
+        }
+
+        TVector<ArchiveSourceFile> sourceFiles;
+        sourceFiles.reserve( compiledFiles.size() );
+
+        for ( auto const& filePath : compiledFiles )
+        {
+            if ( filePath == archivePath )
+            {
+                continue;
+            }
+
+            ResourceID const resourceID( ResourcePath::FromFileSystemPath( compiledResourceDirectoryPath, filePath ) );
+            if ( !resourceID.IsValid() )
+            {
+                EE_LOG_WARNING( "Resource", "Resource Archive Builder", "Skipping non-resource file: %s", filePath.c_str() );
+                continue;
+            }
+
+            sourceFiles.push_back( { resourceID, filePath } );
+        }
+
+        // Sort by path ID for the runtime binary search, path IDs need to be unique within the archive
+        //-------------------------------------------------------------------------
+
+        eastl::sort( sourceFiles.begin(), sourceFiles.end(), [] ( ArchiveSourceFile const& a, ArchiveSourceFile const& b ) { return a.m_resourceID.GetPathID() < b.m_resourceID.GetPathID(); } );
+
+        for ( size_t i = 1; i < sourceFiles.size(); i++ )
+        {
+            if ( sourceFiles[i].m_resourceID.GetPathID() == sourceFiles[i - 1].m_resourceID.GetPathID() )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Archive Builder", "Resource path ID collision: %s and %s", sourceFiles[i].m_resourceID.c_str(), sourceFiles[i - 1].m_resourceID.c_str() );
+                return false;
+            }
+        }
+
+        // Write the archive - the entry table is written once all the data offsets are known
+        //-------------------------------------------------------------------------
+
+        FileSystem::OutputFileStream archiveStream( archivePath );
+        if ( !archiveStream.IsValid() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive Builder", "Failed to open archive for writing: %s", archivePath.c_str() );
+            return false;
+        }
+
+        ResourceArchive::Header header;
+        header.m_numEntries = (uint32_t) sourceFiles.size();
+
+        TVector<ResourceArchive::Entry> entries;
+        entries.resize( sourceFiles.size() );
+
+        uint64_t currentOffset = sizeof( ResourceArchive::Header ) + ( sizeof( ResourceArchive::Entry ) * entries.size() );
+        archiveStream.Write( &header, sizeof( ResourceArchive::Header ) );
+        archiveStream.Write( entries.data(), sizeof( ResourceArchive::Entry ) * entries.size() );
+
+        uint8_t const padding[ResourceArchive::s_dataAlignment] = { 0 };
+        Blob fileData;
+        for ( size_t i = 0; i < sourceFiles.size(); i++ )
+        {
+            if ( !FileSystem::LoadFile( sourceFiles[i].m_filePath, fileData ) || fileData.empty() )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Archive Builder", "Failed to read compiled resource: %s", sourceFiles[i].m_filePath.c_str() );
+                return false;
+            }
+
+            uint64_t const alignedOffset = Math::RoundUpToNearestMultiple64( currentOffset, ResourceArchive::s_dataAlignment );
+            archiveStream.Write( (void*) padding, size_t( alignedOffset - currentOffset ) );
+
+            auto& entry = entries[i];
+            entry.m_resourcePathID = sourceFiles[i].m_resourceID.GetPathID();
+            entry.m_compression = ResourceArchive::Compression::None;
+            entry.m_offset = alignedOffset;
+            entry.m_size = entry.m_uncompressedSize = fileData.size();
+
+            archiveStream.Write( fileData.data(), fileData.size() );
+            currentOffset = alignedOffset + fileData.size();
+        }
+
+        archiveStream.GetStream().seekp( sizeof( ResourceArchive::Header ) );
+        archiveStream.Write( entries.data(), sizeof( ResourceArchive::Entry ) * entries.size() );
+        archiveStream.Close();
+
+        EE_LOG_MESSAGE( "Resource", "Resource Archive Builder", "Built resource archive with %u resources: %s", header.m_numEntries, archivePath.c_str() );
+        return true;
+    }
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "System/FileSystem/FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+// Resource Archive Builder
+//-------------------------------------------------------------------------
+// Packs all the compiled resources in a directory into a single resource archive (see 'ResourceArchive')
+
+namespace EE::Resource
+{
+    bool BuildResourceArchive( FileSystem::Path const& compiledResourceDirectoryPath, FileSystem::Path const& archivePath );
+}
@@ -1,11 +1,14 @@
 #include "ResourceCompiler.h"
 #include "CompiledResourceDatabase.h"
+#include "ResourceArchiveBuilder.h"
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompilerRegistry.h"
 #include "System/Application/ApplicationGlobalState.h"
 #include "System/ThirdParty/cmdParser/cmdParser.h"
 #include "System/Resource/ResourceSettings.h"
+#include "System/Resource/ResourceArchive.h"
 #include "System/FileSystem/FileSystemUtils.h"
+#include "System/Encoding/Hash.h"
 #include "System/IniFile.h"
 #include "System/Log.h"
 
@@ -32,12 +35,23 @@ namespace EE
             cmdParser.set_optional<bool>( "debug", "debug", false, "Trigger debug break before execution." );
             cmdParser.set_optional<bool>( "force", "force", false, "Force compilation" );
             cmdParser.set_optional<bool>( "package", "package", false, "Compile resource for packaged build." );
+            cmdParser.set_optional<bool>( "archive", "archive", false, "Build the resource archive from the packaged build resources." );
+            cmdParser.set_optional<std::string>( "worker", "worker", "", "Run as a persistent compiler worker with the supplied session token, reading compile requests from stdin." );
 
             if ( cmdParser.run() )
             {
                 m_triggerDebugBreak = cmdParser.get<bool>( "debug" );
                 m_isForcedCompilation = cmdParser.get<bool>( "force" );
                 m_isForPackagedBuild = cmdParser.get<bool>( "package" );
+                m_buildArchive = cmdParser.get<bool>( "archive" );
+                m_workerSessionToken = cmdParser.get<std::string>( "worker" ).c_str();
+
+                // Archive builds and workers dont need a resource to compile
+                if ( m_buildArchive || IsWorker() )
+                {
+                    m_isValid = true;
+                    return;
+                }
 
                 // Get compile argument
                 ResourcePath const resourcePath( cmdParser.get<std::string>( "compile" ).c_str() );
@@ -60,13 +74,16 @@ namespace EE
         }
 
         bool IsValid() const { return m_isValid; }
+        bool IsWorker() const { return !m_workerSessionToken.empty(); }
 
     public:
 
         ResourceID          m_resourceID;
+        String              m_workerSessionToken;
         bool                m_triggerDebugBreak = false;
         bool                m_isForPackagedBuild = false;
         bool                m_isForcedCompilation = false;
+        bool                m_buildArchive = false;
         bool                m_isValid = false;
     };
 }
@@ -83,7 +100,7 @@ namespace EE::Resource
         m_compiledRecord.Clear();
         m_sourcePath.Clear();
         m_targetPath.Clear();
-        m_timestamp = m_combinedHash = 0;
+        m_timestamp = m_contentHash = m_combinedHash = m_combinedCompilerVersionHash = 0;
         m_sourceExists = m_targetExists = false;
         m_errorOccurredReadingDependencies = false;
         m_compilerVersion = -1;
@@ -134,7 +151,7 @@ namespace EE::Resource
                 return false;
             }
 
-            if ( m_compiledRecord.m_sourceTimestampHash != m_combinedHash )
+            if ( m_compiledRecord.m_sourceContentHash != m_combinedHash )
             {
                 return false;
             }
@@ -157,17 +174,20 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
-    ResourceCompilerApplication::ResourceCompilerApplication( CommandLineArgumentParser& argParser, ResourceSettings const& settings )
-        : m_compileContext( settings.m_rawResourcePath, argParser.m_isForPackagedBuild ? settings.m_packagedBuildCompiledResourcePath : settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild )
-        , m_forceCompilation( argParser.m_isForcedCompilation )
+    ResourceCompilerApplication::ResourceCompilerApplication( ResourceSettings const& settings )
+        : m_rawResourcePath( settings.m_rawResourcePath )
+        , m_compiledResourcePath( settings.m_compiledResourcePath )
+        , m_packagedBuildCompiledResourcePath( settings.m_packagedBuildCompiledResourcePath )
+        , m_compileCachePath( settings.m_compileCachePath )
     {
         AutoGenerated::Tools::RegisterTypes( m_typeRegistry );
         m_pCompilerRegistry = EE::New<CompilerRegistry>( m_typeRegistry, settings.m_rawResourcePath );
 
         //-------------------------------------------------------------------------
 
-        m_compileContext.m_rawResourceDirectoryPath.EnsureDirectoryExists();
-        m_compileContext.m_compiledResourceDirectoryPath.EnsureDirectoryExists();
+        m_rawResourcePath.EnsureDirectoryExists();
+        m_compiledResourcePath.EnsureDirectoryExists();
+        m_compileCachePath.EnsureDirectoryExists();
 
         //-------------------------------------------------------------------------
 
@@ -196,7 +216,7 @@ namespace EE::Resource
         return true;
     }
 
-    CompilationResult ResourceCompilerApplication::Run()
+    CompilationResult ResourceCompilerApplication::Compile( ResourceID const& resourceID, bool isForPackagedBuild, bool forceCompilation )
     {
         if ( !m_compiledResourceDB.IsConnected() )
         {
@@ -205,16 +225,17 @@ namespace EE::Resource
         }
 
         // Try create compilation context
-        if ( !m_compileContext.IsValid() )
+        CompileContext compileContext( m_rawResourcePath, isForPackagedBuild ? m_packagedBuildCompiledResourcePath : m_compiledResourcePath, resourceID, isForPackagedBuild );
+        if ( !compileContext.IsValid() )
         {
             return Resource::CompilationResult::Failure;
         }
 
         // Try find compiler
-        auto pCompiler = m_pCompilerRegistry->GetCompilerForResourceType( m_compileContext.m_resourceID.GetResourceTypeID() );
+        auto pCompiler = m_pCompilerRegistry->GetCompilerForResourceType( compileContext.m_resourceID.GetResourceTypeID() );
         if ( pCompiler == nullptr )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Cant find appropriate resource compiler for type: %u", m_compileContext.m_resourceID.GetResourceTypeID() );
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Cant find appropriate resource compiler for type: %u", compileContext.m_resourceID.GetResourceTypeID() );
             return Resource::CompilationResult::Failure;
         }
 
@@ -222,23 +243,23 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         // Validate input path
-        if ( pCompiler->IsInputFileRequired() && !FileSystem::Exists( m_compileContext.m_inputFilePath ) )
+        if ( pCompiler->IsInputFileRequired() && !FileSystem::Exists( compileContext.m_inputFilePath ) )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Source file for data path ('%s') does not exist: '%s'\n", m_compileContext.m_rawResourceDirectoryPath.c_str(), m_compileContext.m_inputFilePath.c_str() );
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Source file for data path ('%s') does not exist: '%s'\n", compileContext.m_rawResourceDirectoryPath.c_str(), compileContext.m_inputFilePath.c_str() );
             return Resource::CompilationResult::Failure;
         }
 
         // Try create target directory
-        if ( !m_compileContext.m_outputFilePath.EnsureDirectoryExists() )
+        if ( !compileContext.m_outputFilePath.EnsureDirectoryExists() )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination path (%s) doesnt exist!", m_compileContext.m_outputFilePath.GetParentDirectory().c_str() );
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination path (%s) doesnt exist!", compileContext.m_outputFilePath.GetParentDirectory().c_str() );
             return Resource::CompilationResult::Failure;
         }
 
         // Check that target file isnt read-only
-        if ( FileSystem::Exists( m_compileContext.m_outputFilePath ) && FileSystem::IsFileReadOnly( m_compileContext.m_outputFilePath ) )
+        if ( FileSystem::Exists( compileContext.m_outputFilePath ) && FileSystem::IsFileReadOnly( compileContext.m_outputFilePath ) )
         {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination file (%s) is read-only!", m_compileContext.m_outputFilePath.GetFullPath().c_str() );
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Error: Destination file (%s) is read-only!", compileContext.m_outputFilePath.GetFullPath().c_str() );
             return Resource::CompilationResult::Failure;
         }
 
@@ -248,40 +269,130 @@ namespace EE::Resource
         // Check compile dependency and if this resource needs compilation
         m_uniqueCompileDependencies.clear();
         m_compileDependencyTreeRoot.Reset();
-        if ( !FillCompileDependencyNode( &m_compileDependencyTreeRoot, m_compileContext.m_resourceID ) )
+        if ( !FillCompileDependencyNode( compileContext, &m_compileDependencyTreeRoot, compileContext.m_resourceID ) )
         {
             EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to create dependency tree: %s", m_errorMessage.c_str() );
             return Resource::CompilationResult::Failure;
         }
 
         // If we are not forcing the compilation and we're up to date, there's nothing to do
-        if ( m_compileDependencyTreeRoot.IsUpToDate() && !m_forceCompilation )
+        if ( m_compileDependencyTreeRoot.IsUpToDate() && !forceCompilation )
         {
             return Resource::CompilationResult::SuccessUpToDate;
         }
 
-        m_compileContext.m_sourceResourceHash = m_compileDependencyTreeRoot.m_combinedHash;
+        compileContext.m_sourceResourceHash = m_compileDependencyTreeRoot.m_combinedHash;
 
         // Compile
         //-------------------------------------------------------------------------
 
-        Resource::CompilationResult const compilationResult = pCompiler->Compile( m_compileContext );
+        Resource::CompilationResult compilationResult = Resource::CompilationResult::Failure;
+
+        // Resources that are always recompiled dont have any inputs to key the cache on
+        bool const canUseCompileCache = !m_compileDependencyTreeRoot.m_forceRecompile;
+        FileSystem::Path const cachedFilePath = canUseCompileCache ? GetCompileCacheFilePath( compileContext, m_compileDependencyTreeRoot.m_combinedCompilerVersionHash ) : FileSystem::Path();
+
+        // Try to restore a previously compiled output with the same inputs
+        if ( !forceCompilation && canUseCompileCache && FileSystem::Exists( cachedFilePath ) && FileSystem::DuplicateFile( cachedFilePath, compileContext.m_outputFilePath ) )
+        {
+            EE_LOG_MESSAGE( "Resource", "Resource Compiler", "Restored from compile cache: %s", compileContext.m_resourceID.c_str() );
+            compilationResult = Resource::CompilationResult::Success;
+            AddToCompileCache( cachedFilePath );
+        }
+        else
+        {
+            compilationResult = pCompiler->Compile( compileContext );
+
+            // Only cache clean compilations, restoring from the cache would hide any warnings
+            if ( canUseCompileCache && compilationResult == Resource::CompilationResult::Success )
+            {
+                if ( FileSystem::DuplicateFile( compileContext.m_outputFilePath, cachedFilePath ) )
+                {
+                    AddToCompileCache( cachedFilePath );
+                    EvictFromCompileCache();
+                }
+            }
+        }
 
         // Update database
         if ( compilationResult == Resource::CompilationResult::Success )
         {
             Resource::CompiledResourceRecord record;
-            record.m_resourceID = m_compileContext.m_resourceID;
+            record.m_resourceID = compileContext.m_resourceID;
             record.m_compilerVersion = m_compileDependencyTreeRoot.m_compilerVersion;
             record.m_fileTimestamp = m_compileDependencyTreeRoot.m_timestamp;
-            record.m_sourceTimestampHash = m_compileDependencyTreeRoot.m_combinedHash;
+            record.m_sourceContentHash = m_compileDependencyTreeRoot.m_combinedHash;
             m_compiledResourceDB.WriteRecord( record );
         }
 
         return compilationResult;
     }
 
-    bool ResourceCompilerApplication::BuildCompileDependencyTree( ResourceID const& resourceID )
+    // Protocol messages always start on a fresh line since the preceding log output might not have been newline terminated
+    static void SendWorkerMessage( char const* pSessionToken, char const* pMessage )
+    {
+        fflush( stdout );
+        printf( "\n%s%s:%s\n", CompilerWorker::s_messagePrefix, pSessionToken, pMessage );
+        fflush( stdout );
+    }
+
+    int32_t ResourceCompilerApplication::RunWorker( char const* pSessionToken )
+    {
+        EE_ASSERT( pSessionToken != nullptr && pSessionToken[0] != 0 );
+
+        // Let the server know that we are initialized and ready to receive requests
+        SendWorkerMessage( pSessionToken, CompilerWorker::s_readyMessage );
+
+        char request[CompilerWorker::s_maxLineLength];
+        while ( fgets( request, CompilerWorker::s_maxLineLength, stdin ) != nullptr )
+        {
+            // Strip line ending
+            size_t requestLength = strlen( request );
+            while ( requestLength > 0 && ( request[requestLength - 1] == '\n' || request[requestLength - 1] == '\r' ) )
+            {
+                request[--requestLength] = 0;
+            }
+
+            if ( strcmp( request, CompilerWorker::s_exitCommand ) == 0 )
+            {
+                break;
+            }
+
+            // Parse and execute request
+            //-------------------------------------------------------------------------
+
+            CompilationResult result = CompilationResult::Failure;
+
+            int32_t isForced = 0, isForPackagedBuild = 0, resourcePathOffset = 0;
+            if ( sscanf( request, "%d %d %n", &isForced, &isForPackagedBuild, &resourcePathOffset ) == 2 && resourcePathOffset > 0 )
+            {
+                ResourcePath const resourcePath( request + resourcePathOffset );
+                ResourceID const resourceID = resourcePath.IsValid() ? ResourceID( resourcePath ) : ResourceID();
+                if ( resourceID.IsValid() )
+                {
+                    result = Compile( resourceID, isForPackagedBuild != 0, isForced != 0 );
+                }
+                else
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Compiler", "Invalid compile request: %s", request + resourcePathOffset );
+                }
+            }
+            else
+            {
+                EE_LOG_ERROR( "Resource", "Resource Compiler", "Malformed compiler worker request: %s", request );
+            }
+
+            // The log has already been streamed to the server, so dont let the unhandled entries accumulate across requests
+            Log::GetUnhandledWarningsAndErrors();
+
+            InlineString const resultMessage( InlineString::CtorSprintf(), "%s%d", CompilerWorker::s_resultMessage, (int32_t) result );
+            SendWorkerMessage( pSessionToken, resultMessage.c_str() );
+        }
+
+        return 0;
+    }
+
+    bool ResourceCompilerApplication::BuildCompileDependencyTree( CompileContext const& ctx, ResourceID const& resourceID )
     {
         EE_ASSERT( resourceID.IsValid() );
 
@@ -290,7 +401,7 @@ namespace EE::Resource
         m_errorMessage.clear();
         m_uniqueCompileDependencies.clear();
         m_compileDependencyTreeRoot.Reset();
-        return FillCompileDependencyNode( &m_compileDependencyTreeRoot, resourceID );
+        return FillCompileDependencyNode( ctx, &m_compileDependencyTreeRoot, resourceID );
     }
 
     bool ResourceCompilerApplication::TryReadCompileDependencies( FileSystem::Path const& resourceFilePath, TVector<ResourceID>& outDependencies ) const
@@ -310,7 +421,7 @@ namespace EE::Resource
         return true;
     }
 
-    bool ResourceCompilerApplication::FillCompileDependencyNode( CompileDependencyNode* pNode, ResourceID const& resourceID )
+    bool ResourceCompilerApplication::FillCompileDependencyNode( CompileContext const& ctx, CompileDependencyNode* pNode, ResourceID const& resourceID )
     {
         EE_ASSERT( pNode != nullptr );
 
@@ -319,9 +430,10 @@ namespace EE::Resource
 
         pNode->m_ID = resourceID;
 
-        pNode->m_sourcePath = ResourcePath::ToFileSystemPath( m_compileContext.m_rawResourceDirectoryPath, resourceID.GetResourcePath() );
+        pNode->m_sourcePath = ResourcePath::ToFileSystemPath( ctx.m_rawResourceDirectoryPath, resourceID.GetResourcePath() );
         pNode->m_sourceExists = FileSystem::Exists( pNode->m_sourcePath );
         pNode->m_timestamp = pNode->m_sourceExists ? FileSystem::GetFileModifiedTime( pNode->m_sourcePath ) : 0;
+        pNode->m_contentHash = pNode->m_sourceExists ? GetFileContentHash( pNode->m_sourcePath, pNode->m_timestamp ) : 0;
 
         // Handle compilable resources
         //-------------------------------------------------------------------------
@@ -331,7 +443,7 @@ namespace EE::Resource
         bool skipDependencyCheck = !isCompilableResource || !ShouldCheckCompileDependenciesForResourceType( resourceID );
         if ( isCompilableResource )
         {
-            pNode->m_targetPath = ResourcePath::ToFileSystemPath( m_compileContext.m_compiledResourceDirectoryPath, resourceID.GetResourcePath() );
+            pNode->m_targetPath = ResourcePath::ToFileSystemPath( ctx.m_compiledResourceDirectoryPath, resourceID.GetResourcePath() );
             pNode->m_targetExists = FileSystem::Exists( pNode->m_targetPath );
 
             pNode->m_compilerVersion = pCompiler->GetVersion();
@@ -381,7 +493,7 @@ namespace EE::Resource
 
                     auto pChildDependencyNode = pNode->m_dependencies.emplace_back( EE::New<CompileDependencyNode>() );
                     pChildDependencyNode->m_pParentNode = pNode;
-                    if ( !FillCompileDependencyNode( pChildDependencyNode, dependencyResourceID ) )
+                    if ( !FillCompileDependencyNode( ctx, pChildDependencyNode, dependencyResourceID ) )
                     {
                         return false;
                     }
@@ -399,14 +511,103 @@ namespace EE::Resource
         // Generate combined hash
         //-------------------------------------------------------------------------
 
-        pNode->m_combinedHash = pNode->m_timestamp;
+        TInlineVector<uint64_t, 16> hashes;
+        hashes.emplace_back( pNode->m_contentHash );
         for ( auto const pDep : pNode->m_dependencies )
         {
-            pNode->m_combinedHash += pDep->m_combinedHash;
+            hashes.emplace_back( pDep->m_combinedHash );
         }
 
+        pNode->m_combinedHash = Hash::XXHash::GetHash64( hashes.data(), hashes.size() * sizeof( uint64_t ) );
+
+        // Generate combined compiler version hash
+        //-------------------------------------------------------------------------
+        // Dependencies are often compiled into (or validated against) our output, so a change to any of their compilers needs to change our compile cache key
+
+        TInlineVector<uint64_t, 16> compilerVersionHashes;
+        compilerVersionHashes.emplace_back( (uint64_t) pNode->m_compilerVersion );
+        for ( auto const pDep : pNode->m_dependencies )
+        {
+            compilerVersionHashes.emplace_back( pDep->m_combinedCompilerVersionHash );
+        }
+
+        pNode->m_combinedCompilerVersionHash = Hash::XXHash::GetHash64( compilerVersionHashes.data(), compilerVersionHashes.size() * sizeof( uint64_t ) );
+
         return true;
     }
+
+    uint64_t ResourceCompilerApplication::GetFileContentHash( FileSystem::Path const& filePath, uint64_t fileTimestamp )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+
+        uint64_t const fileSize = FileSystem::GetFileSize( filePath );
+
+        // Use the memoized hash if the file hasnt changed
+        FileContentHashRecord record;
+        if ( m_compiledResourceDB.GetFileContentHashRecord( filePath, record ) && record.IsValid() )
+        {
+            if ( record.m_fileSize == fileSize && record.m_fileTimestamp == fileTimestamp )
+            {
+                return record.m_contentHash;
+            }
+        }
+
+        // Hash the file contents
+        Blob fileData;
+        if ( !FileSystem::LoadFile( filePath, fileData ) )
+        {
+            return 0;
+        }
+
+        record.m_filePath = filePath;
+        record.m_fileSize = fileSize;
+        record.m_fileTimestamp = fileTimestamp;
+        record.m_contentHash = Hash::XXHash::GetHash64( fileData );
+        m_compiledResourceDB.WriteFileContentHashRecord( record );
+
+        return record.m_contentHash;
+    }
+
+    FileSystem::Path ResourceCompilerApplication::GetCompileCacheFilePath( CompileContext const& ctx, uint64_t combinedCompilerVersionHash ) const
+    {
+        // The resource path is part of the key since compiled resources can reference their own ID
+        uint64_t const keyData[4] =
+        {
+            combinedCompilerVersionHash,
+            ctx.IsCompilingForPackagedBuild() ? 1ull : 0ull,
+            Hash::GetHash64( ctx.m_resourceID.GetResourcePath().GetString() ),
+            ctx.m_sourceResourceHash
+        };
+
+        uint64_t const cacheKey = Hash::XXHash::GetHash64( keyData, sizeof( keyData ) );
+
+        InlineString const filename( InlineString::CtorSprintf(), "%016llx.%s", cacheKey, ctx.m_resourceID.GetResourceTypeID().ToString().c_str() );
+        return m_compileCachePath + filename.c_str();
+    }
+
+    void ResourceCompilerApplication::AddToCompileCache( FileSystem::Path const& cachedFilePath )
+    {
+        CompileCacheRecord record;
+        record.m_filePath = cachedFilePath;
+        record.m_fileSize = FileSystem::GetFileSize( cachedFilePath );
+        m_compiledResourceDB.WriteCompileCacheRecord( record );
+    }
+
+    void ResourceCompilerApplication::EvictFromCompileCache()
+    {
+        TVector<CompileCacheRecord> recordsToEvict;
+        if ( !m_compiledResourceDB.GetCompileCacheRecordsToEvict( s_maxCompileCacheSize, recordsToEvict ) )
+        {
+            return;
+        }
+
+        // Other compiler processes might be evicting the same entries, so failing to erase a file is not an error
+        for ( auto const& record : recordsToEvict )
+        {
+            FileSystem::EraseFile( record.m_filePath );
+            m_compiledResourceDB.DeleteCompileCacheRecord( record.m_filePath );
+        }
+    }
 }
 
 //-------------------------------------------------------------------------
@@ -459,6 +660,15 @@ int main( int argc, char* argv[] )
         EE_HALT();
     }
 
+    // Resource Archive
+    //-------------------------------------------------------------------------
+
+    if ( argParser.m_buildArchive )
+    {
+        FileSystem::Path const archivePath = settings.m_packagedBuildCompiledResourcePath + Resource::ResourceArchive::s_archiveFilename;
+        return Resource::BuildResourceArchive( settings.m_packagedBuildCompiledResourcePath, archivePath ) ? 0 : -1;
+    }
+
     // Compilation DB
     //-------------------------------------------------------------------------
 
@@ -472,6 +682,12 @@ int main( int argc, char* argv[] )
     // Compile Resource
     //-------------------------------------------------------------------------
 
-    Resource::ResourceCompilerApplication application( argParser, settings );
-    return (int32_t)application.Run();
+    Resource::ResourceCompilerApplication application( settings );
+
+    if ( argParser.IsWorker() )
+    {
+        return application.RunWorker( argParser.m_workerSessionToken.c_str() );
+    }
+
+    return (int32_t) application.Compile( argParser.m_resourceID, argParser.m_isForPackagedBuild, argParser.m_isForcedCompilation );
 }
\ No newline at end of file
@@ -5,13 +5,6 @@
 
 //-------------------------------------------------------------------------
 
-namespace EE
-{
-    struct CommandLineArgumentParser;
-}
-
-//-------------------------------------------------------------------------
-
 namespace EE::Resource
 {
     class ResourceSettings;
@@ -21,6 +14,9 @@ namespace EE::Resource
 
     class ResourceCompilerApplication
     {
+        // The max size of the local compile cache, least recently used entries are evicted past this
+        constexpr static uint64_t const s_maxCompileCacheSize = 4ull * 1024 * 1024 * 1024;
+
         struct CompileDependencyNode
         {
             void Reset();
@@ -41,7 +37,9 @@ namespace EE::Resource
             int32_t                                 m_compilerVersion = -1;
             CompiledResourceRecord                  m_compiledRecord;
             uint64_t                                m_timestamp = 0;
-            uint64_t                                m_combinedHash = 0;
+            uint64_t                                m_contentHash = 0;      // The hash of the resource file contents
+            uint64_t                                m_combinedHash = 0;     // The hash of our contents and the combined hashes of all our dependencies
+            uint64_t                                m_combinedCompilerVersionHash = 0; // The hash of our compiler version and the combined compiler version hashes of all our dependencies
 
             CompileDependencyNode*                  m_pParentNode = nullptr;
             TVector<CompileDependencyNode*>         m_dependencies;
@@ -53,24 +51,46 @@ namespace EE::Resource
 
     public:
 
-        ResourceCompilerApplication( CommandLineArgumentParser& argParser, ResourceSettings const& settings );
+        ResourceCompilerApplication( ResourceSettings const& settings );
         ~ResourceCompilerApplication();
 
-        CompilationResult Run();
+        // Compile a single resource
+        CompilationResult Compile( ResourceID const& resourceID, bool isForPackagedBuild, bool forceCompilation );
+
+        // Run as a persistent compiler worker, processing compile requests from stdin until told to exit (see 'CompilerWorker')
+        int32_t RunWorker( char const* pSessionToken );
 
     private:
 
-        bool BuildCompileDependencyTree( ResourceID const& resourceID );
+        bool BuildCompileDependencyTree( CompileContext const& ctx, ResourceID const& resourceID );
         bool TryReadCompileDependencies( FileSystem::Path const& resourceFilePath, TVector<ResourceID>& outDependencies ) const;
-        bool FillCompileDependencyNode( CompileDependencyNode* pNode, ResourceID const& resourceID );
+        bool FillCompileDependencyNode( CompileContext const& ctx, CompileDependencyNode* pNode, ResourceID const& resourceID );
+
+        // Get the content hash for a file, this is memoized in the database and only recalculated if the file size or timestamp changes
+        uint64_t GetFileContentHash( FileSystem::Path const& filePath, uint64_t fileTimestamp );
+
+        // Compile Cache
+        //-------------------------------------------------------------------------
+        // A local content addressed store of compiled resources keyed on the compiler versions and input hashes of the resource and all its dependencies
+        // This allows us to restore previously compiled outputs (i.e. after switching branches) instead of recompiling them
+
+        FileSystem::Path GetCompileCacheFilePath( CompileContext const& ctx, uint64_t combinedCompilerVersionHash ) const;
+
+        // Register a cached file with the database, this marks it as the most recently used entry
+        void AddToCompileCache( FileSystem::Path const& cachedFilePath );
+
+        // Remove the least recently used entries until the cache is below its max size
+        void EvictFromCompileCache();
 
     private:
 
         TypeSystem::TypeRegistry                m_typeRegistry;
         CompiledResourceDatabase                m_compiledResourceDB;
         CompilerRegistry*                       m_pCompilerRegistry = nullptr;
-        CompileContext                          m_compileContext;
-        bool                                    m_forceCompilation = false;
+        FileSystem::Path                        m_rawResourcePath;
+        FileSystem::Path                        m_compiledResourcePath;
+        FileSystem::Path                        m_packagedBuildCompiledResourcePath;
+        FileSystem::Path                        m_compileCachePath;
 
         TVector<ResourceID>                     m_uniqueCompileDependencies;
         CompileDependencyNode                   m_compileDependencyTreeRoot;
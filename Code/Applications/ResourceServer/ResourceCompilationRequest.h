@@ -85,7 +85,7 @@ namespace EE::Resource
         ResourceID                          m_resourceID;
         int32_t                             m_compilerVersion = -1;
         uint64_t                            m_fileTimestamp = 0;
-        uint64_t                            m_sourceTimestampHash = 0;
+        uint64_t                            m_sourceContentHash = 0;
         FileSystem::Path                    m_sourceFile;
         FileSystem::Path                    m_destinationFile;
         String                              m_compilerArgs;
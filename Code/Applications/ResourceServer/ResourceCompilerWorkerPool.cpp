@@ -0,0 +1,310 @@
+#include "ResourceCompilerWorkerPool.h"
+#include "EngineTools/ThirdParty/subprocess/subprocess.h"
+#include "System/Types/UUID.h"
+
+#include <windows.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    enum class OutputReadResult
+    {
+        Data,
+        Closed,
+        TimedOut
+    };
+
+    // Read whatever output is available from the worker's stdout pipe, waiting at most the timeout for some output to arrive
+    // This requires the process to be created with the async option so that the pipe supports overlapped reads
+    static OutputReadResult ReadWorkerOutput( subprocess_s* pProcess, char* pBuffer, uint32_t bufferSize, Milliseconds timeout, uint32_t& outNumBytesRead )
+    {
+        HANDLE const hOutput = (HANDLE) _get_osfhandle( _fileno( subprocess_stdout( pProcess ) ) );
+
+        OVERLAPPED overlapped = {};
+        overlapped.hEvent = pProcess->hEventOutput;
+
+        DWORD numBytesRead = 0;
+        if ( !ReadFile( hOutput, pBuffer, bufferSize, &numBytesRead, &overlapped ) )
+        {
+            if ( GetLastError() != ERROR_IO_PENDING )
+            {
+                return OutputReadResult::Closed;
+            }
+
+            if ( WaitForSingleObject( overlapped.hEvent, (DWORD) timeout.ToFloat() ) == WAIT_TIMEOUT )
+            {
+                // The pending read references our buffer, so wait for the cancellation to complete before returning
+                CancelIoEx( hOutput, &overlapped );
+                GetOverlappedResult( hOutput, &overlapped, &numBytesRead, TRUE );
+                return OutputReadResult::TimedOut;
+            }
+
+            if ( !GetOverlappedResult( hOutput, &overlapped, &numBytesRead, FALSE ) )
+            {
+                return OutputReadResult::Closed;
+            }
+        }
+
+        outNumBytesRead = numBytesRead;
+        return ( numBytesRead > 0 ) ? OutputReadResult::Data : OutputReadResult::Closed;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompilerWorkerPool::~CompilerWorkerPool()
+    {
+        EE_ASSERT( m_workers.empty() );
+    }
+
+    void CompilerWorkerPool::Initialize( FileSystem::Path const& compilerExecutablePath )
+    {
+        EE_ASSERT( compilerExecutablePath.IsValid() );
+        m_compilerExecutablePath = compilerExecutablePath;
+    }
+
+    void CompilerWorkerPool::Shutdown()
+    {
+        Threading::ScopeLock lock( m_mutex );
+
+        // All compilations need to be complete before shutting down
+        EE_ASSERT( m_idleWorkers.size() == m_workers.size() );
+
+        for ( auto pWorker : m_workers )
+        {
+            StopWorker( pWorker );
+            EE::Delete( pWorker );
+        }
+
+        m_workers.clear();
+        m_idleWorkers.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompilerWorkerPool::StartWorker( Worker* pWorker, String& outLog )
+    {
+        EE_ASSERT( pWorker != nullptr && pWorker->m_pProcess == nullptr );
+
+        // Each worker process gets a unique session token that frames its protocol messages
+        UUIDString const sessionToken = UUID::GenerateID().ToString();
+        pWorker->m_messagePrefix.sprintf( "%s%s:", CompilerWorker::s_messagePrefix, sessionToken.c_str() );
+        pWorker->m_pendingOutput.clear();
+
+        char const* processCommandLineArgs[4] = { m_compilerExecutablePath.c_str(), "-worker", sessionToken.c_str(), nullptr };
+
+        // No default ctor for subprocess struct, so zero-init
+        pWorker->m_pProcess = EE::New<subprocess_s>();
+        Memory::MemsetZero( pWorker->m_pProcess );
+
+        if ( subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window | subprocess_option_enable_async, pWorker->m_pProcess ) != 0 )
+        {
+            EE::Delete( pWorker->m_pProcess );
+            outLog = "Resource compiler worker failed to start!";
+            return false;
+        }
+
+        // Wait for the worker to finish initializing, any output before that point is not part of a compilation
+        //-------------------------------------------------------------------------
+
+        String startupLog;
+        String line;
+        char const* pMessage = nullptr;
+
+        ReadResult readResult;
+        while ( ( readResult = ReadLine( pWorker, line ) ) == ReadResult::Line )
+        {
+            if ( IsProtocolMessage( pWorker, line, pMessage ) && strncmp( pMessage, CompilerWorker::s_readyMessage, strlen( CompilerWorker::s_readyMessage ) ) == 0 )
+            {
+                pWorker->m_numCompletedRequests = 0;
+                m_numWorkersStarted++;
+                return true;
+            }
+
+            startupLog += line;
+        }
+
+        startupLog += line;
+        DestroyCrashedWorker( pWorker );
+        outLog.sprintf( "Resource compiler worker %s!\n%s", ( readResult == ReadResult::TimedOut ) ? "timed out during initialization" : "failed to initialize", startupLog.c_str() );
+        return false;
+    }
+
+    void CompilerWorkerPool::StopWorker( Worker* pWorker )
+    {
+        EE_ASSERT( pWorker != nullptr );
+
+        if ( pWorker->m_pProcess == nullptr )
+        {
+            return;
+        }
+
+        // Ask the worker to exit, joining also closes the stdin pipe so the worker will exit even if it missed the command
+        FILE* pWorkerInput = subprocess_stdin( pWorker->m_pProcess );
+        fprintf( pWorkerInput, "%s\n", CompilerWorker::s_exitCommand );
+        fflush( pWorkerInput );
+
+        subprocess_join( pWorker->m_pProcess, nullptr );
+        subprocess_destroy( pWorker->m_pProcess );
+        EE::Delete( pWorker->m_pProcess );
+    }
+
+    void CompilerWorkerPool::DestroyCrashedWorker( Worker* pWorker )
+    {
+        EE_ASSERT( pWorker != nullptr && pWorker->m_pProcess != nullptr );
+
+        if ( subprocess_alive( pWorker->m_pProcess ) )
+        {
+            subprocess_terminate( pWorker->m_pProcess );
+        }
+
+        subprocess_join( pWorker->m_pProcess, nullptr );
+        subprocess_destroy( pWorker->m_pProcess );
+        EE::Delete( pWorker->m_pProcess );
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompilerWorkerPool::ReadResult CompilerWorkerPool::ReadLine( Worker* pWorker, String& outLine )
+    {
+        EE_ASSERT( pWorker != nullptr && pWorker->m_pProcess != nullptr );
+
+        outLine.clear();
+
+        char readBuffer[CompilerWorker::s_maxLineLength];
+        while ( true )
+        {
+            // Return any complete line that we have already received
+            size_t const lineEndIdx = pWorker->m_pendingOutput.find( '\n' );
+            if ( lineEndIdx != String::npos )
+            {
+                outLine.assign( pWorker->m_pendingOutput.c_str(), lineEndIdx + 1 );
+                pWorker->m_pendingOutput.erase( 0, lineEndIdx + 1 );
+                return ReadResult::Line;
+            }
+
+            // Wait for more output
+            uint32_t numBytesRead = 0;
+            OutputReadResult const result = ReadWorkerOutput( pWorker->m_pProcess, readBuffer, sizeof( readBuffer ), Milliseconds( Seconds( s_readTimeoutSeconds ) ), numBytesRead );
+            if ( result != OutputReadResult::Data )
+            {
+                outLine.swap( pWorker->m_pendingOutput );
+                pWorker->m_pendingOutput.clear();
+                return ( result == OutputReadResult::TimedOut ) ? ReadResult::TimedOut : ReadResult::Closed;
+            }
+
+            pWorker->m_pendingOutput.append( readBuffer, numBytesRead );
+        }
+    }
+
+    bool CompilerWorkerPool::IsProtocolMessage( Worker* pWorker, String const& line, char const*& pOutMessage ) const
+    {
+        EE_ASSERT( pWorker != nullptr );
+
+        if ( strncmp( line.c_str(), pWorker->m_messagePrefix.c_str(), pWorker->m_messagePrefix.length() ) != 0 )
+        {
+            return false;
+        }
+
+        pOutMessage = line.c_str() + pWorker->m_messagePrefix.length();
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompilerWorkerPool::Worker* CompilerWorkerPool::AcquireWorker( String& outLog )
+    {
+        Worker* pWorker = nullptr;
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            if ( m_idleWorkers.empty() )
+            {
+                pWorker = m_workers.emplace_back( EE::New<Worker>() );
+            }
+            else
+            {
+                pWorker = m_idleWorkers.back();
+                m_idleWorkers.pop_back();
+            }
+        }
+
+        // (Re)start the worker outside of the lock since it takes a while
+        if ( pWorker->m_pProcess == nullptr )
+        {
+            if ( !StartWorker( pWorker, outLog ) )
+            {
+                ReleaseWorker( pWorker );
+                return nullptr;
+            }
+        }
+
+        return pWorker;
+    }
+
+    void CompilerWorkerPool::ReleaseWorker( Worker* pWorker )
+    {
+        EE_ASSERT( pWorker != nullptr );
+        Threading::ScopeLock lock( m_mutex );
+        m_idleWorkers.emplace_back( pWorker );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompilerWorkerPool::Compile( char const* pResourcePath, bool isForced, bool isForPackagedBuild, CompilationResult& outResult, String& outLog )
+    {
+        EE_ASSERT( pResourcePath != nullptr );
+
+        outResult = CompilationResult::Failure;
+
+        Worker* pWorker = AcquireWorker( outLog );
+        if ( pWorker == nullptr )
+        {
+            return false;
+        }
+
+        // Send request
+        //-------------------------------------------------------------------------
+
+        FILE* pWorkerInput = subprocess_stdin( pWorker->m_pProcess );
+        fprintf( pWorkerInput, "%d %d %s\n", isForced ? 1 : 0, isForPackagedBuild ? 1 : 0, pResourcePath );
+        fflush( pWorkerInput );
+
+        // Read the log until we get the result
+        //-------------------------------------------------------------------------
+
+        size_t const resultMessageLength = strlen( CompilerWorker::s_resultMessage );
+
+        bool receivedResult = false;
+        String line;
+        char const* pMessage = nullptr;
+
+        ReadResult readResult;
+        while ( ( readResult = ReadLine( pWorker, line ) ) == ReadResult::Line )
+        {
+            if ( IsProtocolMessage( pWorker, line, pMessage ) && strncmp( pMessage, CompilerWorker::s_resultMessage, resultMessageLength ) == 0 )
+            {
+                outResult = (CompilationResult) atoi( pMessage + resultMessageLength );
+                receivedResult = true;
+                break;
+            }
+
+            outLog += line;
+        }
+
+        // If the pipe closed or the worker stopped responding before we got a result, kill it, it will be restarted on the next request
+        if ( receivedResult )
+        {
+            pWorker->m_numCompletedRequests++;
+        }
+        else
+        {
+            outLog += line;
+            DestroyCrashedWorker( pWorker );
+            outLog += ( readResult == ReadResult::TimedOut ) ? "\nResource compiler worker timed out and was killed!" : "\nResource compiler worker crashed!";
+        }
+
+        ReleaseWorker( pWorker );
+        return receivedResult;
+    }
+}
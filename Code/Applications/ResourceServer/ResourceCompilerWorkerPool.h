@@ -0,0 +1,78 @@
+#pragma once
+
+#include "EngineTools/Resource/ResourceCompiler.h"
+#include "System/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+
+struct subprocess_s;
+
+//-------------------------------------------------------------------------
+// Resource Compiler Worker Pool
+//-------------------------------------------------------------------------
+// A pool of long-lived resource compiler processes that receive compile requests over their stdin pipe
+// This avoids paying the process startup, type registration and database connection costs for every compiled resource
+//
+// Workers are created on demand, so there are at most as many workers as there are concurrent compilation tasks
+// Workers that die during a compilation, or that produce no output for longer than the read timeout, are killed and replaced by a new worker on the next request
+
+namespace EE::Resource
+{
+    class CompilerWorkerPool
+    {
+        struct Worker
+        {
+            subprocess_s*                   m_pProcess = nullptr;
+            String                          m_messagePrefix;            // The framing prefix (including the session token) for protocol messages from this worker
+            String                          m_pendingOutput;            // Output received but not yet split into lines
+            uint32_t                        m_numCompletedRequests = 0;
+        };
+
+        enum class ReadResult
+        {
+            Line,
+            Closed,
+            TimedOut
+        };
+
+    public:
+
+        // How long we wait for any output from a worker before we consider it hung
+        constexpr static float const s_readTimeoutSeconds = 300.0f;
+
+        ~CompilerWorkerPool();
+
+        void Initialize( FileSystem::Path const& compilerExecutablePath );
+        void Shutdown();
+
+        // Compile a resource on one of the workers, this will block until the compilation completes
+        // Returns false if we failed to get a response from the worker, the log will contain the reason
+        bool Compile( char const* pResourcePath, bool isForced, bool isForPackagedBuild, CompilationResult& outResult, String& outLog );
+
+        // Get the number of workers started so far, including restarts of crashed workers
+        inline uint32_t GetNumWorkersStarted() const { return m_numWorkersStarted; }
+
+    private:
+
+        Worker* AcquireWorker( String& outLog );
+        void ReleaseWorker( Worker* pWorker );
+
+        bool StartWorker( Worker* pWorker, String& outLog );
+        void StopWorker( Worker* pWorker );
+        void DestroyCrashedWorker( Worker* pWorker );
+
+        // Read the next line of output from the worker, on failure the line contains any partial output received
+        ReadResult ReadLine( Worker* pWorker, String& outLine );
+
+        // Returns true if the line is a protocol message from this worker, sets the message pointer to the start of the message payload
+        bool IsProtocolMessage( Worker* pWorker, String const& line, char const*& pOutMessage ) const;
+
+    private:
+
+        FileSystem::Path                    m_compilerExecutablePath;
+        Threading::Mutex                    m_mutex;
+        TVector<Worker*>                    m_workers;
+        TVector<Worker*>                    m_idleWorkers;
+        std::atomic<uint32_t>               m_numWorkersStarted = 0;
+    };
+}
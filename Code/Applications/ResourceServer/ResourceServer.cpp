@@ -1,7 +1,6 @@
 #include "ResourceServer.h"
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompiler.h"
-#include "EngineTools/ThirdParty/subprocess/subprocess.h"
 #include "Engine/Entity/EntityDescriptors.h"
 #include "Engine/Entity/EntitySerialization.h"
 #include "System/Resource/ResourceProviders/ResourceNetworkMessages.h"
@@ -25,14 +24,6 @@ namespace EE::Resource
             , m_pRequest( pRequest )
         {
             EE_ASSERT( m_context.IsValid() );
-
-            // No default ctor for subprocess struct, so zero-init
-            Memory::MemsetZero( &m_subProcess );
-        }
-
-        ~CompilationTask()
-        {
-            EE_ASSERT( !subprocess_alive( &m_subProcess ) );
         }
 
         inline CompilationRequest* GetRequest() const { return m_pRequest; }
@@ -46,55 +37,24 @@ namespace EE::Resource
             if ( !m_context.m_isExiting && !m_pRequest->IsComplete() )
             {
                 EE_ASSERT( !m_pRequest->m_compilerArgs.empty() );
-                char const* processCommandLineArgs[6] = { m_context.m_compilerExecutablePath.c_str(), "-compile", m_pRequest->m_compilerArgs.c_str(), nullptr, nullptr, nullptr };
-
-                // Set force compilation flag
-                if ( m_pRequest->RequiresForcedRecompiliation() )
-                {
-                    processCommandLineArgs[3] = "-force";
-                }
 
-                // Set package flag for packing request
-                if ( m_pRequest->m_origin == CompilationRequest::Origin::Package )
-                {
-                    processCommandLineArgs[3] = "-package";
-                }
+                // Packaging requests are never forced since they compile into a separate directory
+                bool const isForPackagedBuild = m_pRequest->m_origin == CompilationRequest::Origin::Package;
+                bool const isForced = m_pRequest->RequiresForcedRecompiliation() && !isForPackagedBuild;
 
-                // Start compiler process
+                // Compile on a persistent compiler worker
                 //-------------------------------------------------------------------------
 
                 m_pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
 
-                int32_t result = subprocess_create( processCommandLineArgs, subprocess_option_combined_stdout_stderr | subprocess_option_inherit_environment | subprocess_option_no_window, &m_subProcess );
-                if ( result != 0 )
-                {
-                    m_pRequest->m_status = CompilationRequest::Status::Failed;
-                    m_pRequest->m_log = "Resource compiler failed to start!";
-                    m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-                    return;
-                }
+                CompilationResult compilationResult = CompilationResult::Failure;
+                m_context.m_pCompilerWorkerPool->Compile( m_pRequest->m_compilerArgs.c_str(), isForced, isForPackagedBuild, compilationResult, m_pRequest->m_log );
 
-                // Wait for compilation to complete
-                //-------------------------------------------------------------------------
-
-                int32_t exitCode;
-                result = subprocess_join( &m_subProcess, &exitCode );
-                if ( result != 0 )
-                {
-                    m_pRequest->m_status = CompilationRequest::Status::Failed;
-                    m_pRequest->m_log = "Resource compiler failed to complete!";
-                    m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-                    subprocess_destroy( &m_subProcess );
-                    return;
-                }
+                m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
 
                 // Handle completed compilation
                 //-------------------------------------------------------------------------
 
-                m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
-
-                CompilationResult const compilationResult = (CompilationResult) exitCode;
-
                 switch ( compilationResult )
                 {
                     case CompilationResult::SuccessUpToDate:
@@ -121,19 +81,6 @@ namespace EE::Resource
                     }
                     break;
                 }
-
-                // Read error and output of process
-                //-------------------------------------------------------------------------
-
-                char readBuffer[512];
-                while ( fgets( readBuffer, 512, subprocess_stdout( &m_subProcess ) ) )
-                {
-                    m_pRequest->m_log += readBuffer;
-                }
-
-                //-------------------------------------------------------------------------
-
-                subprocess_destroy( &m_subProcess );
             }
 
             //-------------------------------------------------------------------------
@@ -146,7 +93,6 @@ namespace EE::Resource
         ResourceServerContext const&                        m_context;
         Threading::LockFreeQueue<CompilationTask*>&         m_completedTaskQueue;
         CompilationRequest*                                 m_pRequest = nullptr;
-        subprocess_s                                        m_subProcess;
     };
 
     //-------------------------------------------------------------------------
@@ -271,6 +217,9 @@ namespace EE::Resource
         m_context.m_compilerExecutablePath = m_settings.m_resourceCompilerExecutablePath;
         m_context.m_pTypeRegistry = &m_typeRegistry;
         m_context.m_pCompilerRegistry = m_pCompilerRegistry;
+        m_context.m_pCompilerWorkerPool = &m_compilerWorkerPool;
+
+        m_compilerWorkerPool.Initialize( m_settings.m_resourceCompilerExecutablePath );
 
         // Packaging
         //-------------------------------------------------------------------------
@@ -290,6 +239,7 @@ namespace EE::Resource
         m_taskSystem.WaitForAll();
         ProcessCompletedRequests();
         m_taskSystem.Shutdown();
+        m_compilerWorkerPool.Shutdown();
 
         EE_ASSERT( m_numScheduledTasks == 0 );
 
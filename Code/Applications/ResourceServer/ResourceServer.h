@@ -2,6 +2,7 @@
 
 #include "ResourceServerContext.h"
 #include "ResourceCompilationRequest.h"
+#include "ResourceCompilerWorkerPool.h"
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
 #include "System/Network/IPC/IPCMessageServer.h"
 #include "System/Resource/ResourceSettings.h"
@@ -145,6 +146,7 @@ namespace EE::Resource
 
         // Workers
         ResourceServerContext                                       m_context;
+        CompilerWorkerPool                                          m_compilerWorkerPool;
 
         // Packaging
         TVector<ResourceID>                                         m_allMaps;
@@ -7,7 +7,7 @@ namespace EE::Resource
 {
     bool ResourceServerContext::IsValid() const
     {
-        if ( m_pCompilerRegistry == nullptr || m_pTypeRegistry == nullptr )
+        if ( m_pCompilerRegistry == nullptr || m_pTypeRegistry == nullptr || m_pCompilerWorkerPool == nullptr )
         {
             return false;
         }
@@ -5,6 +5,10 @@
 
 namespace EE::Resource
 {
+    class CompilerWorkerPool;
+
+    //-------------------------------------------------------------------------
+
     struct ResourceServerContext
     {
         bool IsValid() const;
@@ -16,6 +20,7 @@ namespace EE::Resource
         FileSystem::Path                        m_compilerExecutablePath;
         TypeSystem::TypeRegistry const*         m_pTypeRegistry = nullptr;
         CompilerRegistry const*                 m_pCompilerRegistry = nullptr;
+        CompilerWorkerPool*                     m_pCompilerWorkerPool = nullptr;
 
         // Set when we shutdown the server to skip processing of any scheduled tasks
         bool                                    m_isExiting = false;
@@ -0,0 +1,197 @@
+#include "Benchmark_AABBTree.h"
+#include "System/Math/AABBTree.h"
+#include "System/Math/QuadAABBTree.h"
+#include "System/Math/MathRandom.h"
+#include "System/Time/Timers.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmarks
+{
+    static AABB GenerateBox( Math::RNG const& rng, AABBTreeBenchmarkSettings const& settings, float maxSize )
+    {
+        float const halfWorldSize = settings.m_worldSize / 2;
+        Vector const center( rng.GetFloat( -halfWorldSize, halfWorldSize ), rng.GetFloat( -halfWorldSize, halfWorldSize ), rng.GetFloat( -halfWorldSize, halfWorldSize ) );
+        Vector const extents( rng.GetFloat( 0.1f, maxSize ), rng.GetFloat( 0.1f, maxSize ), rng.GetFloat( 0.1f, maxSize ), 0.0f );
+        return AABB( center, extents );
+    }
+
+    template<typename Function>
+    static Milliseconds Time( Function&& function )
+    {
+        Timer<PlatformClock> timer;
+        function();
+        return timer.GetElapsedTimeMilliseconds();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RunAABBTreeBenchmark( AABBTreeBenchmarkSettings const& settings )
+    {
+        EE_ASSERT( settings.m_numBoxes > 0 && settings.m_numQueries > 0 );
+
+        Math::RNG rng( settings.m_seed );
+
+        // Generate all data up front so that both trees get the exact same inputs
+        //-------------------------------------------------------------------------
+
+        TVector<AABB> boxes;
+        TVector<AABB> movedBoxes;
+        TVector<uint64_t> userData;
+        for ( int32_t i = 0; i < settings.m_numBoxes; i++ )
+        {
+            boxes.emplace_back( GenerateBox( rng, settings, settings.m_maxBoxSize ) );
+            userData.emplace_back( uint64_t( i + 1 ) );
+
+            // Small moves, the kind of thing we'd get from moving objects frame to frame
+            AABB moved = boxes.back();
+            moved.Translate( Vector( rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), 0 ) );
+            movedBoxes.emplace_back( moved );
+        }
+
+        TVector<AABB> queries;
+        for ( int32_t i = 0; i < settings.m_numQueries; i++ )
+        {
+            queries.emplace_back( GenerateBox( rng, settings, settings.m_querySize ) );
+        }
+
+        TVector<uint64_t> results;
+        uint64_t binaryNumResults = 0;
+        uint64_t quadNumResults = 0;
+        uint64_t quadBuildNumResults = 0;
+
+        // Binary Tree
+        //-------------------------------------------------------------------------
+
+        Math::AABBTree binaryTree;
+
+        Milliseconds const binaryInsertTime = Time( [&] ()
+        {
+            for ( int32_t i = 0; i < settings.m_numBoxes; i++ )
+            {
+                binaryTree.InsertBox( boxes[i], userData[i] );
+            }
+        } );
+
+        Milliseconds const binaryQueryTime = Time( [&] ()
+        {
+            for ( AABB const& query : queries )
+            {
+                binaryTree.FindOverlaps( query, results );
+                binaryNumResults += results.size();
+            }
+        } );
+
+        // The binary tree has no refit so moved boxes need to be reinserted
+        Milliseconds const binaryRefitTime = Time( [&] ()
+        {
+            for ( int32_t i = 0; i < settings.m_numBoxes; i++ )
+            {
+                binaryTree.RemoveBox( userData[i] );
+                binaryTree.InsertBox( movedBoxes[i], userData[i] );
+            }
+        } );
+
+        Milliseconds const binaryRemoveTime = Time( [&] ()
+        {
+            for ( int32_t i = 0; i < settings.m_numBoxes; i++ )
+            {
+                binaryTree.RemoveBox( userData[i] );
+            }
+        } );
+
+        // Quad Tree - incremental
+        //-------------------------------------------------------------------------
+
+        Math::QuadAABBTree quadTree;
+
+        Milliseconds const quadInsertTime = Time( [&] ()
+        {
+            for ( int32_t i = 0; i < settings.m_numBoxes; i++ )
+            {
+                quadTree.InsertBox( boxes[i], userData[i] );
+            }
+        } );
+
+        Milliseconds const quadQueryTime = Time( [&] ()
+        {
+            for ( AABB const& query : queries )
+            {
+                quadTree.FindOverlaps( query, results );
+                quadNumResults += results.size();
+            }
+        } );
+
+        Milliseconds const quadUpdateTime = Time( [&] ()
+        {
+            for ( int32_t i = 0; i < settings.m_numBoxes; i++ )
+            {
+                quadTree.UpdateBox( userData[i], movedBoxes[i] );
+            }
+        } );
+
+        Milliseconds const quadRemoveTime = Time( [&] ()
+        {
+            for ( int32_t i = 0; i < settings.m_numBoxes; i++ )
+            {
+                quadTree.RemoveBox( userData[i] );
+            }
+        } );
+
+        // Quad Tree - bulk build and refit
+        //-------------------------------------------------------------------------
+
+        Milliseconds const quadBuildTime = Time( [&] ()
+        {
+            quadTree.Build( boxes, userData );
+        } );
+
+        Milliseconds const quadBuildQueryTime = Time( [&] ()
+        {
+            for ( AABB const& query : queries )
+            {
+                quadTree.FindOverlaps( query, results );
+                quadBuildNumResults += results.size();
+            }
+        } );
+
+        Milliseconds const quadRefitTime = Time( [&] ()
+        {
+            for ( int32_t i = 0; i < settings.m_numBoxes; i++ )
+            {
+                quadTree.SetBoxBounds( userData[i], movedBoxes[i] );
+            }
+            quadTree.Refit();
+        } );
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        auto PrintResult = [&] ( char const* pLabel, Milliseconds time, int32_t numOperations )
+        {
+            float const nanosecondsPerOperation = ( time.ToFloat() * 1000000.0f ) / numOperations;
+            std::cout << "  " << pLabel << ": " << time.ToFloat() << "ms total, " << nanosecondsPerOperation << "ns per operation" << std::endl;
+        };
+
+        std::cout << "AABB Tree Benchmark - " << settings.m_numBoxes << " boxes, " << settings.m_numQueries << " queries" << std::endl;
+        std::cout << " Binary Tree" << std::endl;
+        PrintResult( "Insert            ", binaryInsertTime, settings.m_numBoxes );
+        PrintResult( "Query             ", binaryQueryTime, settings.m_numQueries );
+        PrintResult( "Refit (Reinsert)  ", binaryRefitTime, settings.m_numBoxes );
+        PrintResult( "Remove            ", binaryRemoveTime, settings.m_numBoxes );
+        std::cout << " Quad Tree" << std::endl;
+        PrintResult( "Insert            ", quadInsertTime, settings.m_numBoxes );
+        PrintResult( "Query             ", quadQueryTime, settings.m_numQueries );
+        PrintResult( "Update            ", quadUpdateTime, settings.m_numBoxes );
+        PrintResult( "Remove            ", quadRemoveTime, settings.m_numBoxes );
+        PrintResult( "SAH Build         ", quadBuildTime, settings.m_numBoxes );
+        PrintResult( "Query (SAH Build) ", quadBuildQueryTime, settings.m_numQueries );
+        PrintResult( "Refit             ", quadRefitTime, settings.m_numBoxes );
+
+        if ( binaryNumResults != quadNumResults || binaryNumResults != quadBuildNumResults )
+        {
+            std::cout << "  Query results differ - binary: " << binaryNumResults << ", quad: " << quadNumResults << ", quad (SAH build): " << quadBuildNumResults << std::endl;
+        }
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "System/Esoterica.h"
+
+//-------------------------------------------------------------------------
+// AABB Tree Micro-benchmark
+//-------------------------------------------------------------------------
+// Compares the binary AABB tree against the 4-wide quad tree for insert, remove, refit and query throughput using random boxes
+
+namespace EE::Benchmarks
+{
+    struct AABBTreeBenchmarkSettings
+    {
+        int32_t     m_numBoxes = 10000;
+        int32_t     m_numQueries = 5000;
+        float       m_worldSize = 1000.0f;
+        float       m_maxBoxSize = 10.0f;
+        float       m_querySize = 50.0f;
+        uint32_t    m_seed = 1234;
+    };
+
+    void RunAABBTreeBenchmark( AABBTreeBenchmarkSettings const& settings = AABBTreeBenchmarkSettings() );
+}
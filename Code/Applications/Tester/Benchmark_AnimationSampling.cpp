@@ -0,0 +1,263 @@
+#include "Benchmark_AnimationSampling.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/AnimationSoA.h"
+#include "System/Math/MathRandom.h"
+#include "System/Time/Timers.h"
+#include <iostream>
+
+//-------------------------------------------------------------------------
+
+using namespace EE::Animation;
+
+//-------------------------------------------------------------------------
+
+namespace EE::Benchmarks
+{
+    // Synthetic compressed track data laid out exactly as the clip compiler would write it (fully animated tracks)
+    struct SyntheticTrackData
+    {
+        CompressedTrackData GetTrackData() const { return CompressedTrackData{ m_data.data(), m_settings.data(), (int32_t) m_settings.size(), m_numFrames }; }
+
+        TVector<uint16_t>                   m_data;
+        TVector<TrackCompressionSettings>   m_settings;
+        uint32_t                            m_numFrames = 0;
+    };
+
+    static QuantizationRange CalculateRange( TVector<float> const& values )
+    {
+        float minValue = FLT_MAX;
+        float maxValue = -FLT_MAX;
+        for ( float v : values )
+        {
+            minValue = Math::Min( minValue, v );
+            maxValue = Math::Max( maxValue, v );
+        }
+
+        // Ensure we never have a zero length range
+        return QuantizationRange( minValue, Math::Max( maxValue - minValue, 0.001f ) );
+    }
+
+    static void GenerateTrackData( Math::RNG const& rng, int32_t numBones, uint32_t numFrames, SyntheticTrackData& out )
+    {
+        out.m_numFrames = numFrames;
+        out.m_settings.resize( numBones );
+
+        TVector<float> values[4];
+        for ( auto& v : values )
+        {
+            v.resize( numFrames );
+        }
+
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            TrackCompressionSettings& settings = out.m_settings[boneIdx];
+            settings.m_trackStartIndex = (uint32_t) out.m_data.size();
+
+            // Rotation - smooth rotation around a random axis
+            //-------------------------------------------------------------------------
+
+            Vector const axis = Vector( rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), 0 ).GetNormalized3();
+            float const startAngle = rng.GetFloat( -Math::Pi, Math::Pi );
+            float const angleDelta = rng.GetFloat( -0.1f, 0.1f );
+
+            for ( uint32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                Quaternion const rotation( axis, Radians( startAngle + angleDelta * frameIdx ) );
+                Quantization::EncodedQuaternion const encoded( rotation.GetNormalized() );
+                out.m_data.emplace_back( encoded.GetData0() );
+                out.m_data.emplace_back( encoded.GetData1() );
+                out.m_data.emplace_back( encoded.GetData2() );
+            }
+
+            // Translation and scale
+            //-------------------------------------------------------------------------
+
+            Float3 const offset( rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ) );
+            float const frequency = rng.GetFloat( 0.05f, 0.5f );
+
+            for ( uint32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                float const t = frequency * frameIdx;
+                values[0][frameIdx] = offset.m_x + 0.1f * Math::Sin( t );
+                values[1][frameIdx] = offset.m_y + 0.1f * Math::Cos( t );
+                values[2][frameIdx] = offset.m_z + 0.05f * Math::Sin( 2 * t );
+                values[3][frameIdx] = 1.0f + 0.01f * Math::Cos( t );
+            }
+
+            settings.m_translationRangeX = CalculateRange( values[0] );
+            settings.m_translationRangeY = CalculateRange( values[1] );
+            settings.m_translationRangeZ = CalculateRange( values[2] );
+            settings.m_scaleRange = CalculateRange( values[3] );
+
+            QuantizationRange const* translationRanges[3] = { &settings.m_translationRangeX, &settings.m_translationRangeY, &settings.m_translationRangeZ };
+            for ( uint32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                for ( int32_t i = 0; i < 3; i++ )
+                {
+                    out.m_data.emplace_back( Quantization::EncodeFloat( values[i][frameIdx], translationRanges[i]->m_rangeStart, translationRanges[i]->m_rangeLength ) );
+                }
+            }
+
+            for ( uint32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                out.m_data.emplace_back( Quantization::EncodeFloat( values[3][frameIdx], settings.m_scaleRange.m_rangeStart, settings.m_scaleRange.m_rangeLength ) );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename Function>
+    static Milliseconds TimeSampling( TVector<FrameTime> const& sampleTimes, Function&& function )
+    {
+        Timer<PlatformClock> timer;
+        for ( FrameTime const& frameTime : sampleTimes )
+        {
+            function( frameTime );
+        }
+        return timer.GetElapsedTimeMilliseconds();
+    }
+
+    // Compare the vectorized nlerp blend kernel (used by the local pose blends) against a reference scalar slerp over random rotation pairs and blend weights
+    static void RunBlendAccuracyCheck( Math::RNG const& rng, int32_t numSamples )
+    {
+        EE_ASSERT( numSamples > 0 );
+
+        int32_t const numLanes = SoATransformBuffer::GetPaddedCount( numSamples ) / SoATransformBuffer::s_laneWidth;
+        int32_t const numTransforms = numLanes * SoATransformBuffer::s_laneWidth;
+
+        TVector<Transform> sourceTransforms( numTransforms );
+        TVector<Transform> targetTransforms( numTransforms );
+        TVector<float> weights( numTransforms );
+        TVector<Transform> slerpResults( numTransforms );
+        TVector<Transform> nlerpResults( numTransforms );
+
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            Vector const sourceAxis = Vector( rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), 0 ).GetNormalized3();
+            Vector const targetAxis = Vector( rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), 0 ).GetNormalized3();
+            Quaternion const sourceRotation( sourceAxis, Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ) );
+            Quaternion const targetRotation( targetAxis, Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ) );
+
+            sourceTransforms[i] = Transform( sourceRotation.GetNormalized(), Vector( rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ) ) );
+            targetTransforms[i] = Transform( targetRotation.GetNormalized(), Vector( rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ), rng.GetFloat( -1, 1 ) ) );
+            weights[i] = rng.GetFloat( 0.0f, 1.0f );
+        }
+
+        // Time
+        //-------------------------------------------------------------------------
+
+        Timer<PlatformClock> timer;
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            slerpResults[i] = Transform::Slerp( sourceTransforms[i], targetTransforms[i], weights[i] );
+        }
+        Milliseconds const slerpTime = timer.GetElapsedTimeMilliseconds();
+
+        timer.Start();
+        TransformLanes source, target, result;
+        for ( int32_t laneIdx = 0; laneIdx < numLanes; laneIdx++ )
+        {
+            int32_t const firstIdx = laneIdx * SoATransformBuffer::s_laneWidth;
+            LoadTransformLanes( sourceTransforms.data() + firstIdx, SoATransformBuffer::s_laneWidth, source );
+            LoadTransformLanes( targetTransforms.data() + firstIdx, SoATransformBuffer::s_laneWidth, target );
+            InterpolateTransformLanes( source, target, _mm_loadu_ps( weights.data() + firstIdx ), result );
+            StoreTransformLanes( result, nlerpResults.data() + firstIdx, SoATransformBuffer::s_laneWidth );
+        }
+        Milliseconds const nlerpTime = timer.GetElapsedTimeMilliseconds();
+
+        // Measure
+        //-------------------------------------------------------------------------
+
+        float maxError = 0.0f;
+        double totalError = 0.0;
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            float const error = (float) Quaternion::Distance( slerpResults[i].GetRotation(), nlerpResults[i].GetRotation() );
+            maxError = Math::Max( maxError, error );
+            totalError += error;
+        }
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        std::cout << "Pose Blend Accuracy - " << numTransforms << " random rotation pairs" << std::endl;
+        std::cout << "  Scalar slerp: " << slerpTime.ToFloat() << "ms, SIMD nlerp: " << nlerpTime.ToFloat() << "ms" << std::endl;
+        std::cout << "  NLerp error vs slerp - max: " << maxError << " rad (" << Math::RadiansToDegrees * maxError << " deg), avg: " << ( totalError / numTransforms ) << " rad" << std::endl;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RunAnimationSamplingBenchmark( AnimationSamplingBenchmarkSettings const& settings )
+    {
+        EE_ASSERT( settings.m_numBones > 0 && settings.m_numFrames > 1 && settings.m_numIterations > 0 );
+
+        Math::RNG rng( settings.m_seed );
+
+        SyntheticTrackData syntheticData;
+        GenerateTrackData( rng, settings.m_numBones, settings.m_numFrames, syntheticData );
+        CompressedTrackData const trackData = syntheticData.GetTrackData();
+
+        // Generate the sample times up front so that all decoders sample the exact same times
+        TVector<FrameTime> sampleTimes;
+        sampleTimes.reserve( settings.m_numIterations );
+        for ( int32_t i = 0; i < settings.m_numIterations; i++ )
+        {
+            uint32_t const frameIdx = rng.GetUInt( 0, settings.m_numFrames - 2 );
+            sampleTimes.emplace_back( frameIdx, Percentage( rng.GetFloat( 0.01f, 0.99f ) ) );
+        }
+
+        TVector<Transform> scalarTransforms( settings.m_numBones );
+        TVector<Transform> simdTransforms( settings.m_numBones );
+        SoATransformBuffer soaTransforms( settings.m_numBones );
+
+        // Validate
+        //-------------------------------------------------------------------------
+
+        float maxRotationError = 0.0f;
+        float maxTranslationError = 0.0f;
+        float maxScaleError = 0.0f;
+
+        for ( int32_t i = 0; i < Math::Min( settings.m_numIterations, 100 ); i++ )
+        {
+            AnimationClip::DecodePoseScalar( trackData, sampleTimes[i], scalarTransforms.data() );
+            AnimationClip::DecodePose( trackData, sampleTimes[i], simdTransforms.data() );
+
+            for ( int32_t boneIdx = 0; boneIdx < settings.m_numBones; boneIdx++ )
+            {
+                Transform const& expected = scalarTransforms[boneIdx];
+                Transform const& actual = simdTransforms[boneIdx];
+                maxRotationError = Math::Max( maxRotationError, (float) Quaternion::Distance( expected.GetRotation(), actual.GetRotation() ) );
+                maxTranslationError = Math::Max( maxTranslationError, expected.GetTranslation().GetDistance3( actual.GetTranslation() ) );
+                maxScaleError = Math::Max( maxScaleError, Math::Abs( expected.GetScale() - actual.GetScale() ) );
+            }
+        }
+
+        // Time
+        //-------------------------------------------------------------------------
+
+        Milliseconds const scalarTime = TimeSampling( sampleTimes, [&] ( FrameTime const& frameTime ) { AnimationClip::DecodePoseScalar( trackData, frameTime, scalarTransforms.data() ); } );
+        Milliseconds const simdTime = TimeSampling( sampleTimes, [&] ( FrameTime const& frameTime ) { AnimationClip::DecodePose( trackData, frameTime, simdTransforms.data() ); } );
+        Milliseconds const soaTime = TimeSampling( sampleTimes, [&] ( FrameTime const& frameTime ) { AnimationClip::DecodePose( trackData, frameTime, soaTransforms ); } );
+
+        // Report
+        //-------------------------------------------------------------------------
+
+        auto PrintResult = [&] ( char const* pLabel, Milliseconds time )
+        {
+            float const microsecondsPerPose = ( time.ToFloat() * 1000.0f ) / settings.m_numIterations;
+            float const speedup = scalarTime.ToFloat() / Math::Max( time.ToFloat(), Math::Epsilon );
+            std::cout << "  " << pLabel << ": " << time.ToFloat() << "ms total, " << microsecondsPerPose << "us per pose, " << speedup << "x" << std::endl;
+        };
+
+        std::cout << "Animation Sampling Benchmark - " << settings.m_numBones << " bones, " << settings.m_numFrames << " frames, " << settings.m_numIterations << " samples" << std::endl;
+        PrintResult( "Scalar     ", scalarTime );
+        PrintResult( "SIMD (AoS) ", simdTime );
+        PrintResult( "SIMD (SoA) ", soaTime );
+        std::cout << "  Max error vs scalar - rotation: " << maxRotationError << " rad, translation: " << maxTranslationError << ", scale: " << maxScaleError << std::endl;
+
+        //-------------------------------------------------------------------------
+
+        RunBlendAccuracyCheck( rng, settings.m_numBlendSamples );
+    }
+}
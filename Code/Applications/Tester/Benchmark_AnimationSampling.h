@@ -0,0 +1,23 @@
+#pragma once
+
+#include "System/Esoterica.h"
+
+//-------------------------------------------------------------------------
+// Animation Sampling Micro-benchmark
+//-------------------------------------------------------------------------
+// Compares the reference scalar clip decoder against the vectorized decoders (AoS and SoA outputs) using synthetic track data
+// Also measures the error the vectorized pose blend kernels introduce by using a normalized lerp instead of a slerp for rotations
+
+namespace EE::Benchmarks
+{
+    struct AnimationSamplingBenchmarkSettings
+    {
+        int32_t     m_numBones = 150;
+        uint32_t    m_numFrames = 90;
+        int32_t     m_numIterations = 20000;
+        int32_t     m_numBlendSamples = 100000;
+        uint32_t    m_seed = 1234;
+    };
+
+    void RunAnimationSamplingBenchmark( AnimationSamplingBenchmarkSettings const& settings = AnimationSamplingBenchmarkSettings() );
+}
@@ -1,9 +1,12 @@
+#include "Benchmark_AnimationSampling.h"
+#include "Benchmark_AABBTree.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "System/Application/ApplicationGlobalState.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/Serialization/BinarySerialization.h"
 #include "System/Math/NumericRange.h"
 #include "System/Types/Event.h"
+#include "System/ThirdParty/cmdParser/cmdParser.h"
 
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 
@@ -99,6 +102,24 @@ struct Wah : public Bar
 
 int main( int argc, char *argv[] )
 {
+    // Read CMD line arguments
+    //-------------------------------------------------------------------------
+
+    cli::Parser cmdParser( argc, argv );
+    cmdParser.set_default<bool>( false );
+    cmdParser.set_optional<bool>( "benchmarkAnimSampling", "benchmarkAnimSampling", false, "Run the animation sampling and blending benchmark." );
+    cmdParser.set_optional<bool>( "benchmarkAABBTree", "benchmarkAABBTree", false, "Run the AABB tree query benchmark." );
+
+    if ( !cmdParser.run() )
+    {
+        return 1;
+    }
+
+    bool const runAnimationSamplingBenchmark = cmdParser.get<bool>( "benchmarkAnimSampling" );
+    bool const runAABBTreeBenchmark = cmdParser.get<bool>( "benchmarkAABBTree" );
+
+    //-------------------------------------------------------------------------
+
     {
         EE::ApplicationGlobalState State;
         TypeSystem::TypeRegistry typeRegistry;
@@ -106,6 +127,18 @@ int main( int argc, char *argv[] )
 
         //-------------------------------------------------------------------------
 
+        if ( runAnimationSamplingBenchmark )
+        {
+            Benchmarks::RunAnimationSamplingBenchmark();
+        }
+
+        if ( runAABBTreeBenchmark )
+        {
+            Benchmarks::RunAABBTreeBenchmark();
+        }
+
+        //-------------------------------------------------------------------------
+
         Vector v;
         v.SetX( 1 );
         v.SetY( 2 );
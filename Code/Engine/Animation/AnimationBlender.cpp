@@ -39,23 +39,16 @@ namespace EE::Animation
         }
         else // Blend
         {
-            int32_t const numBones = pResultPose->GetNumBones();
-            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
-            {
-                Transform const& sourceTransform = pSourcePose->GetTransform( boneIdx );
-                Transform const& targetTransform = pTargetPose->GetTransform( boneIdx );
-
-                // Blend translations
-                Vector const translation = Blender::BlendTranslation( sourceTransform.GetTranslation(), targetTransform.GetTranslation(), blendWeight );
-                pResultPose->SetTranslation( boneIdx, translation );
+            __m128 const weights = _mm_set1_ps( blendWeight );
+            TransformLanes source, target, result;
 
-                // Blend scales
-                float const scale = Blender::BlendScale( sourceTransform.GetScale(), targetTransform.GetScale(), blendWeight );
-                pResultPose->SetScale( boneIdx, scale );
-
-                // Blend rotations
-                Quaternion const rotation = Blender::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), blendWeight );
-                pResultPose->SetRotation( boneIdx, rotation );
+            int32_t const numLanes = pResultPose->GetNumLanes();
+            for ( int32_t laneIdx = 0; laneIdx < numLanes; laneIdx++ )
+            {
+                pSourcePose->LoadLanes( laneIdx, source );
+                pTargetPose->LoadLanes( laneIdx, target );
+                Blender::BlendLanes( source, target, weights, result );
+                pResultPose->StoreLanes( laneIdx, result );
             }
         }
     }
@@ -69,42 +62,55 @@ namespace EE::Animation
         EE_ASSERT( pBoneMask != nullptr );
         EE_ASSERT( pBoneMask->GetNumWeights() == pSourcePose->GetSkeleton()->GetNumBones() );
 
-        int32_t const numBones = pResultPose->GetNumBones();
-        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        // Copy the bone weights into a padded buffer so we can always load full lanes, only the bones active at the current LOD are blended
+        int32_t const numBones = pResultPose->GetNumActiveBones();
+        int32_t const numLanes = pResultPose->GetNumLanes();
+        auto pBoneWeights = EE_STACK_ARRAY_ALLOC( float, numLanes * SoATransformBuffer::s_laneWidth );
+        memcpy( pBoneWeights, pBoneMask->GetWeights().data(), sizeof( float ) * numBones );
+        for ( int32_t i = numBones; i < numLanes * SoATransformBuffer::s_laneWidth; i++ )
         {
-            // If the bone has been masked out
-            float const boneBlendWeight = blendWeight * pBoneMask->GetWeight( boneIdx );
-            if ( boneBlendWeight == 0.0f )
-            { 
-                pResultPose->SetTransform( boneIdx, pSourcePose->GetTransform( boneIdx ) );
-            }
-            else if ( canFullyOptimizeBlend && boneBlendWeight == 1.0f )
+            pBoneWeights[i] = 0.0f;
+        }
+
+        //-------------------------------------------------------------------------
+
+        __m128 const zero = _mm_setzero_ps();
+        __m128 const one = _mm_set1_ps( 1.0f );
+        __m128 const globalWeight = _mm_set1_ps( blendWeight );
+        TransformLanes source, target, result;
+
+        for ( int32_t laneIdx = 0; laneIdx < numLanes; laneIdx++ )
+        {
+            __m128 const weights = _mm_mul_ps( globalWeight, _mm_loadu_ps( pBoneWeights + ( laneIdx * SoATransformBuffer::s_laneWidth ) ) );
+
+            pSourcePose->LoadLanes( laneIdx, source );
+            pTargetPose->LoadLanes( laneIdx, target );
+            Blender::BlendLanes( source, target, weights, result );
+
+            // Masked out bones take the source transform as is, fully weighted bones take the target transform if allowed
+            __m128 const useSource = _mm_cmpeq_ps( weights, zero );
+            __m128 const useTarget = canFullyOptimizeBlend ? _mm_cmpeq_ps( weights, one ) : zero;
+
+            for ( int32_t i = 0; i < 4; i++ )
             {
-                pResultPose->SetTransform( boneIdx, pTargetPose->GetTransform( boneIdx ) );
+                result.m_rotation[i] = _mm_blendv_ps( _mm_blendv_ps( result.m_rotation[i], target.m_rotation[i], useTarget ), source.m_rotation[i], useSource );
             }
-            else // Perform Blend
-            {
-                Transform const& sourceTransform = pSourcePose->GetTransform( boneIdx );
-                Transform const& targetTransform = pTargetPose->GetTransform( boneIdx );
 
-                // Blend translations
-                Vector const translation = Blender::BlendTranslation( sourceTransform.GetTranslation(), targetTransform.GetTranslation(), boneBlendWeight );
-                pResultPose->SetTranslation( boneIdx, translation );
+            for ( int32_t i = 0; i < 3; i++ )
+            {
+                result.m_translation[i] = _mm_blendv_ps( _mm_blendv_ps( result.m_translation[i], target.m_translation[i], useTarget ), source.m_translation[i], useSource );
+            }
 
-                // Blend scales
-                float const scale = Blender::BlendScale( sourceTransform.GetScale(), targetTransform.GetScale(), boneBlendWeight );
-                pResultPose->SetScale( boneIdx, scale );
+            result.m_scale = _mm_blendv_ps( _mm_blendv_ps( result.m_scale, target.m_scale, useTarget ), source.m_scale, useSource );
 
-                // Blend rotations
-                Quaternion const rotation = Blender::BlendRotation( sourceTransform.GetRotation(), targetTransform.GetRotation(), boneBlendWeight );
-                pResultPose->SetRotation( boneIdx, rotation );
-            }
+            pResultPose->StoreLanes( laneIdx, result );
         }
     }
 
     //-------------------------------------------------------------------------
 
     // Masked Global Blend
+    // Global space blending depends on the hierarchy so this is a scalar blend
     template<typename Blender>
     void BlenderGlobal( Pose const* pSourcePose, Pose const* pTargetPose, float const blendWeight, BoneMask const* pBoneMask, Pose* pResultPose )
     {
@@ -134,7 +140,7 @@ namespace EE::Animation
         //-------------------------------------------------------------------------
 
         auto const& parentIndices = pSourcePose->GetSkeleton()->GetParentBoneIndices();
-        auto const numBones = pResultPose->GetNumBones();
+        auto const numBones = pResultPose->GetNumActiveBones();
         for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
         {
             // Use the source local pose for masked out bones
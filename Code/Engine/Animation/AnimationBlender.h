@@ -64,6 +64,12 @@ namespace EE::Animation
             {
                 return Math::Lerp( scale0, scale1, t );
             }
+
+            // Blend 4 transforms at once with per-lane weights, rotations are normalized-lerped rather than slerped
+            EE_FORCE_INLINE static void BlendLanes( TransformLanes const& source, TransformLanes const& target, __m128 t, TransformLanes& result )
+            {
+                InterpolateTransformLanes( source, target, t, result );
+            }
         };
 
         struct AdditiveBlender
@@ -83,6 +89,29 @@ namespace EE::Animation
             {
                 return scale0 + ( scale1 * t );
             }
+
+            // Blend 4 transforms at once with per-lane weights, rotations are normalized-lerped rather than slerped
+            EE_FORCE_INLINE static void BlendLanes( TransformLanes const& source, TransformLanes const& target, __m128 t, TransformLanes& result )
+            {
+                // Target rotation: quat1 * quat0
+                __m128 const* q0 = source.m_rotation;
+                __m128 const* q1 = target.m_rotation;
+
+                TransformLanes additiveTarget;
+                additiveTarget.m_rotation[0] = _mm_sub_ps( SIMD::MultiplyAdd( q0[3], q1[0], SIMD::MultiplyAdd( q0[0], q1[3], _mm_mul_ps( q0[1], q1[2] ) ) ), _mm_mul_ps( q0[2], q1[1] ) );
+                additiveTarget.m_rotation[1] = _mm_sub_ps( SIMD::MultiplyAdd( q0[3], q1[1], SIMD::MultiplyAdd( q0[1], q1[3], _mm_mul_ps( q0[2], q1[0] ) ) ), _mm_mul_ps( q0[0], q1[2] ) );
+                additiveTarget.m_rotation[2] = _mm_sub_ps( SIMD::MultiplyAdd( q0[3], q1[2], SIMD::MultiplyAdd( q0[2], q1[3], _mm_mul_ps( q0[0], q1[1] ) ) ), _mm_mul_ps( q0[1], q1[0] ) );
+                additiveTarget.m_rotation[3] = _mm_sub_ps( _mm_mul_ps( q0[3], q1[3] ), SIMD::MultiplyAdd( q0[2], q1[2], SIMD::MultiplyAdd( q0[1], q1[1], _mm_mul_ps( q0[0], q1[0] ) ) ) );
+
+                // Translation and scale: value0 + ( value1 * t )
+                for ( int32_t i = 0; i < 3; i++ )
+                {
+                    additiveTarget.m_translation[i] = _mm_add_ps( source.m_translation[i], target.m_translation[i] );
+                }
+                additiveTarget.m_scale = _mm_add_ps( source.m_scale, target.m_scale );
+
+                InterpolateTransformLanes( source, additiveTarget, t, result );
+            }
         };
 
     public:
@@ -95,6 +95,7 @@ namespace EE::Animation
         inline int32_t GetNumWeights() const { return (int32_t) m_weights.size(); }
         inline float GetWeight( uint32_t i ) const { EE_ASSERT( i < (uint32_t) m_weights.size() ); return m_weights[i]; }
         inline float operator[]( uint32_t i ) const { return GetWeight( i ); }
+        inline TVector<float> const& GetWeights() const { return m_weights; }
         BoneMask& operator*=( BoneMask const& rhs );
 
         // Set all weights to zero
@@ -1,5 +1,6 @@
 #include "AnimationClip.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "Engine/Animation/AnimationSoA.h"
 #include "System/Drawing/DebugDrawing.h"
 
 //-------------------------------------------------------------------------
@@ -16,58 +17,93 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
-        Transform boneTransform;
-        uint16_t const* pTrackData = m_compressedPoseData.data();
+        // Tracks are in skeleton order, so we only need to decode the tracks for the bones active at the pose's LOD
+        int32_t const numActiveBones = pOutPose->GetNumActiveBones();
 
-        // Read exact key frame
-        if ( frameTime.IsExactlyAtKeyFrame() )
+        if ( m_compressionFormat == CompressionFormat::KeyReduced )
         {
-            auto const numBones = m_skeleton->GetNumBones();
-            for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
-            {
-                pTrackData = ReadCompressedTrackKeyFrame( pTrackData, m_trackCompressionSettings[boneIdx], frameTime.GetFrameIndex(), boneTransform );
-                pOutPose->m_localTransforms[boneIdx] = boneTransform;
-            }
+            EE_ASSERT( m_keyReducedTrackSettings.size() == m_skeleton->GetNumBones() );
+
+            KeyReducedTrackData trackData = GetKeyReducedTrackData();
+            trackData.m_numTracks = numActiveBones;
+
+            DecodeKeyReducedPose( trackData, frameTime, pOutPose->m_localTransforms.data() );
         }
-        else // Read interpolated anim pose
+        else
         {
-            auto const numBones = m_skeleton->GetNumBones();
-            for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
-            {
-                pTrackData = ReadCompressedTrackTransform( pTrackData, m_trackCompressionSettings[boneIdx], frameTime, boneTransform );
-                pOutPose->m_localTransforms[boneIdx] = boneTransform;
-            }
+            EE_ASSERT( m_trackCompressionSettings.size() == m_skeleton->GetNumBones() );
+
+            CompressedTrackData trackData = GetCompressedTrackData();
+            trackData.m_numTracks = numActiveBones;
+
+            DecodePose( trackData, frameTime, pOutPose->m_localTransforms.data() );
         }
 
         // Flag the pose as being set
         pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::Pose;
     }
 
-    Transform AnimationClip::GetLocalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const
+    void AnimationClip::GetPose( FrameTime const& frameTime, SoATransformBuffer& outTransforms ) const
     {
-        EE_ASSERT( IsValid() && m_skeleton->IsValidBoneIndex( boneIdx ) );
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
 
-        uint32_t frameIdx = frameTime.GetFrameIndex();
-        EE_ASSERT( frameIdx < m_numFrames );
+        if ( m_compressionFormat == CompressionFormat::KeyReduced )
+        {
+            KeyReducedTrackData const trackData = GetKeyReducedTrackData();
+            if ( outTransforms.GetNumTransforms() != trackData.m_numTracks )
+            {
+                outTransforms.Resize( trackData.m_numTracks );
+            }
 
-        //-------------------------------------------------------------------------
+            for ( int32_t trackIdx = 0; trackIdx < trackData.m_numTracks; trackIdx++ )
+            {
+                outTransforms.SetTransform( trackIdx, DecodeKeyReducedTrack( trackData, trackIdx, frameTime ) );
+            }
+        }
+        else
+        {
+            DecodePose( GetCompressedTrackData(), frameTime, outTransforms );
+        }
+    }
 
-        auto const& trackSettings = m_trackCompressionSettings[boneIdx];
-        uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
+    size_t AnimationClip::GetCompressedPoseDataSize() const
+    {
+        if ( m_compressionFormat == CompressionFormat::KeyReduced )
+        {
+            return ( m_keyReducedData.size() * sizeof( uint32_t ) ) + ( m_keyFrameTimes.size() * sizeof( uint16_t ) ) + ( m_keyReducedTrackSettings.size() * sizeof( KeyReducedTrackSettings ) );
+        }
 
-        //-------------------------------------------------------------------------
+        return ( m_compressedPoseData.size() * sizeof( uint16_t ) ) + ( m_trackCompressionSettings.size() * sizeof( TrackCompressionSettings ) );
+    }
 
-        Transform boneLocalTransform;
+    Transform AnimationClip::GetTrackTransform( int32_t trackIdx, FrameTime const& frameTime ) const
+    {
+        if ( m_compressionFormat == CompressionFormat::KeyReduced )
+        {
+            return DecodeKeyReducedTrack( GetKeyReducedTrackData(), trackIdx, frameTime );
+        }
 
+        auto const& trackSettings = m_trackCompressionSettings[trackIdx];
+        uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
+
+        Transform trackTransform;
         if ( frameTime.IsExactlyAtKeyFrame() )
         {
-            ReadCompressedTrackKeyFrame( pTrackData, trackSettings, frameIdx, boneLocalTransform );
+            ReadCompressedTrackKeyFrame( pTrackData, trackSettings, m_numFrames, frameTime.GetFrameIndex(), trackTransform );
         }
         else
         {
-            ReadCompressedTrackTransform( pTrackData, trackSettings, frameTime, boneLocalTransform );
+            ReadCompressedTrackTransform( pTrackData, trackSettings, m_numFrames, frameTime, trackTransform );
         }
-        return boneLocalTransform;
+        return trackTransform;
+    }
+
+    Transform AnimationClip::GetLocalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const
+    {
+        EE_ASSERT( IsValid() && m_skeleton->IsValidBoneIndex( boneIdx ) );
+        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
+        return GetTrackTransform( boneIdx, frameTime );
     }
 
     Transform AnimationClip::GetGlobalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const
@@ -93,51 +129,370 @@ namespace EE::Animation
         // Calculate the global transform
         //-------------------------------------------------------------------------
 
-        Transform globalTransform;
+        // Read root transform
+        Transform globalTransform = GetTrackTransform( boneHierarchy.back(), frameTime );
 
-        if ( frameTime.IsExactlyAtKeyFrame() )
+        // Read and multiply out all the transforms moving down the hierarchy
+        for ( int32_t i = (int32_t) boneHierarchy.size() - 2; i >= 0; i-- )
+        {
+            globalTransform = GetTrackTransform( boneHierarchy[i], frameTime ) * globalTransform;
+        }
+
+        return globalTransform;
+    }
+}
+//-------------------------------------------------------------------------
+// Decoders
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    namespace SIMDDecoding
+    {
+        constexpr static int32_t const g_laneWidth = SoATransformBuffer::s_laneWidth;
+
+        // The raw (still quantized) values for a single key-frame for a group of 4 tracks
+        struct alignas( 16 ) GatheredKeyFrame
+        {
+            int32_t     m_rotation[3][g_laneWidth];
+            int32_t     m_translation[3][g_laneWidth];
+            int32_t     m_scale[g_laneWidth];
+        };
+
+        // The quantization ranges for a group of 4 tracks, the lengths are pre-divided by the max quantized value
+        struct alignas( 16 ) GatheredRanges
+        {
+            float       m_translationStart[3][g_laneWidth];
+            float       m_translationLength[3][g_laneWidth];
+            float       m_scaleStart[g_laneWidth];
+            float       m_scaleLength[g_laneWidth];
+        };
+
+        //-------------------------------------------------------------------------
+
+        EE_FORCE_INLINE __m128 LoadQuantizedValues( int32_t const* pValues )
+        {
+            return _mm_cvtepi32_ps( _mm_load_si128( reinterpret_cast<__m128i const*>( pValues ) ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        // Gather the quantized values for a group of 4 tracks. Lanes past the end of the track list duplicate the last track so we always decode valid data.
+        template<bool ShouldInterpolate>
+        EE_FORCE_INLINE void GatherTracks( CompressedTrackData const& trackData, int32_t firstTrackIdx, uint32_t frameIdx, GatheredKeyFrame& key0, GatheredKeyFrame& key1, GatheredRanges& ranges )
+        {
+            static constexpr uint32_t const rotationStride = 3;
+            static constexpr uint32_t const translationStride = 3;
+            static constexpr uint32_t const scaleStride = 1;
+            static constexpr float const quantizationMultiplier = 1.0f / float( ( 1 << 16 ) - 1 );
+
+            uint32_t const numFrames = trackData.m_numFrames;
+
+            for ( int32_t lane = 0; lane < g_laneWidth; lane++ )
+            {
+                int32_t const trackIdx = Math::Min( firstTrackIdx + lane, trackData.m_numTracks - 1 );
+                TrackCompressionSettings const& settings = trackData.m_pTrackSettings[trackIdx];
+                uint16_t const* pTrackData = trackData.m_pData + settings.m_trackStartIndex;
+
+                // Rotation
+                //-------------------------------------------------------------------------
+
+                uint16_t const* pRotation0 = pTrackData + ( frameIdx * rotationStride );
+                key0.m_rotation[0][lane] = pRotation0[0];
+                key0.m_rotation[1][lane] = pRotation0[1];
+                key0.m_rotation[2][lane] = pRotation0[2];
+
+                if constexpr ( ShouldInterpolate )
+                {
+                    uint16_t const* pRotation1 = pRotation0 + rotationStride;
+                    key1.m_rotation[0][lane] = pRotation1[0];
+                    key1.m_rotation[1][lane] = pRotation1[1];
+                    key1.m_rotation[2][lane] = pRotation1[2];
+                }
+
+                pTrackData += ( numFrames * rotationStride );
+
+                // Translation
+                //-------------------------------------------------------------------------
+
+                uint16_t const* pTranslation0 = pTrackData;
+                uint16_t const* pTranslation1 = pTrackData;
+
+                if ( settings.IsTranslationTrackStatic() )
+                {
+                    pTrackData += translationStride;
+                }
+                else
+                {
+                    pTranslation0 += ( frameIdx * translationStride );
+                    pTranslation1 = pTranslation0 + translationStride;
+                    pTrackData += ( numFrames * translationStride );
+                }
+
+                key0.m_translation[0][lane] = pTranslation0[0];
+                key0.m_translation[1][lane] = pTranslation0[1];
+                key0.m_translation[2][lane] = pTranslation0[2];
+
+                if constexpr ( ShouldInterpolate )
+                {
+                    key1.m_translation[0][lane] = pTranslation1[0];
+                    key1.m_translation[1][lane] = pTranslation1[1];
+                    key1.m_translation[2][lane] = pTranslation1[2];
+                }
+
+                // Scale
+                //-------------------------------------------------------------------------
+
+                uint16_t const* pScale0 = pTrackData;
+                uint16_t const* pScale1 = pTrackData;
+
+                if ( !settings.IsScaleTrackStatic() )
+                {
+                    pScale0 += ( frameIdx * scaleStride );
+                    pScale1 = pScale0 + scaleStride;
+                }
+
+                key0.m_scale[lane] = pScale0[0];
+
+                if constexpr ( ShouldInterpolate )
+                {
+                    key1.m_scale[lane] = pScale1[0];
+                }
+
+                // Ranges
+                //-------------------------------------------------------------------------
+
+                ranges.m_translationStart[0][lane] = settings.m_translationRangeX.m_rangeStart;
+                ranges.m_translationStart[1][lane] = settings.m_translationRangeY.m_rangeStart;
+                ranges.m_translationStart[2][lane] = settings.m_translationRangeZ.m_rangeStart;
+                ranges.m_translationLength[0][lane] = settings.m_translationRangeX.m_rangeLength * quantizationMultiplier;
+                ranges.m_translationLength[1][lane] = settings.m_translationRangeY.m_rangeLength * quantizationMultiplier;
+                ranges.m_translationLength[2][lane] = settings.m_translationRangeZ.m_rangeLength * quantizationMultiplier;
+                ranges.m_scaleStart[lane] = settings.m_scaleRange.m_rangeStart;
+                ranges.m_scaleLength[lane] = settings.m_scaleRange.m_rangeLength * quantizationMultiplier;
+            }
+        }
+
+        // Decode a gathered key-frame, this is a SoA version of 'EncodedQuaternion::ToQuaternion' and 'Quantization::DecodeFloat'
+        EE_FORCE_INLINE void DecodeKeyFrame( GatheredKeyFrame const& key, GatheredRanges const& ranges, TransformLanes& out )
         {
-            // Read root transform
+            static constexpr float const rangeMultiplier15Bit = Quantization::EncodedQuaternion::s_valueRangeLength / float( 0x7FFF );
+
+            __m128 const zero = _mm_setzero_ps();
+            __m128 const one = _mm_set1_ps( 1.0f );
+            __m128 const rangeMin = _mm_set1_ps( Quantization::EncodedQuaternion::s_valueRangeMin );
+            __m128 const rangeMultiplier = _mm_set1_ps( rangeMultiplier15Bit );
+            __m128i const valueMask = _mm_set1_epi32( 0x7FFF );
+
+            // Rotation
+            //-------------------------------------------------------------------------
+
+            __m128i const data0 = _mm_load_si128( reinterpret_cast<__m128i const*>( key.m_rotation[0] ) );
+            __m128i const data1 = _mm_load_si128( reinterpret_cast<__m128i const*>( key.m_rotation[1] ) );
+            __m128i const data2 = _mm_load_si128( reinterpret_cast<__m128i const*>( key.m_rotation[2] ) );
+
+            __m128i const largestValueIndex = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( data0, 14 ), _mm_set1_epi32( 2 ) ), _mm_srli_epi32( data1, 15 ) );
+
+            __m128 const a = SIMD::MultiplyAdd( _mm_cvtepi32_ps( _mm_and_si128( data0, valueMask ) ), rangeMultiplier, rangeMin );
+            __m128 const b = SIMD::MultiplyAdd( _mm_cvtepi32_ps( _mm_and_si128( data1, valueMask ) ), rangeMultiplier, rangeMin );
+            __m128 const c = SIMD::MultiplyAdd( _mm_cvtepi32_ps( data2 ), rangeMultiplier, rangeMin );
+
+            __m128 const sum = SIMD::MultiplyAdd( c, c, SIMD::MultiplyAdd( b, b, _mm_mul_ps( a, a ) ) );
+            __m128 const d = _mm_sqrt_ps( _mm_max_ps( _mm_sub_ps( one, sum ), zero ) );
+
+            __m128 const isLargestX = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 0 ) ) );
+            __m128 const isLargestY = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 1 ) ) );
+            __m128 const isLargestZ = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 2 ) ) );
+            __m128 const isLargestW = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 3 ) ) );
+
+            // X:(d,a,b,c) Y:(a,d,b,c) Z:(a,b,d,c) W:(a,b,c,d)
+            out.m_rotation[0] = _mm_blendv_ps( a, d, isLargestX );
+            out.m_rotation[1] = _mm_blendv_ps( _mm_blendv_ps( b, a, isLargestX ), d, isLargestY );
+            out.m_rotation[2] = _mm_blendv_ps( _mm_blendv_ps( c, b, _mm_or_ps( isLargestX, isLargestY ) ), d, isLargestZ );
+            out.m_rotation[3] = _mm_blendv_ps( c, d, isLargestW );
+
+            // Translation and scale
+            //-------------------------------------------------------------------------
+
+            for ( int32_t i = 0; i < 3; i++ )
             {
-                auto const& trackSettings = m_trackCompressionSettings[boneHierarchy.back()];
-                uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
-                ReadCompressedTrackKeyFrame( pTrackData, trackSettings, frameIdx, globalTransform );
+                out.m_translation[i] = SIMD::MultiplyAdd( LoadQuantizedValues( key.m_translation[i] ), _mm_load_ps( ranges.m_translationLength[i] ), _mm_load_ps( ranges.m_translationStart[i] ) );
             }
 
-            // Read and multiply out all the transforms moving down the hierarchy
-            Transform localTransform;
-            for ( int32_t i = (int32_t) boneHierarchy.size() - 2; i >= 0; i-- )
+            out.m_scale = SIMD::MultiplyAdd( LoadQuantizedValues( key.m_scale ), _mm_load_ps( ranges.m_scaleLength ), _mm_load_ps( ranges.m_scaleStart ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        // Decode all tracks 4 at a time, the writer is called once per group with the group index and the decoded SoA transforms
+        template<bool ShouldInterpolate, typename Writer>
+        EE_FORCE_INLINE void DecodeTracks( CompressedTrackData const& trackData, FrameTime const& frameTime, Writer&& writer )
+        {
+            uint32_t const frameIdx = frameTime.GetFrameIndex();
+            __m128 const t = _mm_set1_ps( frameTime.GetPercentageThrough().ToFloat() );
+
+            GatheredKeyFrame key0, key1;
+            GatheredRanges ranges;
+            TransformLanes decoded0, decoded1;
+
+            int32_t const numGroups = SoATransformBuffer::GetPaddedCount( trackData.m_numTracks ) / g_laneWidth;
+            for ( int32_t groupIdx = 0; groupIdx < numGroups; groupIdx++ )
             {
-                int32_t const trackIdx = boneHierarchy[i];
-                auto const& trackSettings = m_trackCompressionSettings[trackIdx];
-                uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
-                ReadCompressedTrackKeyFrame( pTrackData, trackSettings, frameIdx, localTransform );
+                GatherTracks<ShouldInterpolate>( trackData, groupIdx * g_laneWidth, frameIdx, key0, key1, ranges );
+                DecodeKeyFrame( key0, ranges, decoded0 );
+
+                if constexpr ( ShouldInterpolate )
+                {
+                    DecodeKeyFrame( key1, ranges, decoded1 );
+                    InterpolateTransformLanes( decoded0, decoded1, t, decoded0 );
+                }
 
-                globalTransform = localTransform * globalTransform;
+                writer( groupIdx, decoded0 );
             }
         }
-        else // Interpolate key-frames
+
+        template<typename Writer>
+        EE_FORCE_INLINE void DecodeTracks( CompressedTrackData const& trackData, FrameTime const& frameTime, Writer&& writer )
         {
-            // Read root transform
+            if ( frameTime.IsExactlyAtKeyFrame() )
             {
-                auto const& trackSettings = m_trackCompressionSettings[boneHierarchy.back()];
-                uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
-                ReadCompressedTrackTransform( pTrackData, trackSettings, frameTime, globalTransform );
+                DecodeTracks<false>( trackData, frameTime, writer );
             }
+            else
+            {
+                EE_ASSERT( frameTime.GetFrameIndex() < trackData.m_numFrames - 1 );
+                DecodeTracks<true>( trackData, frameTime, writer );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationClip::DecodePose( CompressedTrackData const& trackData, FrameTime const& frameTime, Transform* pOutTransforms )
+    {
+        EE_ASSERT( trackData.m_pData != nullptr && trackData.m_pTrackSettings != nullptr && pOutTransforms != nullptr );
+        EE_ASSERT( frameTime.GetFrameIndex() < trackData.m_numFrames );
+
+        auto WriteTransforms = [pOutTransforms, numTracks = trackData.m_numTracks] ( int32_t groupIdx, TransformLanes const& decoded )
+        {
+            int32_t const firstTrackIdx = groupIdx * SIMDDecoding::g_laneWidth;
+            StoreTransformLanes( decoded, pOutTransforms + firstTrackIdx, Math::Min( SIMDDecoding::g_laneWidth, numTracks - firstTrackIdx ) );
+        };
+
+        SIMDDecoding::DecodeTracks( trackData, frameTime, WriteTransforms );
+    }
 
-            // Read and multiply out all the transforms moving down the hierarchy
-            Transform localTransform;
-            for ( int32_t i = (int32_t) boneHierarchy.size() - 2; i >= 0; i-- )
+    void AnimationClip::DecodePose( CompressedTrackData const& trackData, FrameTime const& frameTime, SoATransformBuffer& outTransforms )
+    {
+        EE_ASSERT( trackData.m_pData != nullptr && trackData.m_pTrackSettings != nullptr );
+        EE_ASSERT( frameTime.GetFrameIndex() < trackData.m_numFrames );
+
+        // The buffer can be larger than the number of decoded tracks when only decoding the tracks for a skeleton LOD
+        if ( outTransforms.GetNumTransforms() < trackData.m_numTracks )
+        {
+            outTransforms.Resize( trackData.m_numTracks );
+        }
+
+        // Padding lanes receive a copy of the last track which is always a valid transform
+        auto WriteTransforms = [&outTransforms] ( int32_t groupIdx, TransformLanes const& decoded )
+        {
+            outTransforms.StoreLanes( groupIdx, decoded );
+        };
+
+        SIMDDecoding::DecodeTracks( trackData, frameTime, WriteTransforms );
+    }
+
+    void AnimationClip::DecodePoseScalar( CompressedTrackData const& trackData, FrameTime const& frameTime, Transform* pOutTransforms )
+    {
+        EE_ASSERT( trackData.m_pData != nullptr && trackData.m_pTrackSettings != nullptr && pOutTransforms != nullptr );
+        EE_ASSERT( frameTime.GetFrameIndex() < trackData.m_numFrames );
+
+        uint16_t const* pTrackData = trackData.m_pData;
+
+        // Read exact key frame
+        if ( frameTime.IsExactlyAtKeyFrame() )
+        {
+            for ( auto trackIdx = 0; trackIdx < trackData.m_numTracks; trackIdx++ )
+            {
+                pTrackData = ReadCompressedTrackKeyFrame( pTrackData, trackData.m_pTrackSettings[trackIdx], trackData.m_numFrames, frameTime.GetFrameIndex(), pOutTransforms[trackIdx] );
+            }
+        }
+        else // Read interpolated anim pose
+        {
+            for ( auto trackIdx = 0; trackIdx < trackData.m_numTracks; trackIdx++ )
             {
-                int32_t const trackIdx = boneHierarchy[i];
-                auto const& trackSettings = m_trackCompressionSettings[trackIdx];
-                uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
-                ReadCompressedTrackTransform( pTrackData, trackSettings, frameTime, localTransform );
+                pTrackData = ReadCompressedTrackTransform( pTrackData, trackData.m_pTrackSettings[trackIdx], trackData.m_numFrames, frameTime, pOutTransforms[trackIdx] );
+            }
+        }
+    }
+    //-------------------------------------------------------------------------
+
+    Transform AnimationClip::DecodeKeyReducedTrack( KeyReducedTrackData const& trackData, int32_t trackIdx, FrameTime const& frameTime )
+    {
+        EE_ASSERT( trackIdx >= 0 && trackIdx < trackData.m_numTracks );
 
-                globalTransform = localTransform * globalTransform;
+        KeyReducedTrackSettings const& settings = trackData.m_pTrackSettings[trackIdx];
+        uint32_t keyIdx0, keyIdx1;
+
+        // Rotation
+        //-------------------------------------------------------------------------
+
+        Quaternion rotation;
+        {
+            KeyReducedComponentSettings const& component = settings.m_rotation;
+            uint32_t const keySize = GetKeyReducedRotationKeySize( component.m_numBits );
+            float const t = FindKeyReducedKeyFrames( trackData.m_pKeyFrameTimes, component, frameTime, keyIdx0, keyIdx1 );
+            rotation = DecodeKeyReducedRotation( trackData.m_pData, component.m_dataBitOffset + ( keyIdx0 * keySize ), component.m_numBits );
+            if ( keyIdx0 != keyIdx1 )
+            {
+                Quaternion const rotation1 = DecodeKeyReducedRotation( trackData.m_pData, component.m_dataBitOffset + ( keyIdx1 * keySize ), component.m_numBits );
+                rotation = Quaternion::NLerp( rotation, rotation1, t );
             }
         }
 
-        return globalTransform;
+        // Translation
+        //-------------------------------------------------------------------------
+
+        Vector translation;
+        {
+            KeyReducedComponentSettings const& component = settings.m_translation;
+            uint32_t const keySize = GetKeyReducedTranslationKeySize( component.m_numBits );
+            float const t = FindKeyReducedKeyFrames( trackData.m_pKeyFrameTimes, component, frameTime, keyIdx0, keyIdx1 );
+            translation = DecodeKeyReducedTranslation( trackData.m_pData, component.m_dataBitOffset + ( keyIdx0 * keySize ), component.m_numBits, settings );
+            if ( keyIdx0 != keyIdx1 )
+            {
+                Vector const translation1 = DecodeKeyReducedTranslation( trackData.m_pData, component.m_dataBitOffset + ( keyIdx1 * keySize ), component.m_numBits, settings );
+                translation = Vector::Lerp( translation, translation1, t );
+            }
+        }
+
+        // Scale
+        //-------------------------------------------------------------------------
+
+        float scale;
+        {
+            KeyReducedComponentSettings const& component = settings.m_scale;
+            uint32_t const keySize = GetKeyReducedScaleKeySize( component.m_numBits );
+            float const t = FindKeyReducedKeyFrames( trackData.m_pKeyFrameTimes, component, frameTime, keyIdx0, keyIdx1 );
+            scale = DecodeKeyReducedScale( trackData.m_pData, component.m_dataBitOffset + ( keyIdx0 * keySize ), component.m_numBits, settings );
+            if ( keyIdx0 != keyIdx1 )
+            {
+                float const scale1 = DecodeKeyReducedScale( trackData.m_pData, component.m_dataBitOffset + ( keyIdx1 * keySize ), component.m_numBits, settings );
+                scale = Math::Lerp( scale, scale1, t );
+            }
+        }
+
+        return Transform( rotation, translation, scale );
+    }
+
+    void AnimationClip::DecodeKeyReducedPose( KeyReducedTrackData const& trackData, FrameTime const& frameTime, Transform* pOutTransforms )
+    {
+        EE_ASSERT( trackData.m_pData != nullptr && trackData.m_pKeyFrameTimes != nullptr && trackData.m_pTrackSettings != nullptr && pOutTransforms != nullptr );
+        EE_ASSERT( frameTime.GetFrameIndex() < trackData.m_numFrames );
+
+        for ( int32_t trackIdx = 0; trackIdx < trackData.m_numTracks; trackIdx++ )
+        {
+            pOutTransforms[trackIdx] = DecodeKeyReducedTrack( trackData, trackIdx, frameTime );
+        }
     }
-}
\ No newline at end of file
+}
@@ -16,6 +16,7 @@ namespace EE::Animation
 {
     class Pose;
     class Event;
+    class SoATransformBuffer;
 
     //-------------------------------------------------------------------------
 
@@ -72,14 +73,76 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    // A non-owning view of a set of compressed tracks, allows the decoders to be run without a loaded clip (i.e. tools and benchmarks)
+    struct CompressedTrackData
+    {
+        uint16_t const*                         m_pData = nullptr;
+        TrackCompressionSettings const*         m_pTrackSettings = nullptr;
+        int32_t                                 m_numTracks = 0;
+        uint32_t                                m_numFrames = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Key Reduced Tracks
+    //-------------------------------------------------------------------------
+    // Each track component (rotation, translation, scale) only stores the key-frames needed to stay within the error tolerance set at compile time
+    // Values are bit-packed using the minimum quantization bit rate for the component, sampling linearly interpolates between the surrounding key-frames
+
+    struct KeyReducedComponentSettings
+    {
+        EE_SERIALIZE( m_firstKeyIdx, m_dataBitOffset, m_numKeys, m_numBits );
+
+        uint32_t                                m_firstKeyIdx = 0;      // The index of the first key-frame time for this component
+        uint32_t                                m_dataBitOffset = 0;    // The bit offset of the first key-frame value for this component
+        uint16_t                                m_numKeys = 0;
+        uint8_t                                 m_numBits = 0;          // The quantization bit rate per value
+    };
+
+    struct KeyReducedTrackSettings
+    {
+        EE_SERIALIZE( m_translationRangeX, m_translationRangeY, m_translationRangeZ, m_scaleRange, m_rotation, m_translation, m_scale );
+
+        QuantizationRange                       m_translationRangeX;
+        QuantizationRange                       m_translationRangeY;
+        QuantizationRange                       m_translationRangeZ;
+        QuantizationRange                       m_scaleRange;
+        KeyReducedComponentSettings             m_rotation;
+        KeyReducedComponentSettings             m_translation;
+        KeyReducedComponentSettings             m_scale;
+    };
+
+    // A non-owning view of a set of key reduced tracks
+    struct KeyReducedTrackData
+    {
+        uint32_t const*                         m_pData = nullptr;
+        uint16_t const*                         m_pKeyFrameTimes = nullptr;
+        KeyReducedTrackSettings const*          m_pTrackSettings = nullptr;
+        int32_t                                 m_numTracks = 0;
+        uint32_t                                m_numFrames = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
     class EE_ENGINE_API AnimationClip : public Resource::IResource
     {
         EE_RESOURCE( 'anim', "Animation Clip" );
-        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_compressedPoseData, m_trackCompressionSettings, m_rootMotion, m_isAdditive );
+        EE_SERIALIZE( m_skeleton, m_numFrames, m_duration, m_compressionFormat, m_compressedPoseData, m_trackCompressionSettings, m_keyReducedData, m_keyFrameTimes, m_keyReducedTrackSettings, m_rootMotion, m_isAdditive );
 
         friend class AnimationClipCompiler;
         friend class AnimationClipLoader;
 
+    public:
+
+        enum class CompressionFormat : uint8_t
+        {
+            Uniform,        // Every frame of every non-static track is stored with 16bit quantization
+            KeyReduced,     // See 'KeyReducedTrackSettings'
+        };
+
+        // Smallest-three rotation encoding range for the key reduced format, i.e. [-1/sqrt(2), 1/sqrt(2)]
+        constexpr static float const s_keyReducedRotationRangeStart = -0.70710678f;
+        constexpr static float const s_keyReducedRotationRangeLength = 1.41421356f;
+
     private:
 
         inline static Quaternion DecodeRotation( uint16_t const* pData )
@@ -102,6 +165,77 @@ namespace EE::Animation
             return s;
         }
 
+        // Key reduced value decoding
+        //-------------------------------------------------------------------------
+        // Bit-packed data is always padded with an extra word so that we can always read two words
+
+        EE_FORCE_INLINE static uint32_t ReadBits( uint32_t const* pData, uint32_t bitOffset, uint32_t numBits )
+        {
+            EE_ASSERT( numBits > 0 && numBits <= 32 );
+            uint32_t const wordIdx = bitOffset >> 5;
+            uint64_t const window = uint64_t( pData[wordIdx] ) | ( uint64_t( pData[wordIdx + 1] ) << 32 );
+            return uint32_t( ( window >> ( bitOffset & 31 ) ) & ( ( uint64_t( 1 ) << numBits ) - 1 ) );
+        }
+
+        EE_FORCE_INLINE static float DequantizeFloat( uint32_t quantizedValue, uint32_t numBits, float rangeStart, float rangeLength )
+        {
+            return rangeStart + ( float( quantizedValue ) * ( rangeLength / float( ( 1u << numBits ) - 1 ) ) );
+        }
+
+        // Rotations are stored as the index of the largest component (2 bits) followed by the three smallest components
+        inline static Quaternion DecodeKeyReducedRotation( uint32_t const* pData, uint32_t bitOffset, uint32_t numBits )
+        {
+            uint32_t const largestComponentIdx = ReadBits( pData, bitOffset, 2 );
+            float const a = DequantizeFloat( ReadBits( pData, bitOffset + 2, numBits ), numBits, s_keyReducedRotationRangeStart, s_keyReducedRotationRangeLength );
+            float const b = DequantizeFloat( ReadBits( pData, bitOffset + 2 + numBits, numBits ), numBits, s_keyReducedRotationRangeStart, s_keyReducedRotationRangeLength );
+            float const c = DequantizeFloat( ReadBits( pData, bitOffset + 2 + ( numBits * 2 ), numBits ), numBits, s_keyReducedRotationRangeStart, s_keyReducedRotationRangeLength );
+            float const d = Math::Sqrt( Math::Max( 1.0f - ( a * a ) - ( b * b ) - ( c * c ), 0.0f ) );
+
+            switch ( largestComponentIdx )
+            {
+                case 0: return Quaternion( d, a, b, c );
+                case 1: return Quaternion( a, d, b, c );
+                case 2: return Quaternion( a, b, d, c );
+                default: return Quaternion( a, b, c, d );
+            }
+        }
+
+        inline static Vector DecodeKeyReducedTranslation( uint32_t const* pData, uint32_t bitOffset, uint32_t numBits, KeyReducedTrackSettings const& settings )
+        {
+            float const x = DequantizeFloat( ReadBits( pData, bitOffset, numBits ), numBits, settings.m_translationRangeX.m_rangeStart, settings.m_translationRangeX.m_rangeLength );
+            float const y = DequantizeFloat( ReadBits( pData, bitOffset + numBits, numBits ), numBits, settings.m_translationRangeY.m_rangeStart, settings.m_translationRangeY.m_rangeLength );
+            float const z = DequantizeFloat( ReadBits( pData, bitOffset + ( numBits * 2 ), numBits ), numBits, settings.m_translationRangeZ.m_rangeStart, settings.m_translationRangeZ.m_rangeLength );
+            return Vector( x, y, z );
+        }
+
+        inline static float DecodeKeyReducedScale( uint32_t const* pData, uint32_t bitOffset, uint32_t numBits, KeyReducedTrackSettings const& settings )
+        {
+            return DequantizeFloat( ReadBits( pData, bitOffset, numBits ), numBits, settings.m_scaleRange.m_rangeStart, settings.m_scaleRange.m_rangeLength );
+        }
+
+        // Get the size in bits of a single key-frame value for each component
+        EE_FORCE_INLINE static uint32_t GetKeyReducedRotationKeySize( uint32_t numBits ) { return 2 + ( numBits * 3 ); }
+        EE_FORCE_INLINE static uint32_t GetKeyReducedTranslationKeySize( uint32_t numBits ) { return numBits * 3; }
+        EE_FORCE_INLINE static uint32_t GetKeyReducedScaleKeySize( uint32_t numBits ) { return numBits; }
+
+    public:
+
+        // Decode the local transforms for all tracks using the vectorized decoder (4 tracks per iteration)
+        // Key-frames are interpolated with a normalized lerp, the delta between adjacent key-frames is small enough that this matches the slerp result within quantization error
+        static void DecodePose( CompressedTrackData const& trackData, FrameTime const& frameTime, Transform* pOutTransforms );
+
+        // Decode the local transforms for all tracks directly into a SoA buffer, the buffer will be resized if needed
+        static void DecodePose( CompressedTrackData const& trackData, FrameTime const& frameTime, SoATransformBuffer& outTransforms );
+
+        // Decode the local transforms for all tracks one track at a time, this is the reference implementation for the vectorized decoder
+        static void DecodePoseScalar( CompressedTrackData const& trackData, FrameTime const& frameTime, Transform* pOutTransforms );
+
+        // Decode the local transforms for all key reduced tracks
+        static void DecodeKeyReducedPose( KeyReducedTrackData const& trackData, FrameTime const& frameTime, Transform* pOutTransforms );
+
+        // Decode the local transform for a single key reduced track
+        static Transform DecodeKeyReducedTrack( KeyReducedTrackData const& trackData, int32_t trackIdx, FrameTime const& frameTime );
+
     public:
 
         AnimationClip() = default;
@@ -115,6 +249,7 @@ namespace EE::Animation
 
         inline bool IsSingleFrameAnimation() const { return m_numFrames == 1; }
         inline bool IsAdditive() const { return m_isAdditive; }
+        inline CompressionFormat GetCompressionFormat() const { return m_compressionFormat; }
         inline float GetFPS() const { return float( m_numFrames - 1 ) / m_duration; }
         inline uint32_t GetNumFrames() const { return m_numFrames; }
         inline Seconds GetDuration() const { return m_duration; }
@@ -131,6 +266,16 @@ namespace EE::Animation
         void GetPose( FrameTime const& frameTime, Pose* pOutPose ) const;
         inline void GetPose( Percentage percentageThrough, Pose* pOutPose ) const { GetPose( GetFrameTime( percentageThrough ), pOutPose ); }
 
+        // Sample the pose directly into a SoA transform buffer
+        void GetPose( FrameTime const& frameTime, SoATransformBuffer& outTransforms ) const;
+
+        // Get the view of the compressed data for this clip
+        inline CompressedTrackData GetCompressedTrackData() const { EE_ASSERT( m_compressionFormat == CompressionFormat::Uniform ); return CompressedTrackData{ m_compressedPoseData.data(), m_trackCompressionSettings.data(), (int32_t) m_trackCompressionSettings.size(), m_numFrames }; }
+        inline KeyReducedTrackData GetKeyReducedTrackData() const { EE_ASSERT( m_compressionFormat == CompressionFormat::KeyReduced ); return KeyReducedTrackData{ m_keyReducedData.data(), m_keyFrameTimes.data(), m_keyReducedTrackSettings.data(), (int32_t) m_keyReducedTrackSettings.size(), m_numFrames }; }
+
+        // Get the size of the compressed pose data for this clip (in bytes)
+        size_t GetCompressedPoseDataSize() const;
+
         Transform GetLocalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const;
         inline Transform GetLocalSpaceTransform( int32_t boneIdx, Percentage percentageThrough ) const{ return GetLocalSpaceTransform( boneIdx, GetFrameTime( percentageThrough ) ); }
 
@@ -194,16 +339,26 @@ namespace EE::Animation
     private:
 
         // Read a compressed transform from a track and return a pointer to the data for the next track
-        inline uint16_t const* ReadCompressedTrackTransform( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, FrameTime const& frameTime, Transform& outTransform ) const;
-        inline uint16_t const* ReadCompressedTrackKeyFrame( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, uint32_t frameIdx, Transform& outTransform ) const;
+        inline static uint16_t const* ReadCompressedTrackTransform( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, uint32_t numFrames, FrameTime const& frameTime, Transform& outTransform );
+        inline static uint16_t const* ReadCompressedTrackKeyFrame( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, uint32_t numFrames, uint32_t frameIdx, Transform& outTransform );
+
+        // Find the key-frames surrounding the sample time for a key reduced component, returns the interpolation weight between the two keys
+        inline static float FindKeyReducedKeyFrames( uint16_t const* pKeyFrameTimes, KeyReducedComponentSettings const& component, FrameTime const& frameTime, uint32_t& outKeyIdx0, uint32_t& outKeyIdx1 );
+
+        // Sample a single track regardless of compression format
+        Transform GetTrackTransform( int32_t trackIdx, FrameTime const& frameTime ) const;
 
     private:
 
         TResourcePtr<Skeleton>                  m_skeleton;
         uint32_t                                m_numFrames = 0;
         Seconds                                 m_duration = 0.0f;
+        CompressionFormat                       m_compressionFormat = CompressionFormat::Uniform;
         TVector<uint16_t>                       m_compressedPoseData;
         TVector<TrackCompressionSettings>       m_trackCompressionSettings;
+        TVector<uint32_t>                       m_keyReducedData;
+        TVector<uint16_t>                       m_keyFrameTimes;
+        TVector<KeyReducedTrackSettings>        m_keyReducedTrackSettings;
         TVector<Event*>                         m_events;
         SyncTrack                               m_syncTrack;
         RootMotionData                          m_rootMotion;
@@ -218,13 +373,13 @@ namespace EE::Animation
 
 namespace EE::Animation
 {
-    inline uint16_t const* AnimationClip::ReadCompressedTrackTransform( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, FrameTime const& frameTime, Transform& outTransform ) const
+    inline uint16_t const* AnimationClip::ReadCompressedTrackTransform( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, uint32_t numFrames, FrameTime const& frameTime, Transform& outTransform )
     {
         EE_ASSERT( pTrackData != nullptr );
 
         uint32_t const frameIdx = frameTime.GetFrameIndex();
         Percentage const percentageThrough = frameTime.GetPercentageThrough();
-        EE_ASSERT( frameIdx < GetNumFrames() );
+        EE_ASSERT( frameIdx < numFrames );
 
         //-------------------------------------------------------------------------
 
@@ -240,13 +395,13 @@ namespace EE::Animation
 
         uint32_t PoseDataIdx0 = frameIdx * rotationStride;
         uint32_t PoseDataIdx1 = PoseDataIdx0 + rotationStride;
-        EE_ASSERT( PoseDataIdx1 < ( m_numFrames * rotationStride ) );
+        EE_ASSERT( PoseDataIdx1 < ( numFrames * rotationStride ) );
 
         transform0.SetRotation( DecodeRotation( &pTrackData[PoseDataIdx0] ) );
         transform1.SetRotation( DecodeRotation( &pTrackData[PoseDataIdx1] ) );
 
         // Shift the track data ptr to the translation data
-        pTrackData += ( m_numFrames * rotationStride );
+        pTrackData += ( numFrames * rotationStride );
 
         //-------------------------------------------------------------------------
         // Read translation
@@ -268,13 +423,13 @@ namespace EE::Animation
         {
             PoseDataIdx0 = frameIdx * translationStride;
             PoseDataIdx1 = PoseDataIdx0 + translationStride;
-            EE_ASSERT( PoseDataIdx1 < ( m_numFrames * translationStride ) );
+            EE_ASSERT( PoseDataIdx1 < ( numFrames * translationStride ) );
 
             transform0.SetTranslation( DecodeTranslation( &pTrackData[PoseDataIdx0], trackSettings ) );
             transform1.SetTranslation( DecodeTranslation( &pTrackData[PoseDataIdx1], trackSettings ) );
 
             // Shift the track data ptr to the translation data
-            pTrackData += ( m_numFrames * rotationStride );
+            pTrackData += ( numFrames * rotationStride );
         }
 
         //-------------------------------------------------------------------------
@@ -297,13 +452,13 @@ namespace EE::Animation
         {
             PoseDataIdx0 = frameIdx * scaleStride;
             PoseDataIdx1 = PoseDataIdx0 + scaleStride;
-            EE_ASSERT( PoseDataIdx1 < ( m_numFrames * scaleStride ) );
+            EE_ASSERT( PoseDataIdx1 < ( numFrames * scaleStride ) );
 
             transform0.SetScale( DecodeScale( &pTrackData[PoseDataIdx0], trackSettings ) );
             transform1.SetScale( DecodeScale( &pTrackData[PoseDataIdx1], trackSettings ) );
 
             // Shift the track data ptr to the next track's rotation data
-            pTrackData += ( m_numFrames * scaleStride );
+            pTrackData += ( numFrames * scaleStride );
         }
 
         //-------------------------------------------------------------------------
@@ -317,10 +472,10 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
-    inline uint16_t const* AnimationClip::ReadCompressedTrackKeyFrame( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, uint32_t frameIdx, Transform& outTransform ) const
+    inline uint16_t const* AnimationClip::ReadCompressedTrackKeyFrame( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, uint32_t numFrames, uint32_t frameIdx, Transform& outTransform )
     {
         EE_ASSERT( pTrackData != nullptr );
-        EE_ASSERT( frameIdx < GetNumFrames() );
+        EE_ASSERT( frameIdx < numFrames );
 
         //-------------------------------------------------------------------------
         // Read rotation
@@ -330,12 +485,12 @@ namespace EE::Animation
         static constexpr uint32_t const rotationStride = 3;
 
         uint32_t PoseDataIdx = frameIdx * rotationStride;
-        EE_ASSERT( PoseDataIdx < ( m_numFrames * rotationStride ) );
+        EE_ASSERT( PoseDataIdx < ( numFrames * rotationStride ) );
 
         outTransform.SetRotation( DecodeRotation( &pTrackData[PoseDataIdx] ) );
 
         // Shift the track data ptr to the translation data
-        pTrackData += ( m_numFrames * rotationStride );
+        pTrackData += ( numFrames * rotationStride );
 
         //-------------------------------------------------------------------------
         // Read translation
@@ -355,12 +510,12 @@ namespace EE::Animation
         else // Read the translation key-frames
         {
             PoseDataIdx = frameIdx * translationStride;
-            EE_ASSERT( PoseDataIdx < ( m_numFrames * translationStride ) );
+            EE_ASSERT( PoseDataIdx < ( numFrames * translationStride ) );
 
             outTransform.SetTranslation( DecodeTranslation( &pTrackData[PoseDataIdx], trackSettings ) );
 
             // Shift the track data ptr to the translation data
-            pTrackData += ( m_numFrames * rotationStride );
+            pTrackData += ( numFrames * rotationStride );
         }
 
         //-------------------------------------------------------------------------
@@ -381,12 +536,12 @@ namespace EE::Animation
         else // Read the scale key-frames
         {
             PoseDataIdx = frameIdx * scaleStride;
-            EE_ASSERT( PoseDataIdx < ( m_numFrames * scaleStride ) );
+            EE_ASSERT( PoseDataIdx < ( numFrames * scaleStride ) );
 
             outTransform.SetScale( DecodeScale( &pTrackData[PoseDataIdx], trackSettings ) );
 
             // Shift the track data ptr to the next track's rotation data
-            pTrackData += ( m_numFrames * scaleStride );
+            pTrackData += ( numFrames * scaleStride );
         }
 
         //-------------------------------------------------------------------------
@@ -396,6 +551,45 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    inline float AnimationClip::FindKeyReducedKeyFrames( uint16_t const* pKeyFrameTimes, KeyReducedComponentSettings const& component, FrameTime const& frameTime, uint32_t& outKeyIdx0, uint32_t& outKeyIdx1 )
+    {
+        EE_ASSERT( component.m_numKeys > 0 );
+
+        uint16_t const* pKeys = pKeyFrameTimes + component.m_firstKeyIdx;
+        uint32_t const frameIdx = frameTime.GetFrameIndex();
+
+        // Find the last key at or before the sample frame, the first key is always at frame 0
+        uint32_t low = 0;
+        uint32_t high = component.m_numKeys;
+        while ( high - low > 1 )
+        {
+            uint32_t const mid = ( low + high ) >> 1;
+            if ( pKeys[mid] <= frameIdx )
+            {
+                low = mid;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        outKeyIdx0 = low;
+
+        // Static component or sampling the last key
+        if ( low + 1 == component.m_numKeys )
+        {
+            outKeyIdx1 = low;
+            return 0.0f;
+        }
+
+        outKeyIdx1 = low + 1;
+        float const sampleTime = float( frameIdx - pKeys[low] ) + frameTime.GetPercentageThrough().ToFloat();
+        return sampleTime / float( pKeys[low + 1] - pKeys[low] );
+    }
+
+    //-------------------------------------------------------------------------
+
     inline void AnimationClip::GetEventsForRangeNoLooping( Seconds fromTime, Seconds toTime, TInlineVector<Event const*, 10>& outEvents ) const
     {
         EE_ASSERT( toTime >= fromTime );
@@ -8,6 +8,7 @@ namespace EE::Animation
     Pose::Pose( Skeleton const* pSkeleton, Type initialState )
         : m_pSkeleton( pSkeleton )
         , m_localTransforms( pSkeleton->GetNumBones() )
+        , m_numActiveBones( pSkeleton->GetNumBones() )
     {
         EE_ASSERT( pSkeleton != nullptr );
         Reset( initialState );
@@ -24,6 +25,8 @@ namespace EE::Animation
         m_pSkeleton = rhs.m_pSkeleton;
         m_localTransforms.swap( rhs.m_localTransforms );
         m_globalTransforms.swap( rhs.m_globalTransforms );
+        m_numActiveBones = rhs.m_numActiveBones;
+        m_skeletonLOD = rhs.m_skeletonLOD;
         m_state = rhs.m_state;
 
         return *this;
@@ -31,14 +34,63 @@ namespace EE::Animation
 
     void Pose::CopyFrom( Pose const& rhs )
     {
+        // If both poses share the same LOD, our inactive bones are already in the reference pose so we only need to copy the active ones
+        bool const canCopyActiveBonesOnly = ( m_pSkeleton == rhs.m_pSkeleton ) && ( m_skeletonLOD == rhs.m_skeletonLOD ) && ( m_localTransforms.size() == rhs.m_localTransforms.size() );
+
         m_pSkeleton = rhs.m_pSkeleton;
-        m_localTransforms = rhs.m_localTransforms;
-        m_globalTransforms = rhs.m_globalTransforms;
+        m_numActiveBones = rhs.m_numActiveBones;
+        m_skeletonLOD = rhs.m_skeletonLOD;
+
+        m_localTransforms.resize( rhs.m_localTransforms.size() );
+        eastl::copy( rhs.m_localTransforms.begin(), rhs.m_localTransforms.begin() + m_numActiveBones, m_localTransforms.begin() );
+
+        // Our inactive bones were set for a different LOD, so they need to be explicitly put back into the reference pose
+        if ( !canCopyActiveBonesOnly )
+        {
+            ResetInactiveBones();
+        }
+
+        // Only the active global transforms are valid
+        if ( rhs.HasGlobalTransforms() )
+        {
+            m_globalTransforms.resize( rhs.m_globalTransforms.size() );
+            eastl::copy( rhs.m_globalTransforms.begin(), rhs.m_globalTransforms.begin() + m_numActiveBones, m_globalTransforms.begin() );
+        }
+        else
+        {
+            m_globalTransforms.clear();
+        }
+
         m_state = rhs.m_state;
     }
 
     //-------------------------------------------------------------------------
 
+    void Pose::SetSkeletonLOD( int32_t lod )
+    {
+        EE_ASSERT( m_pSkeleton->IsValidLOD( lod ) );
+
+        if ( lod == m_skeletonLOD )
+        {
+            return;
+        }
+
+        m_skeletonLOD = lod;
+        m_numActiveBones = m_pSkeleton->GetNumBones( lod );
+
+        // Reset all the newly inactive bones to the reference pose, these are not touched again until they become active
+        ResetInactiveBones();
+        m_globalTransforms.clear();
+    }
+
+    void Pose::ResetInactiveBones()
+    {
+        auto const& referencePose = m_pSkeleton->GetLocalReferencePose();
+        eastl::copy( referencePose.begin() + m_numActiveBones, referencePose.end(), m_localTransforms.begin() + m_numActiveBones );
+    }
+
+    //-------------------------------------------------------------------------
+
     void Pose::Reset( Type initialState, bool calcGlobalPose )
     {
         switch ( initialState )
@@ -66,7 +118,8 @@ namespace EE::Animation
 
     void Pose::SetToReferencePose( bool setGlobalPose )
     {
-        m_localTransforms = m_pSkeleton->GetLocalReferencePose();
+        auto const& referencePose = m_pSkeleton->GetLocalReferencePose();
+        eastl::copy( referencePose.begin(), referencePose.begin() + m_numActiveBones, m_localTransforms.begin() );
 
         if ( setGlobalPose )
         {
@@ -83,11 +136,11 @@ namespace EE::Animation
     void Pose::SetToZeroPose( bool setGlobalPose )
     {
         auto const numBones = m_pSkeleton->GetNumBones();
-        m_localTransforms.resize( numBones, Transform::Identity );
+        eastl::fill( m_localTransforms.begin(), m_localTransforms.begin() + m_numActiveBones, Transform::Identity );
 
         if ( setGlobalPose )
         {
-            m_globalTransforms = m_localTransforms;
+            m_globalTransforms.assign( numBones, Transform::Identity );
         }
         else
         {
@@ -101,11 +154,10 @@ namespace EE::Animation
 
     void Pose::CalculateGlobalTransforms()
     {
-        int32_t const numBones = m_pSkeleton->GetNumBones();
-        m_globalTransforms.resize( numBones );
+        m_globalTransforms.resize( m_pSkeleton->GetNumBones() );
 
         m_globalTransforms[0] = m_localTransforms[0];
-        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        for ( auto boneIdx = 1; boneIdx < m_numActiveBones; boneIdx++ )
         {
             int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
             m_globalTransforms[boneIdx] = m_localTransforms[boneIdx] * m_globalTransforms[parentIdx];
@@ -119,7 +171,22 @@ namespace EE::Animation
         Transform boneGlobalTransform;
         if ( !m_globalTransforms.empty() )
         {
-            boneGlobalTransform = m_globalTransforms[boneIdx];
+            if ( boneIdx < m_numActiveBones )
+            {
+                boneGlobalTransform = m_globalTransforms[boneIdx];
+            }
+            else // Inactive bones are not cached, so walk up to the first active parent
+            {
+                boneGlobalTransform = m_localTransforms[boneIdx];
+                int32_t parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
+                while ( parentIdx >= m_numActiveBones )
+                {
+                    boneGlobalTransform = boneGlobalTransform * m_localTransforms[parentIdx];
+                    parentIdx = m_pSkeleton->GetParentBoneIndex( parentIdx );
+                }
+
+                boneGlobalTransform = boneGlobalTransform * m_globalTransforms[parentIdx];
+            }
         }
         else
         {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AnimationSkeleton.h"
+#include "AnimationSoA.h"
 #include "System/Math/Math.h"
 #include "System/Types/Color.h"
 
@@ -55,6 +56,18 @@ namespace EE::Animation
         inline int32_t GetNumBones() const { return m_pSkeleton->GetNumBones(); }
         inline Skeleton const* GetSkeleton() const { return m_pSkeleton; }
 
+        // Skeleton LOD
+        //-------------------------------------------------------------------------
+        // Only the bones active for the current LOD are sampled, blended and have their global transforms calculated
+        // The inactive bones are always left in the reference pose
+
+        inline int32_t GetSkeletonLOD() const { return m_skeletonLOD; }
+        inline int32_t GetNumActiveBones() const { return m_numActiveBones; }
+        inline bool IsBoneActive( int32_t boneIdx ) const { return boneIdx < m_numActiveBones; }
+
+        // Change the skeleton LOD, this invalidates the global transforms
+        void SetSkeletonLOD( int32_t lod );
+
         // Pose state
         //-------------------------------------------------------------------------
 
@@ -105,11 +118,33 @@ namespace EE::Animation
             MarkAsValidPose();
         }
 
+        // Lane Access
+        //-------------------------------------------------------------------------
+        // Transposed access to groups of 4 local transforms, used by the vectorized blend kernels
+        // Lanes past the end of the active bones are loaded as identity and are not stored
+
+        // Only the lanes for the active bones are processed, LOD bone counts are always padded to the lane width so lanes never straddle the active bone boundary
+        inline int32_t GetNumLanes() const { return SoATransformBuffer::GetPaddedCount( m_numActiveBones ) / SoATransformBuffer::s_laneWidth; }
+
+        EE_FORCE_INLINE void LoadLanes( int32_t laneIdx, TransformLanes& outLanes ) const
+        {
+            int32_t const firstBoneIdx = laneIdx * SoATransformBuffer::s_laneWidth;
+            LoadTransformLanes( m_localTransforms.data() + firstBoneIdx, Math::Min( SoATransformBuffer::s_laneWidth, m_numActiveBones - firstBoneIdx ), outLanes );
+        }
+
+        EE_FORCE_INLINE void StoreLanes( int32_t laneIdx, TransformLanes const& lanes )
+        {
+            int32_t const firstBoneIdx = laneIdx * SoATransformBuffer::s_laneWidth;
+            StoreTransformLanes( lanes, m_localTransforms.data() + firstBoneIdx, Math::Min( SoATransformBuffer::s_laneWidth, m_numActiveBones - firstBoneIdx ) );
+            MarkAsValidPose();
+        }
+
         // Global Transform Cache
         //-------------------------------------------------------------------------
 
         inline bool HasGlobalTransforms() const { return !m_globalTransforms.empty(); }
         inline void ClearGlobalTransforms() { m_globalTransforms.clear(); }
+        // Only the global transforms for the active bones are valid, use 'GetGlobalTransform' for inactive bones
         inline TVector<Transform> const& GetGlobalTransforms() const { return m_globalTransforms; }
         void CalculateGlobalTransforms();
         Transform GetGlobalTransform( int32_t boneIdx ) const;
@@ -128,6 +163,9 @@ namespace EE::Animation
         void SetToReferencePose( bool setGlobalPose );
         void SetToZeroPose( bool setGlobalPose );
 
+        // Put all the bones inactive for the current LOD back into the reference pose
+        void ResetInactiveBones();
+
         EE_FORCE_INLINE void MarkAsValidPose()
         {
             if ( m_state != State::Pose && m_state != State::AdditivePose )
@@ -141,6 +179,8 @@ namespace EE::Animation
         Skeleton const*             m_pSkeleton;                // The skeleton for this pose
         TVector<Transform>          m_localTransforms;          // Parent-space transforms
         TVector<Transform>          m_globalTransforms;         // Character-space transforms
+        int32_t                     m_numActiveBones = 0;       // The number of bones active for the current skeleton LOD
+        int32_t                     m_skeletonLOD = 0;          // The current skeleton LOD
         State                       m_state = State::Unset;     // Pose state
     };
 }
\ No newline at end of file
@@ -23,11 +23,13 @@ namespace EE::Animation
     //-------------------------------------------------------------------------
     // Animation Skeleton
     //-------------------------------------------------------------------------
+    // Bones are sorted so that the bones for each LOD level are a prefix of the bone list, LOD 0 is the full skeleton
+    // Lower detail LODs only sample, blend and skin the first 'GetNumBones( lod )' bones
 
     class EE_ENGINE_API Skeleton : public Resource::IResource
     {
         EE_RESOURCE( 'skel', "Animation Skeleton" );
-        EE_SERIALIZE( m_boneIDs, m_localReferencePose, m_parentIndices, m_boneFlags );
+        EE_SERIALIZE( m_boneIDs, m_localReferencePose, m_parentIndices, m_boneFlags, m_numBonesPerLOD );
 
         friend class SkeletonCompiler;
         friend class SkeletonLoader;
@@ -43,6 +45,22 @@ namespace EE::Animation
         virtual bool IsValid() const final;
         inline int32_t GetNumBones() const { return (int32_t) m_boneIDs.size(); }
 
+        // LOD
+        //-------------------------------------------------------------------------
+
+        inline int32_t GetNumLODs() const { return (int32_t) m_numBonesPerLOD.size(); }
+        inline bool IsValidLOD( int32_t lod ) const { return lod >= 0 && lod < m_numBonesPerLOD.size(); }
+
+        // Get the number of bones that are active for a given LOD level, these are always the first N bones of the skeleton
+        inline int32_t GetNumBones( int32_t lod ) const
+        {
+            EE_ASSERT( IsValidLOD( lod ) );
+            return m_numBonesPerLOD[lod];
+        }
+
+        // Is this bone active for the specified LOD level
+        EE_FORCE_INLINE bool IsBoneActive( int32_t boneIdx, int32_t lod ) const { return boneIdx < GetNumBones( lod ); }
+
         // Bone info
         //-------------------------------------------------------------------------
 
@@ -117,5 +135,6 @@ namespace EE::Animation
         TVector<Transform>                  m_globalReferencePose;
         TVector<TBitFlags<BoneFlags>>       m_boneFlags;
         TVector<BoneMask>                   m_boneMasks;
+        TVector<int32_t>                    m_numBonesPerLOD;
     };
 }
\ No newline at end of file
@@ -0,0 +1,134 @@
+#include "AnimationSoA.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    SoATransformBuffer::~SoATransformBuffer()
+    {
+        EE::Free( m_pData );
+    }
+
+    SoATransformBuffer& SoATransformBuffer::operator=( SoATransformBuffer&& rhs )
+    {
+        eastl::swap( m_pData, rhs.m_pData );
+        eastl::swap( m_numTransforms, rhs.m_numTransforms );
+        eastl::swap( m_numPaddedTransforms, rhs.m_numPaddedTransforms );
+        return *this;
+    }
+
+    void SoATransformBuffer::CopyFrom( SoATransformBuffer const& rhs )
+    {
+        if ( m_numPaddedTransforms != rhs.m_numPaddedTransforms )
+        {
+            Resize( rhs.m_numTransforms );
+        }
+
+        m_numTransforms = rhs.m_numTransforms;
+        memcpy( m_pData, rhs.m_pData, sizeof( float ) * NumStreams * m_numPaddedTransforms );
+    }
+
+    void SoATransformBuffer::Resize( int32_t numTransforms )
+    {
+        EE_ASSERT( numTransforms >= 0 );
+
+        int32_t const numPaddedTransforms = GetPaddedCount( numTransforms );
+        if ( numPaddedTransforms != m_numPaddedTransforms )
+        {
+            EE::Free( m_pData );
+            if ( numPaddedTransforms > 0 )
+            {
+                m_pData = (float*) EE::Alloc( sizeof( float ) * NumStreams * numPaddedTransforms, 16 );
+            }
+        }
+
+        m_numTransforms = numTransforms;
+        m_numPaddedTransforms = numPaddedTransforms;
+        SetToIdentity();
+    }
+
+    void SoATransformBuffer::SetToIdentity()
+    {
+        if ( m_numPaddedTransforms == 0 )
+        {
+            return;
+        }
+
+        size_t const streamSize = sizeof( float ) * m_numPaddedTransforms;
+        Memory::MemsetZero( m_pData, streamSize * NumStreams );
+
+        __m128 const one = _mm_set1_ps( 1.0f );
+        int32_t const numLanes = GetNumLanes();
+        for ( int32_t laneIdx = 0; laneIdx < numLanes; laneIdx++ )
+        {
+            StoreLane( RotationW, laneIdx, one );
+            StoreLane( Scale, laneIdx, one );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    Transform SoATransformBuffer::GetTransform( int32_t idx ) const
+    {
+        EE_ASSERT( idx >= 0 && idx < m_numTransforms );
+
+        Quaternion const rotation( GetStream( RotationX )[idx], GetStream( RotationY )[idx], GetStream( RotationZ )[idx], GetStream( RotationW )[idx] );
+        Vector const translationScale( GetStream( TranslationX )[idx], GetStream( TranslationY )[idx], GetStream( TranslationZ )[idx], GetStream( Scale )[idx] );
+        return Transform::FromRotationAndTranslationScale( rotation, translationScale );
+    }
+
+    void SoATransformBuffer::SetTransform( int32_t idx, Transform const& transform )
+    {
+        EE_ASSERT( idx >= 0 && idx < m_numTransforms );
+
+        Float4 const rotation = transform.GetRotation().ToFloat4();
+        Float4 const translationScale = transform.GetTranslation().ToFloat4();
+
+        GetStream( RotationX )[idx] = rotation.m_x;
+        GetStream( RotationY )[idx] = rotation.m_y;
+        GetStream( RotationZ )[idx] = rotation.m_z;
+        GetStream( RotationW )[idx] = rotation.m_w;
+        GetStream( TranslationX )[idx] = translationScale.m_x;
+        GetStream( TranslationY )[idx] = translationScale.m_y;
+        GetStream( TranslationZ )[idx] = translationScale.m_z;
+        GetStream( Scale )[idx] = translationScale.m_w;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SoATransformBuffer::FromTransforms( Transform const* pTransforms, int32_t numTransforms )
+    {
+        EE_ASSERT( pTransforms != nullptr || numTransforms == 0 );
+
+        if ( GetPaddedCount( numTransforms ) != m_numPaddedTransforms )
+        {
+            Resize( numTransforms );
+        }
+        m_numTransforms = numTransforms;
+
+        //-------------------------------------------------------------------------
+
+        TransformLanes lanes;
+        int32_t const numLanes = GetNumLanes();
+        for ( int32_t laneIdx = 0; laneIdx < numLanes; laneIdx++ )
+        {
+            int32_t const firstIdx = laneIdx * s_laneWidth;
+            LoadTransformLanes( pTransforms + firstIdx, Math::Min( s_laneWidth, numTransforms - firstIdx ), lanes );
+            StoreLanes( laneIdx, lanes );
+        }
+    }
+
+    void SoATransformBuffer::ToTransforms( Transform* pTransforms ) const
+    {
+        EE_ASSERT( pTransforms != nullptr || m_numTransforms == 0 );
+
+        TransformLanes lanes;
+        int32_t const numLanes = GetNumLanes();
+        for ( int32_t laneIdx = 0; laneIdx < numLanes; laneIdx++ )
+        {
+            int32_t const firstIdx = laneIdx * s_laneWidth;
+            LoadLanes( laneIdx, lanes );
+            StoreTransformLanes( lanes, pTransforms + firstIdx, Math::Min( s_laneWidth, m_numTransforms - firstIdx ) );
+        }
+    }
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Math/Transform.h"
+#include "System/Math/SIMD.h"
+
+//-------------------------------------------------------------------------
+// Structure-of-Arrays Transform Storage
+//-------------------------------------------------------------------------
+// Each transform component is stored in its own float stream so that SIMD kernels can process 4 bones per instruction.
+// Streams are padded to a multiple of the SIMD width, padding lanes are kept as valid transforms so that kernels can
+// always operate on full lanes without producing invalid values.
+
+namespace EE::Animation
+{
+    // A group of 4 transforms held in SIMD registers, one register per transform component
+    struct TransformLanes
+    {
+        __m128      m_rotation[4];
+        __m128      m_translation[3];
+        __m128      m_scale;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API SoATransformBuffer
+    {
+    public:
+
+        enum Stream : uint8_t
+        {
+            RotationX = 0,
+            RotationY,
+            RotationZ,
+            RotationW,
+            TranslationX,
+            TranslationY,
+            TranslationZ,
+            Scale,
+
+            NumStreams
+        };
+
+        constexpr static int32_t const s_laneWidth = 4;
+
+        EE_FORCE_INLINE static int32_t GetPaddedCount( int32_t numTransforms ) { return ( numTransforms + s_laneWidth - 1 ) & ~( s_laneWidth - 1 ); }
+
+    public:
+
+        SoATransformBuffer() = default;
+        explicit SoATransformBuffer( int32_t numTransforms ) { Resize( numTransforms ); }
+        ~SoATransformBuffer();
+
+        SoATransformBuffer( SoATransformBuffer&& rhs ) { operator=( eastl::move( rhs ) ); }
+        SoATransformBuffer& operator=( SoATransformBuffer&& rhs );
+
+        // Explicitly disable the copy operation to prevent accidental copies
+        SoATransformBuffer( SoATransformBuffer const& rhs ) = delete;
+        SoATransformBuffer& operator=( SoATransformBuffer const& rhs ) = delete;
+
+        void CopyFrom( SoATransformBuffer const& rhs );
+
+        // Resize the buffer, all transforms are reset to identity
+        void Resize( int32_t numTransforms );
+
+        // Reset all transforms (including the padding) to identity
+        void SetToIdentity();
+
+        inline bool IsEmpty() const { return m_numTransforms == 0; }
+        inline int32_t GetNumTransforms() const { return m_numTransforms; }
+        inline int32_t GetNumPaddedTransforms() const { return m_numPaddedTransforms; }
+        inline int32_t GetNumLanes() const { return m_numPaddedTransforms / s_laneWidth; }
+
+        // Streams
+        //-------------------------------------------------------------------------
+        // All streams are 16 byte aligned and contain 'GetNumPaddedTransforms()' elements
+
+        EE_FORCE_INLINE float* GetStream( Stream stream ) { EE_ASSERT( stream < NumStreams ); return m_pData + ( stream * m_numPaddedTransforms ); }
+        EE_FORCE_INLINE float const* GetStream( Stream stream ) const { EE_ASSERT( stream < NumStreams ); return m_pData + ( stream * m_numPaddedTransforms ); }
+
+        EE_FORCE_INLINE __m128 LoadLane( Stream stream, int32_t laneIdx ) const { return _mm_load_ps( GetStream( stream ) + ( laneIdx * s_laneWidth ) ); }
+        EE_FORCE_INLINE void StoreLane( Stream stream, int32_t laneIdx, __m128 value ) { _mm_store_ps( GetStream( stream ) + ( laneIdx * s_laneWidth ), value ); }
+
+        // Load all the components for a given lane
+        EE_FORCE_INLINE void LoadLanes( int32_t laneIdx, TransformLanes& outLanes ) const
+        {
+            EE_ASSERT( laneIdx >= 0 && laneIdx < GetNumLanes() );
+            for ( int32_t i = 0; i < 4; i++ )
+            {
+                outLanes.m_rotation[i] = LoadLane( Stream( RotationX + i ), laneIdx );
+            }
+
+            for ( int32_t i = 0; i < 3; i++ )
+            {
+                outLanes.m_translation[i] = LoadLane( Stream( TranslationX + i ), laneIdx );
+            }
+
+            outLanes.m_scale = LoadLane( Scale, laneIdx );
+        }
+
+        // Store all the components for a given lane
+        EE_FORCE_INLINE void StoreLanes( int32_t laneIdx, TransformLanes const& lanes )
+        {
+            EE_ASSERT( laneIdx >= 0 && laneIdx < GetNumLanes() );
+            for ( int32_t i = 0; i < 4; i++ )
+            {
+                StoreLane( Stream( RotationX + i ), laneIdx, lanes.m_rotation[i] );
+            }
+
+            for ( int32_t i = 0; i < 3; i++ )
+            {
+                StoreLane( Stream( TranslationX + i ), laneIdx, lanes.m_translation[i] );
+            }
+
+            StoreLane( Scale, laneIdx, lanes.m_scale );
+        }
+
+        // Single transform access
+        //-------------------------------------------------------------------------
+
+        Transform GetTransform( int32_t idx ) const;
+        void SetTransform( int32_t idx, Transform const& transform );
+
+        // AoS conversion
+        //-------------------------------------------------------------------------
+
+        // Fill this buffer from a set of AoS transforms, the buffer will be resized to fit the supplied transforms
+        void FromTransforms( Transform const* pTransforms, int32_t numTransforms );
+        inline void FromTransforms( TVector<Transform> const& transforms ) { FromTransforms( transforms.data(), (int32_t) transforms.size() ); }
+
+        // Write out the contents of this buffer to a set of AoS transforms, the output array needs to be at least 'GetNumTransforms()' in size
+        void ToTransforms( Transform* pTransforms ) const;
+        inline void ToTransforms( TVector<Transform>& transforms ) const { transforms.resize( m_numTransforms ); ToTransforms( transforms.data() ); }
+
+    private:
+
+        float*                      m_pData = nullptr;          // Single 16 byte aligned allocation for all the streams
+        int32_t                     m_numTransforms = 0;
+        int32_t                     m_numPaddedTransforms = 0;
+    };
+
+    //-------------------------------------------------------------------------
+    // Lane helpers
+    //-------------------------------------------------------------------------
+
+    // Transpose up to 4 AoS transforms into SoA lanes, missing transforms are set to identity
+    EE_FORCE_INLINE void LoadTransformLanes( Transform const* pTransforms, int32_t numTransforms, TransformLanes& outLanes )
+    {
+        EE_ASSERT( numTransforms > 0 && numTransforms <= SoATransformBuffer::s_laneWidth );
+
+        __m128 rotations[SoATransformBuffer::s_laneWidth] = { Quaternion::Identity, Quaternion::Identity, Quaternion::Identity, Quaternion::Identity };
+        __m128 translationScales[SoATransformBuffer::s_laneWidth] = { Vector::UnitW, Vector::UnitW, Vector::UnitW, Vector::UnitW };
+
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            rotations[i] = pTransforms[i].GetRotation();
+            translationScales[i] = pTransforms[i].GetTranslation();
+        }
+
+        _MM_TRANSPOSE4_PS( rotations[0], rotations[1], rotations[2], rotations[3] );
+        _MM_TRANSPOSE4_PS( translationScales[0], translationScales[1], translationScales[2], translationScales[3] );
+
+        outLanes.m_rotation[0] = rotations[0];
+        outLanes.m_rotation[1] = rotations[1];
+        outLanes.m_rotation[2] = rotations[2];
+        outLanes.m_rotation[3] = rotations[3];
+        outLanes.m_translation[0] = translationScales[0];
+        outLanes.m_translation[1] = translationScales[1];
+        outLanes.m_translation[2] = translationScales[2];
+        outLanes.m_scale = translationScales[3];
+    }
+
+    // Transpose SoA lanes back into up to 4 AoS transforms
+    EE_FORCE_INLINE void StoreTransformLanes( TransformLanes const& lanes, Transform* pTransforms, int32_t numTransforms )
+    {
+        EE_ASSERT( numTransforms > 0 && numTransforms <= SoATransformBuffer::s_laneWidth );
+
+        __m128 rotations[SoATransformBuffer::s_laneWidth] = { lanes.m_rotation[0], lanes.m_rotation[1], lanes.m_rotation[2], lanes.m_rotation[3] };
+        __m128 translationScales[SoATransformBuffer::s_laneWidth] = { lanes.m_translation[0], lanes.m_translation[1], lanes.m_translation[2], lanes.m_scale };
+
+        _MM_TRANSPOSE4_PS( rotations[0], rotations[1], rotations[2], rotations[3] );
+        _MM_TRANSPOSE4_PS( translationScales[0], translationScales[1], translationScales[2], translationScales[3] );
+
+        for ( int32_t i = 0; i < numTransforms; i++ )
+        {
+            pTransforms[i] = Transform::FromRotationAndTranslationScale( Quaternion( Vector( rotations[i] ) ), Vector( translationScales[i] ) );
+        }
+    }
+
+    // Per-lane interpolation: shortest path normalized lerp for the rotation and a linear interpolation for the translation and scale
+    // The result may alias either of the inputs
+    EE_FORCE_INLINE void InterpolateTransformLanes( TransformLanes const& from, TransformLanes const& to, __m128 t, TransformLanes& outLanes )
+    {
+        // Ensure that the rotations are in the same direction
+        __m128 const dot = SIMD::MultiplyAdd( from.m_rotation[3], to.m_rotation[3], SIMD::MultiplyAdd( from.m_rotation[2], to.m_rotation[2], SIMD::MultiplyAdd( from.m_rotation[1], to.m_rotation[1], _mm_mul_ps( from.m_rotation[0], to.m_rotation[0] ) ) ) );
+        __m128 const sign = _mm_and_ps( dot, SIMD::g_signMask );
+
+        __m128 lengthSq = _mm_setzero_ps();
+        for ( int32_t i = 0; i < 4; i++ )
+        {
+            __m128 const adjustedFrom = _mm_xor_ps( from.m_rotation[i], sign );
+            outLanes.m_rotation[i] = SIMD::MultiplyAdd( _mm_sub_ps( to.m_rotation[i], adjustedFrom ), t, adjustedFrom );
+            lengthSq = SIMD::MultiplyAdd( outLanes.m_rotation[i], outLanes.m_rotation[i], lengthSq );
+        }
+
+        __m128 const invLength = _mm_div_ps( _mm_set1_ps( 1.0f ), _mm_sqrt_ps( lengthSq ) );
+        for ( int32_t i = 0; i < 4; i++ )
+        {
+            outLanes.m_rotation[i] = _mm_mul_ps( outLanes.m_rotation[i], invLength );
+        }
+
+        for ( int32_t i = 0; i < 3; i++ )
+        {
+            outLanes.m_translation[i] = SIMD::MultiplyAdd( _mm_sub_ps( to.m_translation[i], from.m_translation[i] ), t, from.m_translation[i] );
+        }
+
+        outLanes.m_scale = SIMD::MultiplyAdd( _mm_sub_ps( to.m_scale, from.m_scale ), t, from.m_scale );
+    }
+}
@@ -76,6 +76,71 @@ namespace EE::Animation
         m_pGraphInstance->ExecutePostPhysicsPoseTasks();
     }
 
+    void GraphComponent::SetPoseTaskScheduler( EE::TaskSystem* pTaskScheduler )
+    {
+        EE_ASSERT( HasGraph() );
+        m_pGraphInstance->SetPoseTaskScheduler( pTaskScheduler );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void GraphComponent::EvaluateCrowdGraph( Seconds deltaTime, Physics::PhysicsWorld* pPhysicsWorld )
+    {
+        EE_ASSERT( m_useCrowdUpdate && m_isCrowdUpdateRequested );
+        EvaluateGraph( deltaTime, m_crowdUpdateWorldTransform, pPhysicsWorld );
+    }
+
+    void GraphComponent::ExecuteCrowdPrePhysicsTasks()
+    {
+        EE_ASSERT( m_useCrowdUpdate && m_isCrowdUpdateRequested );
+
+        // The root motion is only applied to the entity in the post-physics stage, but the tasks need the final transform for this frame
+        Transform characterWorldTransform = m_crowdUpdateWorldTransform;
+        if ( m_applyRootMotionToEntity )
+        {
+            characterWorldTransform = m_rootMotionDelta * characterWorldTransform;
+        }
+
+        // Crowd instances are already updated in parallel, so each instance executes its tasks serially (crowd instances never get a pose task scheduler)
+        m_pGraphInstance->ExecutePrePhysicsPoseTasks( characterWorldTransform );
+        m_isCrowdUpdateRequested = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void GraphComponent::SetSkeletonLOD( int32_t lod )
+    {
+        EE_ASSERT( HasGraphInstance() );
+        int32_t const numLODs = GetSkeleton()->GetNumLODs();
+        m_pGraphInstance->SetSkeletonLOD( Math::Clamp( lod, 0, numLODs - 1 ) );
+    }
+
+    int32_t GraphComponent::GetSkeletonLOD() const
+    {
+        EE_ASSERT( HasGraphInstance() );
+        return m_pGraphInstance->GetSkeletonLOD();
+    }
+
+    void GraphComponent::UpdateSkeletonLOD( float screenHeightPercentage )
+    {
+        EE_ASSERT( HasGraphInstance() );
+
+        // Select the lowest detail LOD whose threshold we are below
+        int32_t lod = 0;
+        int32_t const numThresholds = (int32_t) m_skeletonLODScreenSizes.size();
+        for ( int32_t i = 0; i < numThresholds; i++ )
+        {
+            if ( screenHeightPercentage >= m_skeletonLODScreenSizes[i] )
+            {
+                break;
+            }
+
+            lod = i + 1;
+        }
+
+        SetSkeletonLOD( lod );
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
@@ -6,6 +6,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Animation
 {
     enum class TaskSystemDebugMode;
@@ -19,6 +23,7 @@ namespace EE::Animation
 
         friend class AnimationDebugView;
         friend class GraphController;
+        friend class AnimationWorldSystem;
 
     public:
 
@@ -66,6 +71,41 @@ namespace EE::Animation
         // The function will execute the post-physics tasks (if any)
         void ExecutePostPhysicsTasks();
 
+        // Set the scheduler used to execute independent pose tasks in parallel
+        void SetPoseTaskScheduler( EE::TaskSystem* pTaskScheduler );
+
+        // Crowd Update
+        //-------------------------------------------------------------------------
+        // Crowd components are not evaluated individually, instead the animation world system evaluates all of them in batches grouped by graph definition
+        // The entity system only requests the update and applies the resulting root motion in the post-physics stage
+
+        // Is this component evaluated as part of the batched crowd update?
+        inline bool UsesCrowdUpdate() const { return m_useCrowdUpdate; }
+
+        // Request a crowd update for this frame, starting from the supplied character transform
+        inline void RequestCrowdUpdate( Transform const& characterWorldTransform ) { m_crowdUpdateWorldTransform = characterWorldTransform; m_isCrowdUpdateRequested = true; }
+
+        // Has a crowd update been requested but not yet run?
+        inline bool IsCrowdUpdateRequested() const { return m_isCrowdUpdateRequested; }
+
+        // Evaluate the graph for a requested crowd update, using the character transform supplied with the request
+        void EvaluateCrowdGraph( Seconds deltaTime, Physics::PhysicsWorld* pPhysicsWorld );
+
+        // Execute the pre-physics tasks for a requested crowd update and complete the request
+        void ExecuteCrowdPrePhysicsTasks();
+
+        // Skeleton LOD
+        //-------------------------------------------------------------------------
+
+        // Explicitly set the skeleton LOD to use for the next evaluation (clamped to the skeleton's available LODs)
+        void SetSkeletonLOD( int32_t lod );
+
+        // Get the currently selected skeleton LOD
+        int32_t GetSkeletonLOD() const;
+
+        // Select the skeleton LOD based on how much of the screen the character covers (percentage of the screen height in the range [0, 1])
+        void UpdateSkeletonLOD( float screenHeightPercentage );
+
         // Control Parameters
         //-------------------------------------------------------------------------
 
@@ -139,6 +179,10 @@ namespace EE::Animation
         Transform                                               m_rootMotionDelta = Transform::Identity;
         EE_REFLECT() bool                                       m_requiresManualUpdate = false; // Does this component require a manual update via a custom entity system?
         EE_REFLECT() bool                                       m_applyRootMotionToEntity = false; // Should we apply the root motion delta automatically to the character once we evaluate the graph. (Note: only works if we dont require a manual update)
+        EE_REFLECT() TVector<float>                             m_skeletonLODScreenSizes; // The screen height percentages below which each successive skeleton LOD is used (i.e. element 0 is the threshold for LOD 1)
+        EE_REFLECT() bool                                       m_useCrowdUpdate = false; // Should this graph be evaluated in a batch with all other crowd graphs using the same graph definition
+        Transform                                               m_crowdUpdateWorldTransform = Transform::Identity;
         bool                                                    m_graphStateResetRequested = false;
+        bool                                                    m_isCrowdUpdateRequested = false;
     };
 }
\ No newline at end of file
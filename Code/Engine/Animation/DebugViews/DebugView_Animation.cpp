@@ -159,6 +159,10 @@ namespace EE::Animation
             return;
         }
 
+        TaskAllocator::Stats const& allocatorStats = pTaskSystem->GetTaskAllocatorStats();
+        ImGui::Text( "Task Memory: %.2fKB / %.2fKB (Peak: %.2fKB)", allocatorStats.m_usedMemory / 1024.0f, allocatorStats.m_capacity / 1024.0f, allocatorStats.m_highWaterMark / 1024.0f );
+        ImGui::Text( "Heap Allocations: %u this frame, %u total (Arena Growths: %u)", allocatorStats.m_numOverflowAllocations, allocatorStats.m_totalOverflowAllocations, allocatorStats.m_numArenaGrowths );
+
         if ( !pTaskSystem->HasTasks() )
         {
             ImGui::Text( "No Active Tasks" );
@@ -202,6 +202,13 @@ namespace EE::Animation
         m_pTaskSystem->SerializeTasks( LUTs, outBlob );
     }
 
+    void GraphInstance::SetSkeletonLOD( int32_t lod )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        EE_ASSERT( m_pGraphVariation->GetSkeleton()->IsValidLOD( lod ) );
+        m_skeletonLOD = lod;
+    }
+
     //-------------------------------------------------------------------------
 
     int32_t GraphInstance::GetExternalGraphSlotIndex( StringID slotID ) const
@@ -341,6 +348,7 @@ namespace EE::Animation
         if ( m_pTaskSystem != nullptr )
         {
             m_pTaskSystem->Reset();
+            m_pTaskSystem->SetSkeletonLOD( m_skeletonLOD );
         }
 
         m_graphContext.Update( deltaTime, startWorldTransform, pPhysicsWorld );
@@ -378,6 +386,7 @@ namespace EE::Animation
         if ( m_pTaskSystem != nullptr )
         {
             m_pTaskSystem->Reset();
+            m_pTaskSystem->SetSkeletonLOD( m_skeletonLOD );
         }
 
         m_graphContext.Update( deltaTime, startWorldTransform, pPhysicsWorld );
@@ -440,6 +449,12 @@ namespace EE::Animation
         #endif
     }
 
+    void GraphInstance::SetPoseTaskScheduler( EE::TaskSystem* pTaskScheduler )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        m_pTaskSystem->SetTaskScheduler( pTaskScheduler );
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
@@ -6,6 +6,11 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
 namespace EE::Physics
 {
     class PhysicsWorld;
@@ -75,6 +80,7 @@ namespace EE::Animation
         inline StringID const& GetVariationID() const { return m_pGraphVariation->m_dataSet.m_variationID; }
         inline ResourceID const& GetResourceID() const { return m_pGraphVariation->GetResourceID(); }
         inline ResourceID const& GetDefinitionResourceID() const { return m_pGraphVariation->m_pGraphDefinition->GetResourceID(); }
+        inline GraphDefinition const* GetGraphDefinition() const { return m_pGraphVariation->GetDefinition(); }
 
         // Returns the list of all resource LUTs used by this instance: the graph def + all connected external graphs
         void GetResourceLookupTables( TInlineVector<ResourceLUT const*, 10>& outLUTs ) const;
@@ -88,9 +94,17 @@ namespace EE::Animation
         // Does the task system have any pending pose tasks
         bool DoesTaskSystemNeedUpdate() const;
 
+        // Get the task system that all pose tasks are registered with (child graphs share their parent's task system)
+        inline TaskSystem* GetTaskSystem() const { return m_pTaskSystem; }
+
         // Serialize the currently registered pose tasks. Note: This can only be done after the task system has executed!
         void SerializeTaskList( Blob& outBlob ) const;
 
+        // Set the skeleton LOD to use for all pose tasks, this is applied at the start of the next graph evaluation
+        // Only standalone graph instances can set the LOD since child graphs share their parent's task system
+        void SetSkeletonLOD( int32_t lod );
+        inline int32_t GetSkeletonLOD() const { return m_skeletonLOD; }
+
         // Graph State
         //-------------------------------------------------------------------------
 
@@ -112,6 +126,9 @@ namespace EE::Animation
         // Execute any post-physics pose tasks
         void ExecutePostPhysicsPoseTasks();
 
+        // Set the scheduler used to execute independent pose tasks in parallel
+        void SetPoseTaskScheduler( EE::TaskSystem* pTaskScheduler );
+
         // Get the sampled events for the last update
         SampledEventsBuffer const& GetSampledEvents() const { return m_graphContext.m_sampledEventsBuffer; }
 
@@ -344,6 +361,7 @@ namespace EE::Animation
         uint64_t                                m_userID = 0; // An idea identifying the owner of this instance (usually the entity ID)
 
         TaskSystem*                             m_pTaskSystem = nullptr;
+        int32_t                                 m_skeletonLOD = 0;
         GraphContext                            m_graphContext;
         TVector<ChildGraph>                     m_childGraphs;
         TVector<ExternalGraph>                  m_externalGraphs;
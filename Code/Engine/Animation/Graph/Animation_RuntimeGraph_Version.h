@@ -5,5 +5,5 @@
 namespace EE::Animation
 {
     // This version needs to be bumped each time we change the layout of a runtime or tools node
-    static constexpr int const g_graphDataVersion = 4;
+    static constexpr int const g_graphDataVersion = 6;
 }
\ No newline at end of file
@@ -0,0 +1,380 @@
+#include "Animation_RuntimeGraphNode_ValuePrograms.h"
+#include "System/Math/NumericRange.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation::GraphNodes
+{
+    ValueProgram::Register ValueProgram::Execute( GraphContext& context, ValueNode* const* pInputNodes, int16_t programNodeIdx ) const
+    {
+        EE_ASSERT( IsValid() );
+
+        Register registers[s_maxRegisters];
+        float const* pConstants = m_constants.data();
+        Instruction const* pInstructions = m_instructions.data();
+        int32_t const numInstructions = (int32_t) m_instructions.size();
+
+        //-------------------------------------------------------------------------
+
+        int32_t pc = 0;
+        while ( pc < numInstructions )
+        {
+            Instruction const& instruction = pInstructions[pc++];
+            Register& result = registers[instruction.m_result];
+
+            switch ( instruction.m_opCode )
+            {
+                case OpCode::LoadFloatInput:
+                {
+                    result.m_float = pInputNodes[instruction.m_operandA]->GetValue<float>( context );
+                }
+                break;
+
+                case OpCode::LoadBoolInput:
+                {
+                    result.m_bool = pInputNodes[instruction.m_operandA]->GetValue<bool>( context );
+                }
+                break;
+
+                case OpCode::LoadFloatConstant:
+                {
+                    result.m_float = pConstants[instruction.m_operandA];
+                }
+                break;
+
+                case OpCode::LoadBoolConstant:
+                {
+                    result.m_bool = instruction.m_operandA != 0;
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case OpCode::Add:
+                {
+                    result.m_float = registers[instruction.m_operandA].m_float + registers[instruction.m_operandB].m_float;
+                }
+                break;
+
+                case OpCode::Sub:
+                {
+                    result.m_float = registers[instruction.m_operandA].m_float - registers[instruction.m_operandB].m_float;
+                }
+                break;
+
+                case OpCode::Mul:
+                {
+                    result.m_float = registers[instruction.m_operandA].m_float * registers[instruction.m_operandB].m_float;
+                }
+                break;
+
+                case OpCode::Div:
+                {
+                    if ( Math::IsNearZero( registers[instruction.m_operandB].m_float ) )
+                    {
+                        #if EE_DEVELOPMENT_TOOLS
+                        context.LogWarning( programNodeIdx, "Dividing by zero in value program" );
+                        #endif
+                        result.m_float = 0;
+                    }
+                    else
+                    {
+                        result.m_float = registers[instruction.m_operandA].m_float / registers[instruction.m_operandB].m_float;
+                    }
+                }
+                break;
+
+                case OpCode::Abs:
+                {
+                    result.m_float = Math::Abs( registers[instruction.m_operandA].m_float );
+                }
+                break;
+
+                case OpCode::Clamp:
+                {
+                    result.m_float = FloatRange( pConstants[instruction.m_operandB], pConstants[instruction.m_operandB + 1] ).GetClampedValue( registers[instruction.m_operandA].m_float );
+                }
+                break;
+
+                case OpCode::Remap:
+                {
+                    float const* pRanges = &pConstants[instruction.m_operandB];
+                    result.m_float = Math::RemapRange( registers[instruction.m_operandA].m_float, pRanges[0], pRanges[1], pRanges[2], pRanges[3] );
+                }
+                break;
+
+                case OpCode::AngleClampTo180:
+                {
+                    result.m_float = Degrees( registers[instruction.m_operandA].m_float ).GetClamped180().ToFloat();
+                }
+                break;
+
+                case OpCode::AngleClampTo360:
+                {
+                    result.m_float = Degrees( registers[instruction.m_operandA].m_float ).ClampPositive360().ToFloat();
+                }
+                break;
+
+                case OpCode::AngleFlipHemisphere:
+                {
+                    result.m_float = Degrees( registers[instruction.m_operandA].m_float - 180.0f ).GetClamped180().ToFloat();
+                }
+                break;
+
+                case OpCode::AngleFlipHemisphereNegate:
+                {
+                    result.m_float = -Degrees( registers[instruction.m_operandA].m_float - 180.0f ).GetClamped180().ToFloat();
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case OpCode::GreaterThanEqual:
+                {
+                    result.m_bool = registers[instruction.m_operandA].m_float >= registers[instruction.m_operandB].m_float;
+                }
+                break;
+
+                case OpCode::LessThanEqual:
+                {
+                    result.m_bool = registers[instruction.m_operandA].m_float <= registers[instruction.m_operandB].m_float;
+                }
+                break;
+
+                case OpCode::GreaterThan:
+                {
+                    result.m_bool = registers[instruction.m_operandA].m_float > registers[instruction.m_operandB].m_float;
+                }
+                break;
+
+                case OpCode::LessThan:
+                {
+                    result.m_bool = registers[instruction.m_operandA].m_float < registers[instruction.m_operandB].m_float;
+                }
+                break;
+
+                case OpCode::NearEqual:
+                {
+                    result.m_bool = Math::IsNearEqual( registers[instruction.m_operandA].m_float, registers[instruction.m_operandB].m_float, pConstants[instruction.m_operandC] );
+                }
+                break;
+
+                case OpCode::InRangeInclusive:
+                {
+                    result.m_bool = FloatRange( pConstants[instruction.m_operandB], pConstants[instruction.m_operandB + 1] ).ContainsInclusive( registers[instruction.m_operandA].m_float );
+                }
+                break;
+
+                case OpCode::InRangeExclusive:
+                {
+                    result.m_bool = FloatRange( pConstants[instruction.m_operandB], pConstants[instruction.m_operandB + 1] ).ContainsExclusive( registers[instruction.m_operandA].m_float );
+                }
+                break;
+
+                case OpCode::Not:
+                {
+                    result.m_bool = !registers[instruction.m_operandA].m_bool;
+                }
+                break;
+
+                case OpCode::Move:
+                {
+                    result = registers[instruction.m_operandA];
+                }
+                break;
+
+                //-------------------------------------------------------------------------
+
+                case OpCode::Jump:
+                {
+                    pc = instruction.m_operandA;
+                }
+                break;
+
+                case OpCode::JumpIfFalse:
+                {
+                    if ( !registers[instruction.m_operandA].m_bool )
+                    {
+                        pc = instruction.m_operandB;
+                    }
+                }
+                break;
+
+                case OpCode::JumpIfTrue:
+                {
+                    if ( registers[instruction.m_operandA].m_bool )
+                    {
+                        pc = instruction.m_operandB;
+                    }
+                }
+                break;
+            }
+        }
+
+        return registers[m_resultRegister];
+    }
+
+    //-------------------------------------------------------------------------
+
+    void FloatProgramNode::Settings::InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const
+    {
+        auto pNode = CreateNode<FloatProgramNode>( context, options );
+
+        pNode->m_inputValueNodes.reserve( m_inputValueNodeIndices.size() );
+        for ( auto inputNodeIdx : m_inputValueNodeIndices )
+        {
+            context.SetNodePtrFromIndex( inputNodeIdx, pNode->m_inputValueNodes.emplace_back( nullptr ) );
+        }
+        #if EE_DEVELOPMENT_TOOLS
+        context.SetOptionalNodePtrFromIndex( m_originalNodeIdx, pNode->m_pOriginalNode );
+        #endif
+    }
+
+    void FloatProgramNode::InitializeInternal( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() );
+        EE_ASSERT( GetSettings<FloatProgramNode>()->m_program.IsValid() );
+
+        FloatValueNode::InitializeInternal( context );
+
+        for ( auto pNode : m_inputValueNodes )
+        {
+            pNode->Initialize( context );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_pOriginalNode != nullptr )
+        {
+            m_pOriginalNode->Initialize( context );
+        }
+        #endif
+
+        m_value = 0.0f;
+    }
+
+    void FloatProgramNode::ShutdownInternal( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_pOriginalNode != nullptr )
+        {
+            m_pOriginalNode->Shutdown( context );
+        }
+        #endif
+
+        for ( auto pNode : m_inputValueNodes )
+        {
+            pNode->Shutdown( context );
+        }
+
+        FloatValueNode::ShutdownInternal( context );
+    }
+
+    void FloatProgramNode::GetValueInternal( GraphContext& context, void* pOutValue )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        if ( !WasUpdated( context ) )
+        {
+            MarkNodeActive( context );
+            m_value = GetSettings<FloatProgramNode>()->m_program.Execute( context, m_inputValueNodes.data(), GetNodeIndex() ).m_float;
+
+            // Evaluate the original network so that the inlined nodes are debuggable, all inputs have already been updated so this has no side-effects
+            #if EE_DEVELOPMENT_TOOLS
+            if ( m_pOriginalNode != nullptr )
+            {
+                float const originalValue = m_pOriginalNode->GetValue<float>( context );
+                if ( !Math::IsNearEqual( m_value, originalValue, Math::Max( 1.0f, Math::Abs( originalValue ) ) * 1.0e-5f ) && !( Math::IsNaN( m_value ) && Math::IsNaN( originalValue ) ) )
+                {
+                    context.LogError( GetNodeIndex(), "Value program result (%f) doesn't match the original network result (%f)", m_value, originalValue );
+                }
+            }
+            #endif
+        }
+
+        *reinterpret_cast<float*>( pOutValue ) = m_value;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void BoolProgramNode::Settings::InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const
+    {
+        auto pNode = CreateNode<BoolProgramNode>( context, options );
+
+        pNode->m_inputValueNodes.reserve( m_inputValueNodeIndices.size() );
+        for ( auto inputNodeIdx : m_inputValueNodeIndices )
+        {
+            context.SetNodePtrFromIndex( inputNodeIdx, pNode->m_inputValueNodes.emplace_back( nullptr ) );
+        }
+        #if EE_DEVELOPMENT_TOOLS
+        context.SetOptionalNodePtrFromIndex( m_originalNodeIdx, pNode->m_pOriginalNode );
+        #endif
+    }
+
+    void BoolProgramNode::InitializeInternal( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() );
+        EE_ASSERT( GetSettings<BoolProgramNode>()->m_program.IsValid() );
+
+        BoolValueNode::InitializeInternal( context );
+
+        for ( auto pNode : m_inputValueNodes )
+        {
+            pNode->Initialize( context );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_pOriginalNode != nullptr )
+        {
+            m_pOriginalNode->Initialize( context );
+        }
+        #endif
+
+        m_result = false;
+    }
+
+    void BoolProgramNode::ShutdownInternal( GraphContext& context )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_pOriginalNode != nullptr )
+        {
+            m_pOriginalNode->Shutdown( context );
+        }
+        #endif
+
+        for ( auto pNode : m_inputValueNodes )
+        {
+            pNode->Shutdown( context );
+        }
+
+        BoolValueNode::ShutdownInternal( context );
+    }
+
+    void BoolProgramNode::GetValueInternal( GraphContext& context, void* pOutValue )
+    {
+        EE_ASSERT( context.IsValid() );
+
+        if ( !WasUpdated( context ) )
+        {
+            MarkNodeActive( context );
+            m_result = GetSettings<BoolProgramNode>()->m_program.Execute( context, m_inputValueNodes.data(), GetNodeIndex() ).m_bool;
+
+            // Evaluate the original network so that the inlined nodes are debuggable, all inputs have already been updated so this has no side-effects
+            #if EE_DEVELOPMENT_TOOLS
+            if ( m_pOriginalNode != nullptr )
+            {
+                bool const originalResult = m_pOriginalNode->GetValue<bool>( context );
+                if ( m_result != originalResult )
+                {
+                    context.LogError( GetNodeIndex(), "Value program result (%s) doesn't match the original network result (%s)", m_result ? "true" : "false", originalResult ? "true" : "false" );
+                }
+            }
+            #endif
+        }
+
+        *( (bool*) pOutValue ) = m_result;
+    }
+}
@@ -0,0 +1,159 @@
+#pragma once
+#include "Engine/Animation/Graph/Animation_RuntimeGraph_Node.h"
+
+//-------------------------------------------------------------------------
+// Value Programs
+//-------------------------------------------------------------------------
+// Networks of pure value nodes (math, comparisons, logic ops, etc...) are lowered by the graph compiler into a flat register-based program.
+// The program is evaluated in a single loop by a program node that replaces the root of the network, which removes the virtual call and
+// update check per node. Any value node that cannot be lowered (parameters, stateful nodes, etc...) is treated as a program input and
+// is evaluated lazily through the regular node path, so short-circuiting and branch semantics are preserved.
+//
+// The original network is kept in the graph. In development builds it is evaluated alongside the program so that the inlined nodes are
+// still marked active and hold their values for the debugger, and the program result is validated against it.
+
+namespace EE::Animation::GraphNodes
+{
+    struct EE_ENGINE_API ValueProgram
+    {
+        EE_SERIALIZE( m_instructions, m_constants, m_numRegisters, m_resultRegister );
+
+        constexpr static int32_t const s_maxRegisters = 32;
+
+        enum class OpCode : uint8_t
+        {
+            LoadFloatInput,             // R = Input[A]
+            LoadBoolInput,              // R = Input[A]
+            LoadFloatConstant,          // R = Constant[A]
+            LoadBoolConstant,           // R = A != 0
+
+            Add,                        // R = A + B
+            Sub,                        // R = A - B
+            Mul,                        // R = A * B
+            Div,                        // R = A / B ( zero if B is near zero )
+            Abs,                        // R = |A|
+            Clamp,                      // R = Clamp( A, Constant[B], Constant[B + 1] )
+            Remap,                      // R = Remap( A, Constant[B], Constant[B + 1] ) -> ( Constant[B + 2], Constant[B + 3] )
+            AngleClampTo180,            // R = Clamp180( A )
+            AngleClampTo360,            // R = Clamp360( A )
+            AngleFlipHemisphere,        // R = Clamp180( A - 180 )
+            AngleFlipHemisphereNegate,  // R = -Clamp180( A - 180 )
+
+            GreaterThanEqual,           // R = A >= B
+            LessThanEqual,              // R = A <= B
+            GreaterThan,                // R = A > B
+            LessThan,                   // R = A < B
+            NearEqual,                  // R = |A - B| <= Constant[C]
+            InRangeInclusive,           // R = A in [Constant[B], Constant[B + 1]]
+            InRangeExclusive,           // R = A in (Constant[B], Constant[B + 1])
+            Not,                        // R = !A
+            Move,                       // R = A
+
+            Jump,                       // PC = A
+            JumpIfFalse,                // if ( !A ) PC = B
+            JumpIfTrue,                 // if ( A ) PC = B
+        };
+
+        struct Instruction
+        {
+            EE_SERIALIZE( m_opCode, m_result, m_operandA, m_operandB, m_operandC );
+
+            Instruction() = default;
+            Instruction( OpCode opCode, uint8_t result, uint16_t a = 0, uint16_t b = 0, uint16_t c = 0 ) : m_opCode( opCode ), m_result( result ), m_operandA( a ), m_operandB( b ), m_operandC( c ) {}
+
+            OpCode                      m_opCode = OpCode::Move;
+            uint8_t                     m_result = 0;
+            uint16_t                    m_operandA = 0;
+            uint16_t                    m_operandB = 0;
+            uint16_t                    m_operandC = 0;
+        };
+
+        union Register
+        {
+            float                       m_float;
+            bool                        m_bool;
+        };
+
+    public:
+
+        inline bool IsValid() const { return !m_instructions.empty() && m_numRegisters > 0 && m_numRegisters <= s_maxRegisters && m_resultRegister < m_numRegisters; }
+
+        // Run the program, the input nodes array needs to match the input indices used when compiling the program
+        Register Execute( GraphContext& context, ValueNode* const* pInputNodes, int16_t programNodeIdx ) const;
+
+    public:
+
+        TVector<Instruction>            m_instructions;
+        TVector<float>                  m_constants;
+        uint8_t                         m_numRegisters = 0;
+        uint8_t                         m_resultRegister = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API FloatProgramNode final : public FloatValueNode
+    {
+    public:
+
+        struct EE_ENGINE_API Settings final : public FloatValueNode::Settings
+        {
+            EE_REFLECT_TYPE( Settings );
+            EE_SERIALIZE_GRAPHNODESETTINGS( FloatValueNode::Settings, m_program, m_inputValueNodeIndices, m_originalNodeIdx );
+
+            virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
+
+            ValueProgram                    m_program;
+            TInlineVector<int16_t, 4>       m_inputValueNodeIndices;
+            int16_t                         m_originalNodeIdx = InvalidIndex; // The root of the network this program replaced
+        };
+
+    private:
+
+        virtual void InitializeInternal( GraphContext& context ) override;
+        virtual void ShutdownInternal( GraphContext& context ) override;
+        virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
+
+    private:
+
+        TInlineVector<ValueNode*, 4>        m_inputValueNodes;
+        float                               m_value = 0.0f;
+
+        #if EE_DEVELOPMENT_TOOLS
+        FloatValueNode*                     m_pOriginalNode = nullptr;
+        #endif
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API BoolProgramNode final : public BoolValueNode
+    {
+    public:
+
+        struct EE_ENGINE_API Settings final : public BoolValueNode::Settings
+        {
+            EE_REFLECT_TYPE( Settings );
+            EE_SERIALIZE_GRAPHNODESETTINGS( BoolValueNode::Settings, m_program, m_inputValueNodeIndices, m_originalNodeIdx );
+
+            virtual void InstantiateNode( InstantiationContext const& context, InstantiationOptions options ) const override;
+
+            ValueProgram                    m_program;
+            TInlineVector<int16_t, 4>       m_inputValueNodeIndices;
+            int16_t                         m_originalNodeIdx = InvalidIndex; // The root of the network this program replaced
+        };
+
+    private:
+
+        virtual void InitializeInternal( GraphContext& context ) override;
+        virtual void ShutdownInternal( GraphContext& context ) override;
+        virtual void GetValueInternal( GraphContext& context, void* pOutValue ) override;
+
+    private:
+
+        TInlineVector<ValueNode*, 4>        m_inputValueNodes;
+        bool                                m_result = false;
+
+        #if EE_DEVELOPMENT_TOOLS
+        BoolValueNode*                      m_pOriginalNode = nullptr;
+        #endif
+    };
+}
@@ -5,6 +5,8 @@
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "System/Render/RenderViewport.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/Profiling.h"
 #include "System/Log.h"
 
@@ -165,12 +167,45 @@ namespace EE::Animation
         }
     }
 
+    float AnimationSystem::CalculateScreenHeightPercentage( EntityWorldUpdateContext const& ctx ) const
+    {
+        // Without a viewport or a mesh, we have no idea how big we are on screen so always use the highest detail
+        Render::Viewport const* pViewport = ctx.GetViewport();
+        if ( pViewport == nullptr || m_meshComponents.empty() )
+        {
+            return 1.0f;
+        }
+
+        Math::ViewVolume const& viewVolume = pViewport->GetViewVolume();
+        OBB const& bounds = m_meshComponents[0]->GetWorldBounds();
+        float const boundsRadius = bounds.m_extents.GetLength3();
+
+        // Orthographic views have a constant world space height
+        if ( !viewVolume.IsPerspective() )
+        {
+            float const viewHeight = viewVolume.GetViewDimensions().m_y;
+            return ( viewHeight > 0.0f ) ? Math::Min( ( 2.0f * boundsRadius ) / viewHeight, 1.0f ) : 1.0f;
+        }
+
+        // Project the bounding sphere size at the bounds' depth along the view direction
+        float const depth = ( bounds.m_center - viewVolume.GetViewPosition() ).GetDot3( viewVolume.GetViewForwardVector() );
+        if ( depth <= boundsRadius )
+        {
+            return 1.0f;
+        }
+
+        float const halfViewHeight = depth * Math::Tan( (float) viewVolume.GetVerticalFOV() * 0.5f );
+        return Math::Min( boundsRadius / halfViewHeight, 1.0f );
+    }
+
     void AnimationSystem::UpdateAnimGraphs( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform )
     {
         UpdateStage const updateStage = ctx.GetUpdateStage();
         if ( updateStage == UpdateStage::PrePhysics )
         {
             auto pPhysicsWorldSystem = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>();
+            auto pTaskSystem = ctx.GetSystem<EE::TaskSystem>();
+            float const screenHeightPercentage = CalculateScreenHeightPercentage( ctx );
 
             //-------------------------------------------------------------------------
 
@@ -183,6 +218,16 @@ namespace EE::Animation
 
                 if ( !pAnimComponent->RequiresManualUpdate() )
                 {
+                    // Select the skeleton LOD for this evaluation
+                    pAnimComponent->UpdateSkeletonLOD( screenHeightPercentage );
+
+                    // Crowd graphs are evaluated in batches by the animation world system once all entities have been updated
+                    if ( pAnimComponent->UsesCrowdUpdate() )
+                    {
+                        pAnimComponent->RequestCrowdUpdate( characterWorldTransform );
+                        continue;
+                    }
+
                     // Evaluate the graph nodes and calculate the root motion delta
                     pAnimComponent->EvaluateGraph( ctx.GetDeltaTime(), characterWorldTransform, pPhysicsWorldSystem->GetWorld() );
 
@@ -200,6 +245,7 @@ namespace EE::Animation
                     }
 
                     // Calculate pose tasks
+                    pAnimComponent->SetPoseTaskScheduler( pTaskSystem );
                     pAnimComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), adjustedCharacterTransform );
                 }
             }
@@ -213,9 +259,23 @@ namespace EE::Animation
                     continue;
                 }
 
-                // Calculate the final pose tasks
                 if ( !pAnimComponent->RequiresManualUpdate() )
                 {
+                    // The crowd update runs after the pre-physics entity updates so its root motion can only be applied here
+                    if ( pAnimComponent->UsesCrowdUpdate() )
+                    {
+                        EE_ASSERT( !pAnimComponent->IsCrowdUpdateRequested() );
+
+                        if ( m_pRootComponent != nullptr && pAnimComponent->ShouldApplyRootMotionToEntity() )
+                        {
+                            Transform rootMotionDelta = pAnimComponent->GetRootMotionDelta();
+                            Transform worldTransform = m_pRootComponent->GetWorldTransform();
+                            worldTransform = rootMotionDelta * worldTransform;
+                            m_pRootComponent->SetWorldTransform( worldTransform );
+                        }
+                    }
+
+                    // Calculate the final pose tasks
                     pAnimComponent->ExecutePostPhysicsTasks();
                 }
 
@@ -42,6 +42,9 @@ namespace EE::Animation
         void UpdateAnimPlayers( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
         void UpdateAnimGraphs( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
 
+        // Calculate the percentage of the viewport height covered by the character's mesh bounds, used for skeleton LOD selection
+        float CalculateScreenHeightPercentage( EntityWorldUpdateContext const& ctx ) const;
+
     private:
 
         TVector<AnimationClipPlayerComponent*>          m_animPlayers;
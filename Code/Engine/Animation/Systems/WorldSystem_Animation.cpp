@@ -1,15 +1,123 @@
 #include "WorldSystem_Animation.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
+#include "Engine/Animation/TaskSystem/Animation_TaskSystem.h"
+#include "Engine/Animation/TaskSystem/Tasks/Animation_Task_Sample.h"
+#include "Engine/Animation/AnimationClip.h"
+#include "Engine/Animation/AnimationPose.h"
+#include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    namespace
+    {
+        // Evaluates the graphs for a range of crowd components, since the components are sorted by graph definition each range mostly walks the same node settings
+        struct CrowdEvaluationTask final : public ITaskSet
+        {
+            CrowdEvaluationTask( GraphComponent* const* pComponents, uint32_t numComponents, Seconds deltaTime, Physics::PhysicsWorld* pPhysicsWorld )
+                : m_pComponents( pComponents )
+                , m_deltaTime( deltaTime )
+                , m_pPhysicsWorld( pPhysicsWorld )
+            {
+                m_SetSize = numComponents;
+                m_MinRange = 4;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ANIMATION( "Crowd Evaluation Task" );
+
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    m_pComponents[i]->EvaluateCrowdGraph( m_deltaTime, m_pPhysicsWorld );
+                }
+            }
+
+        public:
+
+            GraphComponent* const*                  m_pComponents = nullptr;
+            Seconds                                 m_deltaTime;
+            Physics::PhysicsWorld*                  m_pPhysicsWorld = nullptr;
+        };
+
+        // Decodes each shared sample once
+        struct BatchedSamplingTask final : public ITaskSet
+        {
+            BatchedSamplingTask( AnimationWorldSystem::BatchedSample const* pSamples, uint32_t numSamples )
+                : m_pSamples( pSamples )
+            {
+                m_SetSize = numSamples;
+                m_MinRange = 4;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ANIMATION( "Batched Sampling Task" );
+
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    AnimationWorldSystem::BatchedSample const& sample = m_pSamples[i];
+                    sample.m_pPose->SetSkeletonLOD( sample.m_skeletonLOD );
+                    sample.m_pAnimation->GetPose( sample.m_time, sample.m_pPose );
+                }
+            }
+
+        public:
+
+            AnimationWorldSystem::BatchedSample const*  m_pSamples = nullptr;
+        };
+
+        // Executes the pre-physics pose tasks for a range of crowd components
+        struct CrowdPoseTask final : public ITaskSet
+        {
+            CrowdPoseTask( GraphComponent* const* pComponents, uint32_t numComponents )
+                : m_pComponents( pComponents )
+            {
+                m_SetSize = numComponents;
+                m_MinRange = 4;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ANIMATION( "Crowd Pose Task" );
+
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    m_pComponents[i]->ExecuteCrowdPrePhysicsTasks();
+                }
+            }
+
+        public:
+
+            GraphComponent* const*                  m_pComponents = nullptr;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<EE::TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+    }
+
     void AnimationWorldSystem::ShutdownSystem()
     {
         EE_ASSERT( m_graphComponents.empty() );
+
+        for ( auto& pPose : m_batchedSamplePoses )
+        {
+            EE::Delete( pPose );
+        }
+        m_batchedSamplePoses.clear();
+
+        m_pTaskSystem = nullptr;
     }
 
     void AnimationWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -28,8 +136,29 @@ namespace EE::Animation
         }
     }
 
+    bool AnimationWorldSystem::GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const
+    {
+        if ( stage == UpdateStage::PrePhysics )
+        {
+            outAccess.WritesComponent<GraphComponent>();
+            outAccess.ReadsWorldSystem<Physics::PhysicsWorldSystem>();
+            return true;
+        }
+
+        outAccess.ReadsComponent<GraphComponent>();
+        return true;
+    }
+
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        if ( ctx.GetUpdateStage() == UpdateStage::PrePhysics )
+        {
+            UpdateCrowds( ctx );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
         for ( auto pComponent : m_graphComponents )
@@ -38,4 +167,134 @@ namespace EE::Animation
         }
         #endif
     }
+
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::UpdateCrowds( EntityWorldUpdateContext const& ctx )
+    {
+        m_crowdUpdateList.clear();
+        for ( auto pComponent : m_graphComponents )
+        {
+            if ( pComponent->IsCrowdUpdateRequested() )
+            {
+                EE_ASSERT( pComponent->HasGraphInstance() );
+                m_crowdUpdateList.emplace_back( pComponent );
+            }
+        }
+
+        if ( m_crowdUpdateList.empty() )
+        {
+            return;
+        }
+
+        EE_PROFILE_SCOPE_ANIMATION( "Animation Crowd Update" );
+
+        // Group all instances by graph definition
+        auto SortByDefinition = [] ( GraphComponent const* pA, GraphComponent const* pB )
+        {
+            return pA->m_pGraphInstance->GetGraphDefinition() < pB->m_pGraphInstance->GetGraphDefinition();
+        };
+        eastl::sort( m_crowdUpdateList.begin(), m_crowdUpdateList.end(), SortByDefinition );
+
+        uint32_t const numComponents = (uint32_t) m_crowdUpdateList.size();
+        Seconds const deltaTime = ctx.GetDeltaTime();
+
+        // Evaluate all graphs, this registers the pose tasks for each instance
+        //-------------------------------------------------------------------------
+
+        {
+            auto pPhysicsWorldSystem = ctx.GetWorldSystem<Physics::PhysicsWorldSystem>();
+            CrowdEvaluationTask evaluationTask( m_crowdUpdateList.data(), numComponents, deltaTime, pPhysicsWorldSystem->GetWorld() );
+            m_pTaskSystem->ScheduleTask( &evaluationTask );
+            m_pTaskSystem->WaitForTask( &evaluationTask );
+        }
+
+        // Decode all shared samples once
+        //-------------------------------------------------------------------------
+
+        BatchSampleTasks();
+
+        if ( !m_batchedSamples.empty() )
+        {
+            BatchedSamplingTask samplingTask( m_batchedSamples.data(), (uint32_t) m_batchedSamples.size() );
+            m_pTaskSystem->ScheduleTask( &samplingTask );
+            m_pTaskSystem->WaitForTask( &samplingTask );
+        }
+
+        // Execute the pose tasks
+        //-------------------------------------------------------------------------
+
+        {
+            CrowdPoseTask poseTask( m_crowdUpdateList.data(), numComponents );
+            m_pTaskSystem->ScheduleTask( &poseTask );
+            m_pTaskSystem->WaitForTask( &poseTask );
+        }
+    }
+
+    void AnimationWorldSystem::BatchSampleTasks()
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Batch Sample Tasks" );
+
+        m_sampleRequests.clear();
+        m_batchedSamples.clear();
+
+        for ( auto pComponent : m_crowdUpdateList )
+        {
+            TaskSystem* pTaskSystem = pComponent->m_pGraphInstance->GetTaskSystem();
+            int32_t const skeletonLOD = pTaskSystem->GetSkeletonLOD();
+            for ( auto pTask : pTaskSystem->GetRegisteredTasks() )
+            {
+                if ( Tasks::SampleTask::IsSampleTask( pTask ) )
+                {
+                    auto pSampleTask = static_cast<Tasks::SampleTask*>( pTask );
+                    m_sampleRequests.push_back( { pSampleTask->GetAnimation(), pSampleTask->GetTime(), skeletonLOD, pSampleTask } );
+                }
+            }
+        }
+
+        eastl::sort( m_sampleRequests.begin(), m_sampleRequests.end() );
+
+        //-------------------------------------------------------------------------
+
+        // Only samples requested more than once are batched, unique samples are cheaper to decode directly into the task's pose buffer
+        int32_t const numRequests = (int32_t) m_sampleRequests.size();
+        int32_t runStartIdx = 0;
+        while ( runStartIdx < numRequests )
+        {
+            SampleRequest const& request = m_sampleRequests[runStartIdx];
+
+            int32_t runEndIdx = runStartIdx + 1;
+            while ( runEndIdx < numRequests && m_sampleRequests[runEndIdx].IsSameSample( request ) )
+            {
+                runEndIdx++;
+            }
+
+            if ( ( runEndIdx - runStartIdx ) > 1 )
+            {
+                // Reuse the pose storage from previous frames where possible
+                int32_t const batchedSampleIdx = (int32_t) m_batchedSamples.size();
+                Skeleton const* pSkeleton = request.m_pAnimation->GetSkeleton();
+                if ( batchedSampleIdx == m_batchedSamplePoses.size() )
+                {
+                    m_batchedSamplePoses.emplace_back( EE::New<Pose>( pSkeleton ) );
+                }
+                else if ( m_batchedSamplePoses[batchedSampleIdx]->GetSkeleton() != pSkeleton )
+                {
+                    EE::Delete( m_batchedSamplePoses[batchedSampleIdx] );
+                    m_batchedSamplePoses[batchedSampleIdx] = EE::New<Pose>( pSkeleton );
+                }
+
+                Pose* pPose = m_batchedSamplePoses[batchedSampleIdx];
+                m_batchedSamples.push_back( { request.m_pAnimation, request.m_time, request.m_skeletonLOD, pPose } );
+
+                // The poses stay valid until the next crowd update, so tasks that end up running post-physics can still use them
+                for ( int32_t i = runStartIdx; i < runEndIdx; i++ )
+                {
+                    m_sampleRequests[i].m_pTask->SetPreSampledPose( pPose );
+                }
+            }
+
+            runStartIdx = runEndIdx;
+        }
+    }
 }
\ No newline at end of file
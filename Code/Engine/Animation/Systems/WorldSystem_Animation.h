@@ -3,14 +3,27 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "System/Types/IDVector.h"
+#include "System/Types/Percentage.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
     class GraphComponent;
+    class AnimationClip;
+    class Pose;
+    namespace Tasks { class SampleTask; }
 
     //-------------------------------------------------------------------------
+    // Animation World System
+    //-------------------------------------------------------------------------
+    // Besides debug drawing, this system performs the crowd update for all graph components that opted into it:
+    // Instances are grouped by graph definition and evaluated in parallel, identical clip samples across all instances are
+    // deduplicated and decoded once in a single wide job, and finally the pre-physics pose tasks are executed per instance.
 
     class AnimationWorldSystem : public IEntityWorldSystem
     {
@@ -18,7 +31,39 @@ namespace EE::Animation
 
     public:
 
-        EE_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ) );
+        // A single sample task request from a crowd instance
+        struct SampleRequest
+        {
+            inline bool operator<( SampleRequest const& rhs ) const
+            {
+                if ( m_pAnimation != rhs.m_pAnimation ) return m_pAnimation < rhs.m_pAnimation;
+                if ( m_skeletonLOD != rhs.m_skeletonLOD ) return m_skeletonLOD < rhs.m_skeletonLOD;
+                return (float) m_time < (float) rhs.m_time;
+            }
+
+            inline bool IsSameSample( SampleRequest const& rhs ) const
+            {
+                return m_pAnimation == rhs.m_pAnimation && m_skeletonLOD == rhs.m_skeletonLOD && m_time == rhs.m_time;
+            }
+
+        public:
+
+            AnimationClip const*                            m_pAnimation = nullptr;
+            Percentage                                      m_time = 0.0f;
+            int32_t                                         m_skeletonLOD = 0;
+            Tasks::SampleTask*                              m_pTask = nullptr;
+        };
+
+        // A sample shared by multiple requests, decoded once into a pose owned by this system
+        struct BatchedSample
+        {
+            AnimationClip const*                            m_pAnimation = nullptr;
+            Percentage                                      m_time = 0.0f;
+            int32_t                                         m_skeletonLOD = 0;
+            Pose*                                           m_pPose = nullptr;
+        };
+
+        EE_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::FrameEnd ) );
 
         #if EE_DEVELOPMENT_TOOLS
         inline TVector<GraphComponent*> const& GetRegisteredGraphComponents() const { return m_graphComponents.GetVector(); }
@@ -26,13 +71,28 @@ namespace EE::Animation
 
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const override;
+
+        // Evaluate all requested crowd graphs and execute their pre-physics pose tasks
+        void UpdateCrowds( EntityWorldUpdateContext const& ctx );
+
+        // Find all sample tasks that are shared between crowd instances and point them to a single batched sample
+        void BatchSampleTasks();
 
     private:
 
-        TIDVector<ComponentID, GraphComponent*>          m_graphComponents;
+        TIDVector<ComponentID, GraphComponent*>             m_graphComponents;
+        EE::TaskSystem*                                     m_pTaskSystem = nullptr;
+
+        // Crowd update
+        TVector<GraphComponent*>                            m_crowdUpdateList;
+        TVector<SampleRequest>                              m_sampleRequests;
+        TVector<BatchedSample>                              m_batchedSamples;
+        TVector<Pose*>                                      m_batchedSamplePoses;
     };
-} 
\ No newline at end of file
+}
\ No newline at end of file
@@ -73,6 +73,10 @@ namespace EE::Animation
         // Do we have a dependency on the physics simulation?
         inline bool	HasPhysicsDependency() const { return m_updateStage != TaskUpdateStage::Any; }
 
+        // Can this task be executed on a worker thread concurrently with other independent tasks?
+        // Only tasks that exclusively touch their own state, their dependencies' results and the pose pool should return true
+        virtual bool AllowsParallelExecution() const { return false; }
+
         // Serialization
         //-------------------------------------------------------------------------
 
@@ -0,0 +1,101 @@
+#include "Animation_TaskAllocator.h"
+#include "System/Math/Math.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    TaskAllocator::TaskAllocator( size_t initialCapacity )
+        : m_capacity( Math::RoundUpToNearestMultiple64( initialCapacity, s_alignment ) )
+    {
+        EE_ASSERT( initialCapacity > 0 );
+        m_pArena = (uint8_t*) EE::Alloc( m_capacity, s_alignment );
+        m_stats.m_capacity = m_capacity;
+    }
+
+    TaskAllocator::~TaskAllocator()
+    {
+        EE_ASSERT( m_usedMemory == 0 && m_overflowAllocations.empty() );
+        EE::Free( m_pArena );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void* TaskAllocator::Allocate( size_t size )
+    {
+        size_t const alignedSize = Math::RoundUpToNearestMultiple64( size, s_alignment );
+
+        // Arena
+        if ( m_usedMemory + alignedSize <= m_capacity )
+        {
+            void* pMemory = m_pArena + m_usedMemory;
+            m_usedMemory += alignedSize;
+            m_stats.m_numArenaAllocations++;
+            UpdateUsageStats();
+            return pMemory;
+        }
+
+        // Overflow - fallback to the heap
+        void* pMemory = EE::Alloc( alignedSize, s_alignment );
+        m_overflowAllocations.emplace_back( pMemory );
+        m_overflowMemory += alignedSize;
+        m_stats.m_numOverflowAllocations++;
+        m_stats.m_totalOverflowAllocations++;
+        UpdateUsageStats();
+        return pMemory;
+    }
+
+    void TaskAllocator::Release( void* pMemory )
+    {
+        if ( IsArenaAllocation( pMemory ) )
+        {
+            return;
+        }
+
+        auto iter = VectorFind( m_overflowAllocations, pMemory );
+        EE_ASSERT( iter != m_overflowAllocations.end() );
+        m_overflowAllocations.erase_unsorted( iter );
+        EE::Free( pMemory );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void TaskAllocator::Reset()
+    {
+        EE_ASSERT( m_overflowAllocations.empty() );
+
+        // If we overflowed, grow the arena so that next frame's allocations fit
+        if ( m_overflowMemory > 0 )
+        {
+            size_t const requiredCapacity = Math::RoundUpToNearestMultiple64( m_stats.m_highWaterMark, s_alignment );
+            m_capacity = Math::Max( m_capacity * 2, requiredCapacity );
+
+            EE::Free( m_pArena );
+            m_pArena = (uint8_t*) EE::Alloc( m_capacity, s_alignment );
+
+            m_stats.m_capacity = m_capacity;
+            m_stats.m_numArenaGrowths++;
+        }
+
+        m_usedMemory = 0;
+        m_overflowMemory = 0;
+        m_stats.m_usedMemory = 0;
+        m_stats.m_numArenaAllocations = 0;
+        m_stats.m_numOverflowAllocations = 0;
+    }
+
+    void TaskAllocator::RewindToMarker( size_t marker )
+    {
+        EE_ASSERT( marker <= m_usedMemory );
+        m_usedMemory = marker;
+        m_stats.m_usedMemory = m_usedMemory;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void TaskAllocator::UpdateUsageStats()
+    {
+        m_stats.m_usedMemory = m_usedMemory;
+        m_stats.m_highWaterMark = Math::Max( m_stats.m_highWaterMark, m_usedMemory + m_overflowMemory );
+    }
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Animation Task Allocator
+//-------------------------------------------------------------------------
+// A linear (bump) arena used for all the tasks registered with a task system during a frame
+// All allocations are released at once when the task system is reset, or rewound when the task list is rolled back
+// If the arena overflows, we fall back to the heap for the remainder of the frame and grow the arena on the next reset
+
+namespace EE::Animation
+{
+    class EE_ENGINE_API TaskAllocator
+    {
+        constexpr static size_t const s_defaultCapacity = 4096;
+        constexpr static size_t const s_alignment = 16;
+
+    public:
+
+        struct Stats
+        {
+            size_t      m_capacity = 0;                     // Current arena size
+            size_t      m_usedMemory = 0;                   // Memory currently allocated from the arena
+            size_t      m_highWaterMark = 0;                // The most memory ever requested in a single frame (arena + overflow)
+            uint32_t    m_numArenaAllocations = 0;          // Allocations served by the arena since the last reset
+            uint32_t    m_numOverflowAllocations = 0;       // Heap allocations made since the last reset (should be 0 in steady state)
+            uint32_t    m_totalOverflowAllocations = 0;     // Heap allocations made over the lifetime of the allocator
+            uint32_t    m_numArenaGrowths = 0;              // Number of times the arena had to be resized
+        };
+
+    public:
+
+        TaskAllocator( size_t initialCapacity = s_defaultCapacity );
+        ~TaskAllocator();
+
+        TaskAllocator( TaskAllocator const& ) = delete;
+        TaskAllocator& operator=( TaskAllocator const& ) = delete;
+
+        // Allocation
+        //-------------------------------------------------------------------------
+
+        template< typename T, typename ... ConstructorParams >
+        [[nodiscard]] inline T* New( ConstructorParams&&... params )
+        {
+            static_assert( alignof( T ) <= s_alignment, "Task alignment exceeds the arena alignment" );
+            void* pMemory = Allocate( sizeof( T ) );
+            return new( pMemory ) T( std::forward<ConstructorParams>( params )... );
+        }
+
+        // Destroy an object allocated from this allocator, the arena memory is only reclaimed on reset or rollback
+        template< typename T >
+        inline void Delete( T* pObject )
+        {
+            EE_ASSERT( pObject != nullptr );
+            pObject->~T();
+            Release( pObject );
+        }
+
+        [[nodiscard]] void* Allocate( size_t size );
+
+        // Is this address within the arena (i.e. not an overflow allocation)
+        inline bool IsArenaAllocation( void const* pMemory ) const { return pMemory >= m_pArena && pMemory < ( m_pArena + m_capacity ); }
+
+        // Reset
+        //-------------------------------------------------------------------------
+
+        // Release all allocations, this will grow the arena if we overflowed since the last reset
+        // Note: all objects must already be destroyed
+        void Reset();
+
+        // Markers allow rewinding the arena to a previous state, all objects allocated after the marker must already be destroyed
+        inline size_t GetMarker() const { return m_usedMemory; }
+        inline size_t GetMarker( void const* pArenaAllocation ) const { EE_ASSERT( IsArenaAllocation( pArenaAllocation ) ); return (uint8_t const*) pArenaAllocation - m_pArena; }
+        void RewindToMarker( size_t marker );
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        inline Stats const& GetStats() const { return m_stats; }
+
+    private:
+
+        // Free overflow allocations immediately, arena allocations are reclaimed via reset/rewind
+        void Release( void* pMemory );
+
+        void UpdateUsageStats();
+
+    private:
+
+        uint8_t*                    m_pArena = nullptr;
+        size_t                      m_capacity = 0;
+        size_t                      m_usedMemory = 0;
+        size_t                      m_overflowMemory = 0;               // Memory requested via the overflow path since the last reset
+        TVector<void*>              m_overflowAllocations;              // Live heap allocations
+        Stats                       m_stats;
+    };
+}
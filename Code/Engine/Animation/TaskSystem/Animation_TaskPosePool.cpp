@@ -74,15 +74,53 @@ namespace EE::Animation
         #endif
     }
 
+    void PoseBufferPool::SetSkeletonLOD( int32_t lod )
+    {
+        EE_ASSERT( m_pSkeleton->IsValidLOD( lod ) );
+        EE_ASSERT( !m_isParallelCheckoutActive );
+
+        if ( lod == m_skeletonLOD )
+        {
+            return;
+        }
+
+        m_skeletonLOD = lod;
+
+        for ( auto& poseBuffer : m_poseBuffers )
+        {
+            poseBuffer.m_pose.SetSkeletonLOD( lod );
+        }
+
+        for ( auto& cachedBuffer : m_cachedBuffers )
+        {
+            cachedBuffer.m_pose.SetSkeletonLOD( lod );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        for ( auto& debugBuffer : m_debugBuffers )
+        {
+            debugBuffer.SetSkeletonLOD( lod );
+        }
+        #endif
+    }
+
     int8_t PoseBufferPool::RequestPoseBuffer()
     {
+        Threading::Lock lock( m_checkoutMutex, std::defer_lock );
+        if ( m_isParallelCheckoutActive )
+        {
+            lock.lock();
+        }
+
+        //-------------------------------------------------------------------------
+
         if ( m_firstFreeBuffer == m_poseBuffers.size() )
         {
             for ( auto i = 0; i < s_bufferGrowAmount; i++ )
             {
-                m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
+                m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) ).m_pose.SetSkeletonLOD( m_skeletonLOD );
             }
-            EE_ASSERT( m_poseBuffers.size() < 255 );
+            EE_ASSERT( m_poseBuffers.size() <= s_maxBuffers );
         }
 
         int8_t const freeBufferIdx = m_firstFreeBuffer;
@@ -104,11 +142,38 @@ namespace EE::Animation
 
     void PoseBufferPool::ReleasePoseBuffer( int8_t bufferIdx )
     {
+        Threading::Lock lock( m_checkoutMutex, std::defer_lock );
+        if ( m_isParallelCheckoutActive )
+        {
+            lock.lock();
+        }
+
+        //-------------------------------------------------------------------------
+
         EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
         m_poseBuffers[bufferIdx].m_isUsed = false;
         m_firstFreeBuffer = Math::Min( bufferIdx, m_firstFreeBuffer );
     }
 
+    void PoseBufferPool::BeginParallelCheckout()
+    {
+        EE_ASSERT( !m_isParallelCheckoutActive );
+
+        // Reserve the max number of buffers, this ensures that adding buffers will never move the existing ones
+        if ( m_poseBuffers.capacity() < s_maxBuffers )
+        {
+            m_poseBuffers.reserve( s_maxBuffers );
+        }
+
+        m_isParallelCheckoutActive = true;
+    }
+
+    void PoseBufferPool::EndParallelCheckout()
+    {
+        EE_ASSERT( m_isParallelCheckoutActive );
+        m_isParallelCheckoutActive = false;
+    }
+
     UUID PoseBufferPool::CreateCachedPoseBuffer()
     {
         CachedPoseBuffer* pCachedPoseBuffer = nullptr;
@@ -118,6 +183,7 @@ namespace EE::Animation
             for ( auto i = 0; i < s_bufferGrowAmount; i++ )
             {
                 pCachedPoseBuffer = &m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
+                pCachedPoseBuffer->m_pose.SetSkeletonLOD( m_skeletonLOD );
             }
 
             EE_ASSERT( m_cachedBuffers.size() < 255 );
@@ -207,12 +273,18 @@ namespace EE::Animation
             return;
         }
 
+        Threading::Lock lock( m_checkoutMutex, std::defer_lock );
+        if ( m_isParallelCheckoutActive )
+        {
+            lock.lock();
+        }
+
         // If we are out of buffers, add additional debug buffers
         if ( m_firstFreeDebugBuffer == m_debugBuffers.size() )
         {
             for ( auto i = 0; i < s_bufferGrowAmount; i++ )
             {
-                m_debugBuffers.emplace_back( Pose( m_pSkeleton ) );
+                m_debugBuffers.emplace_back( Pose( m_pSkeleton ) ).SetSkeletonLOD( m_skeletonLOD );
                 m_debugBufferTaskIdxMapping.emplace_back( int8_t( -1 ) );
             }
 
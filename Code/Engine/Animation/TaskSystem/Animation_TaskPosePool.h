@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Animation/AnimationPose.h"
+#include "System/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -56,6 +57,7 @@ namespace EE::Animation
     {
         constexpr static int8_t const s_numInitialBuffers = 6;
         constexpr static int8_t const s_bufferGrowAmount = 3;
+        constexpr static int8_t const s_maxBuffers = 127;
 
     public:
 
@@ -64,12 +66,25 @@ namespace EE::Animation
 
         void Reset();
 
+        // Set the skeleton LOD for all pose buffers, this must not be changed while tasks are being executed
+        void SetSkeletonLOD( int32_t lod );
+        inline int32_t GetSkeletonLOD() const { return m_skeletonLOD; }
+
         // Poses
         //-------------------------------------------------------------------------
 
         int8_t RequestPoseBuffer();
         void ReleasePoseBuffer( int8_t bufferIdx );
 
+        // Parallel Checkout
+        //-------------------------------------------------------------------------
+        // While parallel checkout is active, pose buffers can be requested/released from multiple threads
+        // The buffer storage is reserved up front so growing the pool never invalidates buffers handed out to other threads
+
+        void BeginParallelCheckout();
+        void EndParallelCheckout();
+        inline bool IsParallelCheckoutActive() const { return m_isParallelCheckoutActive; }
+
         inline PoseBuffer* GetBuffer( int8_t bufferIdx )
         {
             EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
@@ -98,11 +113,14 @@ namespace EE::Animation
     private:
 
         Skeleton const*                             m_pSkeleton = nullptr;
+        int32_t                                     m_skeletonLOD = 0;
         TVector<PoseBuffer>                         m_poseBuffers;
         TVector<CachedPoseBuffer>                   m_cachedBuffers;
         TInlineVector<UUID, 5>                      m_cachedPoseBuffersToDestroy;
         int8_t                                      m_firstFreeCachedBuffer = 0;
         int8_t                                      m_firstFreeBuffer = 0;
+        Threading::Mutex                            m_checkoutMutex;
+        bool                                        m_isParallelCheckoutActive = false;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<Pose>                               m_debugBuffers;
@@ -1,4 +1,5 @@
 #include "Animation_TaskSerializer.h"
+#include "Animation_TaskAllocator.h"
 #include "Engine/Animation/AnimationSkeleton.h"
 #include "System/Encoding/Quantization.h"
 
@@ -41,14 +42,14 @@ namespace EE::Animation
         return 0xFF;
     }
 
-    Task* TaskSerializer::CreateTask( uint8_t serializedTaskTypeID )
+    Task* TaskSerializer::CreateTask( TaskAllocator& allocator, uint8_t serializedTaskTypeID )
     {
         switch ( serializedTaskTypeID )
         {
             // DefaultPoseTask
             case 0:
             {
-                Task* pTask = (Task*) EE::Alloc( sizeof( Tasks::DefaultPoseTask ) );
+                Task* pTask = (Task*) allocator.Allocate( sizeof( Tasks::DefaultPoseTask ) );
                 new ( pTask ) Tasks::DefaultPoseTask();
                 return pTask;
             }
@@ -57,7 +58,7 @@ namespace EE::Animation
             // SampleTask
             case 1:
             {
-                Task* pTask = (Task*) EE::Alloc( sizeof( Tasks::SampleTask ) );
+                Task* pTask = (Task*) allocator.Allocate( sizeof( Tasks::SampleTask ) );
                 new ( pTask ) Tasks::SampleTask();
                 return pTask;
             }
@@ -66,7 +67,7 @@ namespace EE::Animation
             // BlendTask
             case 2:
             {
-                Task* pTask = (Task*) EE::Alloc( sizeof( Tasks::BlendTask ) );
+                Task* pTask = (Task*) allocator.Allocate( sizeof( Tasks::BlendTask ) );
                 new ( pTask ) Tasks::BlendTask();
                 return pTask;
             }
@@ -7,6 +7,7 @@
 namespace EE::Animation
 {
     class Task;
+    class TaskAllocator;
     class Skeleton;
 
     //-------------------------------------------------------------------------
@@ -26,7 +27,7 @@ namespace EE::Animation
 
         static uint8_t GetNumTaskTypes();
         static uint8_t GetSerializedTaskTypeID( Task const* pTask );
-        static Task* CreateTask( uint8_t serializedTaskTypeID );
+        static Task* CreateTask( TaskAllocator& allocator, uint8_t serializedTaskTypeID );
 
     public:
 
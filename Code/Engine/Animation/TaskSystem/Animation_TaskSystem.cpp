@@ -4,6 +4,7 @@
 #include "System/Log.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Profiling.h"
+#include "System/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
 
@@ -28,25 +29,47 @@ namespace EE::Animation
     {
         for ( auto pTask : m_tasks )
         {
-            EE::Delete( pTask );
+            m_taskAllocator.Delete( pTask );
         }
 
         m_tasks.clear();
+        m_taskAllocator.Reset();
         m_posePool.Reset();
         m_hasPhysicsDependency = false;
     }
 
+    void TaskSystem::SetSkeletonLOD( int32_t lod )
+    {
+        EE_ASSERT( m_tasks.empty() );
+        m_posePool.SetSkeletonLOD( lod );
+        m_finalPose.SetSkeletonLOD( lod );
+    }
+
     //-------------------------------------------------------------------------
 
     void TaskSystem::RollbackToTaskIndexMarker( TaskIndex const marker )
     {
         EE_ASSERT( marker >= 0 && marker <= m_tasks.size() );
 
+        if ( marker == m_tasks.size() )
+        {
+            return;
+        }
+
+        // Tasks are allocated in order so we can rewind the arena to the earliest arena allocated task that we remove
+        size_t allocatorMarker = m_taskAllocator.GetMarker();
         for ( int16_t t = (int16_t) m_tasks.size() - 1; t >= marker; t-- )
         {
-            EE::Delete( m_tasks[t] );
-            m_tasks.erase( m_tasks.begin() + t );
+            if ( m_taskAllocator.IsArenaAllocation( m_tasks[t] ) )
+            {
+                allocatorMarker = Math::Min( allocatorMarker, m_taskAllocator.GetMarker( m_tasks[t] ) );
+            }
+
+            m_taskAllocator.Delete( m_tasks[t] );
         }
+
+        m_tasks.resize( marker );
+        m_taskAllocator.RewindToMarker( allocatorMarker );
     }
 
     //-------------------------------------------------------------------------
@@ -130,17 +153,7 @@ namespace EE::Animation
             {
                 for ( TaskIndex prePhysicsTaskIdx : m_prePhysicsTaskIndices )
                 {
-                    m_taskContext.m_currentTaskIdx = prePhysicsTaskIdx;
-
-                    // Set dependencies
-                    m_taskContext.m_dependencies.clear();
-                    for ( auto depTaskIdx : m_tasks[prePhysicsTaskIdx]->GetDependencyIndices() )
-                    {
-                        EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
-                        m_taskContext.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
-                    }
-
-                    m_tasks[prePhysicsTaskIdx]->Execute( m_taskContext );
+                    ExecuteTask( prePhysicsTaskIdx, m_taskContext );
                 }
             }
         }
@@ -202,29 +215,205 @@ namespace EE::Animation
         }
     }
 
+    void TaskSystem::ExecuteTask( TaskIndex taskIdx, TaskContext& context )
+    {
+        EE_ASSERT( taskIdx >= 0 && taskIdx < m_tasks.size() );
+        context.m_currentTaskIdx = taskIdx;
+
+        // Set dependencies
+        context.m_dependencies.clear();
+        for ( auto DepTaskIdx : m_tasks[taskIdx]->GetDependencyIndices() )
+        {
+            EE_ASSERT( m_tasks[DepTaskIdx]->IsComplete() );
+            context.m_dependencies.emplace_back( m_tasks[DepTaskIdx] );
+        }
+
+        // Execute task
+        m_tasks[taskIdx]->Execute( context );
+    }
+
     void TaskSystem::ExecuteTasks()
     {
-        int16_t const numTasks = (int8_t) m_tasks.size();
-        for ( TaskIndex i = 0; i < numTasks; i++ )
+        if ( !TryExecuteTasksInParallel() )
         {
-            if ( !m_tasks[i]->IsComplete() )
+            int16_t const numTasks = (int8_t) m_tasks.size();
+            for ( TaskIndex i = 0; i < numTasks; i++ )
             {
-                m_taskContext.m_currentTaskIdx = i;
+                if ( !m_tasks[i]->IsComplete() )
+                {
+                    ExecuteTask( i, m_taskContext );
+                }
+            }
+        }
 
-                // Set dependencies
-                m_taskContext.m_dependencies.clear();
-                for ( auto DepTaskIdx : m_tasks[i]->GetDependencyIndices() )
+        m_needsUpdate = false;
+    }
+
+    bool TaskSystem::TryExecuteTasksInParallel()
+    {
+        if ( m_pTaskScheduler == nullptr || m_pTaskScheduler->GetNumWorkers() <= 1 )
+        {
+            return false;
+        }
+
+        int16_t const numTasks = (int16_t) m_tasks.size();
+        if ( numTasks < s_minTasksForParallelExecution )
+        {
+            return false;
+        }
+
+        // Assign each pending task to an execution level
+        //-------------------------------------------------------------------------
+        // A task's level is one greater than the highest level of its pending dependencies, so all tasks within a level are independent of each other
+        // Tasks that dont allow parallel execution are additionally chained to each other so that they still execute serially and in registration order
+
+        TInlineVector<int16_t, 64> taskLevels;
+        taskLevels.resize( numTasks, InvalidIndex );
+
+        TInlineVector<int16_t, 32> numParallelTasksPerLevel;
+        int16_t lastSerialTaskLevel = InvalidIndex;
+
+        for ( int16_t i = 0; i < numTasks; i++ )
+        {
+            Task const* pTask = m_tasks[i];
+            if ( pTask->IsComplete() )
+            {
+                continue;
+            }
+
+            int16_t level = 0;
+            for ( auto depTaskIdx : pTask->GetDependencyIndices() )
+            {
+                if ( !m_tasks[depTaskIdx]->IsComplete() )
                 {
-                    EE_ASSERT( m_tasks[DepTaskIdx]->IsComplete() );
-                    m_taskContext.m_dependencies.emplace_back( m_tasks[DepTaskIdx] );
+                    EE_ASSERT( taskLevels[depTaskIdx] != InvalidIndex );
+                    level = Math::Max( level, int16_t( taskLevels[depTaskIdx] + 1 ) );
                 }
+            }
 
-                // Execute task
-                m_tasks[i]->Execute( m_taskContext );
+            bool const allowsParallelExecution = pTask->AllowsParallelExecution();
+            if ( !allowsParallelExecution )
+            {
+                level = Math::Max( level, int16_t( lastSerialTaskLevel + 1 ) );
+                lastSerialTaskLevel = level;
+            }
+
+            taskLevels[i] = level;
+
+            if ( level >= numParallelTasksPerLevel.size() )
+            {
+                numParallelTasksPerLevel.resize( level + 1, 0 );
+            }
+
+            if ( allowsParallelExecution )
+            {
+                numParallelTasksPerLevel[level]++;
             }
         }
 
-        m_needsUpdate = false;
+        // Only go wide if at least one level has multiple independent tasks
+        int16_t maxParallelTasksPerLevel = 0;
+        for ( auto numParallelTasks : numParallelTasksPerLevel )
+        {
+            maxParallelTasksPerLevel = Math::Max( maxParallelTasksPerLevel, numParallelTasks );
+        }
+
+        if ( maxParallelTasksPerLevel < 2 )
+        {
+            return false;
+        }
+
+        // Execute levels
+        //-------------------------------------------------------------------------
+
+        EE_PROFILE_SCOPE_ANIMATION( "Anim Parallel Tasks" );
+
+        struct ParallelTaskSet final : public ITaskSet
+        {
+            ParallelTaskSet( TaskSystem* pTaskSystem, TInlineVector<TaskIndex, 32> const& taskIndices )
+                : m_pTaskSystem( pTaskSystem )
+                , m_taskIndices( taskIndices )
+            {
+                m_SetSize = (uint32_t) taskIndices.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                // Each worker needs its own context since the current task index and dependencies are per task
+                TaskContext context( m_pTaskSystem->m_taskContext );
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    m_pTaskSystem->ExecuteTask( m_taskIndices[i], context );
+                }
+            }
+
+        private:
+
+            TaskSystem*                             m_pTaskSystem = nullptr;
+            TInlineVector<TaskIndex, 32> const&     m_taskIndices;
+        };
+
+        //-------------------------------------------------------------------------
+
+        m_posePool.BeginParallelCheckout();
+
+        // The shared context is read by the workers, so tasks executed on this thread need their own copy
+        TaskContext localContext( m_taskContext );
+        TInlineVector<TaskIndex, 32> parallelTaskIndices;
+        int16_t const numLevels = (int16_t) numParallelTasksPerLevel.size();
+        for ( int16_t level = 0; level < numLevels; level++ )
+        {
+            parallelTaskIndices.clear();
+            TaskIndex serialTaskIdx = InvalidIndex;
+
+            for ( int16_t i = 0; i < numTasks; i++ )
+            {
+                if ( taskLevels[i] != level )
+                {
+                    continue;
+                }
+
+                if ( m_tasks[i]->AllowsParallelExecution() )
+                {
+                    parallelTaskIndices.emplace_back( (TaskIndex) i );
+                }
+                else
+                {
+                    EE_ASSERT( serialTaskIdx == InvalidIndex );
+                    serialTaskIdx = (TaskIndex) i;
+                }
+            }
+
+            // Schedule the parallel tasks and run the serial task (if any) on this thread while we wait
+            if ( parallelTaskIndices.size() > 1 )
+            {
+                ParallelTaskSet taskSet( this, parallelTaskIndices );
+                m_pTaskScheduler->ScheduleTask( &taskSet );
+
+                if ( serialTaskIdx != InvalidIndex )
+                {
+                    ExecuteTask( serialTaskIdx, localContext );
+                }
+
+                m_pTaskScheduler->WaitForTask( &taskSet );
+            }
+            else
+            {
+                if ( serialTaskIdx != InvalidIndex )
+                {
+                    ExecuteTask( serialTaskIdx, localContext );
+                }
+
+                if ( !parallelTaskIndices.empty() )
+                {
+                    ExecuteTask( parallelTaskIndices[0], localContext );
+                }
+            }
+        }
+
+        m_posePool.EndParallelCheckout();
+
+        return true;
     }
 
     //-------------------------------------------------------------------------
@@ -273,7 +462,7 @@ namespace EE::Animation
         for ( uint8_t i = 0; i < numTasks; i++ )
         {
             uint8_t const taskTypeID = serializer.ReadTaskTypeID();
-            m_tasks.emplace_back( TaskSerializer::CreateTask( taskTypeID ) );
+            m_tasks.emplace_back( TaskSerializer::CreateTask( m_taskAllocator, taskTypeID ) );
         }
 
         // Deserialize Tasks
@@ -1,11 +1,16 @@
 #pragma once
 
 #include "Animation_Task.h"
+#include "Animation_TaskAllocator.h"
 #include "Animation_TaskSerializer.h"
 #include "Engine/Animation/AnimationBoneMask.h"
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Animation
 {
     #if EE_DEVELOPMENT_TOOLS
@@ -28,6 +33,9 @@ namespace EE::Animation
     {
         friend class AnimationDebugView;
 
+        // The minimum number of pending tasks needed before we consider executing independent task chains in parallel
+        constexpr static int32_t const s_minTasksForParallelExecution = 12;
+
     public:
 
         TaskSystem( Skeleton const* pSkeleton );
@@ -44,6 +52,13 @@ namespace EE::Animation
         // Get the final pose generated by the task system
         Pose const* GetPose() const{ return &m_finalPose; }
 
+        // Skeleton LOD
+        //-------------------------------------------------------------------------
+        // Controls how many bones all the pose tasks operate on, needs to be set before any tasks are registered for the frame
+
+        void SetSkeletonLOD( int32_t lod );
+        inline int32_t GetSkeletonLOD() const { return m_finalPose.GetSkeletonLOD(); }
+
         // Execution
         //-------------------------------------------------------------------------
 
@@ -59,6 +74,9 @@ namespace EE::Animation
         // Run all post-physics tasks and fill out the final pose buffer
         void UpdatePostPhysics();
 
+        // Set the scheduler used to execute independent task chains in parallel, if not set all tasks are executed serially
+        inline void SetTaskScheduler( EE::TaskSystem* pTaskScheduler ) { m_pTaskScheduler = pTaskScheduler; }
+
         // Cached Pose storage
         //-------------------------------------------------------------------------
 
@@ -76,7 +94,7 @@ namespace EE::Animation
         inline TaskIndex RegisterTask( ConstructorParams&&... params )
         {
             EE_ASSERT( m_tasks.size() < 0xFF );
-            auto pNewTask = m_tasks.emplace_back( EE::New<T>( std::forward<ConstructorParams>( params )... ) );
+            auto pNewTask = m_tasks.emplace_back( m_taskAllocator.New<T>( std::forward<ConstructorParams>( params )... ) );
             m_hasPhysicsDependency |= pNewTask->HasPhysicsDependency();
             m_needsUpdate = true;
             return (TaskIndex) ( m_tasks.size() - 1 );
@@ -85,6 +103,9 @@ namespace EE::Animation
         TaskIndex GetCurrentTaskIndexMarker() const { return (TaskIndex) m_tasks.size(); }
         void RollbackToTaskIndexMarker( TaskIndex const marker );
 
+        // Get the task allocator stats, used to confirm that we are not hitting the heap in the steady state
+        inline TaskAllocator::Stats const& GetTaskAllocatorStats() const { return m_taskAllocator.GetStats(); }
+
         // Task Serialization
         //-------------------------------------------------------------------------
 
@@ -108,18 +129,25 @@ namespace EE::Animation
     private:
 
         bool AddTaskChainToPrePhysicsList( TaskIndex taskIdx );
+        void ExecuteTask( TaskIndex taskIdx, TaskContext& context );
         void ExecuteTasks();
 
+        // Execute all pending tasks, scheduling tasks with no dependencies on each other concurrently
+        // Returns false if there isnt enough parallelism available, in which case nothing is executed
+        bool TryExecuteTasksInParallel();
+
         #if EE_DEVELOPMENT_TOOLS
         void CalculateTaskOffset( TaskIndex taskIdx, Float2 const& currentOffset, TInlineVector<Float2, 16>& offsets );
         #endif
 
     private:
 
+        TaskAllocator                   m_taskAllocator;
         TVector<Task*>                  m_tasks;
         PoseBufferPool                  m_posePool;
         BoneMaskPool                    m_boneMaskPool;
         TaskContext                     m_taskContext;
+        EE::TaskSystem*                 m_pTaskScheduler = nullptr;
         TInlineVector<TaskIndex, 16>    m_prePhysicsTaskIndices;
         Pose                            m_finalPose;
         bool                            m_hasPhysicsDependency = false;
@@ -17,6 +17,9 @@ namespace EE::Animation::Tasks
         BlendTask( TaskSourceID sourceID, TaskIndex sourceTaskIdx, TaskIndex targetTaskIdx, float const blendWeight, PoseBlendMode blendMode = PoseBlendMode::Interpolative, BoneMaskTaskList const* pBoneMaskTaskList = nullptr );
         virtual void Execute( TaskContext const& context ) override;
 
+        // Bone mask evaluation uses the shared bone mask pool so masked blends need to run serially
+        virtual bool AllowsParallelExecution() const override { return !m_boneMaskTaskList.HasTasks(); }
+
         virtual bool AllowsSerialization() const override { return true; }
         virtual void Serialize( TaskSerializer& serializer ) const override;
         virtual void Deserialize( TaskSerializer& serializer ) override;
@@ -14,6 +14,7 @@ namespace EE::Animation::Tasks
 
         DefaultPoseTask( TaskSourceID sourceID, Pose::Type type );
         virtual void Execute( TaskContext const& context ) override;
+        virtual bool AllowsParallelExecution() const override { return true; }
 
         virtual bool AllowsSerialization() const override { return true; }
         virtual void Serialize( TaskSerializer& serializer ) const override;
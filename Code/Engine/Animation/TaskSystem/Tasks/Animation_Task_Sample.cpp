@@ -18,7 +18,16 @@ namespace EE::Animation::Tasks
         EE_ASSERT( m_pAnimation != nullptr );
 
         auto pResultBuffer = GetNewPoseBuffer( context );
-        m_pAnimation->GetPose( m_time, &pResultBuffer->m_pose );
+        if ( m_pPreSampledPose != nullptr )
+        {
+            EE_ASSERT( m_pPreSampledPose->GetSkeleton() == pResultBuffer->m_pose.GetSkeleton() );
+            EE_ASSERT( m_pPreSampledPose->GetSkeletonLOD() == pResultBuffer->m_pose.GetSkeletonLOD() );
+            pResultBuffer->m_pose.CopyFrom( m_pPreSampledPose );
+        }
+        else
+        {
+            m_pAnimation->GetPose( m_time, &pResultBuffer->m_pose );
+        }
         MarkTaskComplete( context );
     }
 
@@ -15,6 +15,15 @@ namespace EE::Animation::Tasks
 
         SampleTask( TaskSourceID sourceID, AnimationClip const* pAnimation, Percentage time );
         virtual void Execute( TaskContext const& context ) override;
+        virtual bool AllowsParallelExecution() const override { return true; }
+
+        inline static bool IsSampleTask( Task const* pTask ) { return pTask->GetTaskTypeID() == s_taskTypeID; }
+        inline AnimationClip const* GetAnimation() const { return m_pAnimation; }
+        inline Percentage GetTime() const { return m_time; }
+
+        // Provide an already sampled pose for this clip/time (used when batching identical samples across graph instances)
+        // The pose needs to be at the same skeleton LOD as the task system and needs to remain valid until the task has executed
+        inline void SetPreSampledPose( Pose const* pPose ) { m_pPreSampledPose = pPose; }
 
         virtual bool AllowsSerialization() const override { return true; }
         virtual void Serialize( TaskSerializer& serializer ) const override;
@@ -33,5 +42,6 @@ namespace EE::Animation::Tasks
 
         AnimationClip const*    m_pAnimation;
         Percentage              m_time;
+        Pose const*             m_pPreSampledPose = nullptr;
     };
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "System/Imgui/ImguiX.h"
 #include "Engine/Camera/Components/Component_Camera.h"
 #include "Engine/Entity/EntityWorld.h"
+#include "Engine/Entity/EntityDescriptors.h"
 #include "Engine/Entity/EntitySystem.h"
 #include "Engine/UpdateContext.h"
 #include "Engine/Entity/EntityWorldManager.h"
@@ -32,6 +33,18 @@ namespace EE
             if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
             DrawMapLoader( context );
         }
+
+        if ( m_isSystemSchedulerOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawSystemScheduler( context );
+        }
+
+        if ( m_isEntityPoolsOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawEntityPools( context );
+        }
     }
 
     void EntityDebugView::DrawMenu( EntityWorldUpdateContext const& context )
@@ -45,6 +58,16 @@ namespace EE
         {
             m_isMapLoaderOpen = true;
         }
+
+        if ( ImGui::MenuItem( "Show System Scheduler" ) )
+        {
+            m_isSystemSchedulerOpen = true;
+        }
+
+        if ( ImGui::MenuItem( "Show Entity Pools" ) )
+        {
+            m_isEntityPoolsOpen = true;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -91,6 +114,144 @@ namespace EE
         ImGui::End();
     }
 
+    //-------------------------------------------------------------------------
+    // Entity Pools
+    //-------------------------------------------------------------------------
+
+    void EntityDebugView::DrawEntityPools( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "Entity Pools", &m_isEntityPoolsOpen ) )
+        {
+            auto const& pools = m_pWorld->GetEntityPools();
+            if ( pools.empty() )
+            {
+                ImGui::Text( "No entity pools" );
+            }
+            else if ( ImGui::BeginTable( "EntityPoolsTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable ) )
+            {
+                ImGui::TableSetupColumn( "Collection", ImGuiTableColumnFlags_WidthStretch );
+                ImGui::TableSetupColumn( "Active", ImGuiTableColumnFlags_WidthFixed, 50 );
+                ImGui::TableSetupColumn( "Free", ImGuiTableColumnFlags_WidthFixed, 50 );
+                ImGui::TableSetupColumn( "Pending", ImGuiTableColumnFlags_WidthFixed, 50 );
+                ImGui::TableSetupColumn( "Occupancy", ImGuiTableColumnFlags_WidthFixed, 100 );
+                ImGui::TableHeadersRow();
+
+                TInlineString<100> tempStr;
+                for ( auto pPool : pools )
+                {
+                    int32_t const numInstances = pPool->GetNumInstances();
+                    int32_t const numActive = pPool->GetNumActiveInstances();
+                    int32_t const numFree = pPool->GetNumFreeInstances();
+
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted( pPool->GetEntityCollectionDesc()->GetResourcePath().c_str() );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", numActive );
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", numFree );
+
+                    // Instances that are still warming up or being released
+                    ImGui::TableNextColumn();
+                    ImGui::Text( "%d", numInstances - numActive - numFree );
+
+                    ImGui::TableNextColumn();
+                    tempStr.sprintf( "%d/%d", numActive, numInstances );
+                    ImGui::ProgressBar( ( numInstances > 0 ) ? float( numActive ) / numInstances : 0.0f, ImVec2( -1, 0 ), tempStr.c_str() );
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
+
+    //-------------------------------------------------------------------------
+    // System Scheduler
+    //-------------------------------------------------------------------------
+
+    void EntityDebugView::DrawSystemScheduler( EntityWorldUpdateContext const& context )
+    {
+        constexpr static char const* const stageNames[] = { "Frame Start", "Pre-Physics", "Physics", "Post-Physics", "Frame End", "Paused" };
+        static_assert( sizeof( stageNames ) / sizeof( stageNames[0] ) == (int32_t) UpdateStage::NumStages, "Stage names out of sync" );
+
+        auto const& scheduler = m_pWorld->GetSystemScheduler();
+
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "World System Scheduler", &m_isSystemSchedulerOpen ) )
+        {
+            for ( int8_t stageIdx = 0; stageIdx < (int8_t) UpdateStage::NumStages; stageIdx++ )
+            {
+                auto const& schedule = scheduler.GetStageSchedule( (UpdateStage) stageIdx );
+                if ( schedule.m_nodes.empty() )
+                {
+                    continue;
+                }
+
+                if ( !ImGui::CollapsingHeader( stageNames[stageIdx], ImGuiTreeNodeFlags_DefaultOpen ) )
+                {
+                    continue;
+                }
+
+                ImGui::Text( "Stage: %.3fms, Serial Cost: %.3fms, Critical Path: %.3fms", schedule.m_stageTime.ToFloat(), schedule.m_totalSystemTime.ToFloat(), schedule.m_criticalPathTime.ToFloat() );
+
+                ImGui::PushID( stageIdx );
+                if ( ImGui::BeginTable( "StageSystemsTable", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable ) )
+                {
+                    ImGui::TableSetupColumn( "Group", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 40 );
+                    ImGui::TableSetupColumn( "System", ImGuiTableColumnFlags_WidthStretch );
+                    ImGui::TableSetupColumn( "Mode", ImGuiTableColumnFlags_WidthFixed, 80 );
+                    ImGui::TableSetupColumn( "Waits On", ImGuiTableColumnFlags_WidthStretch );
+                    ImGui::TableSetupColumn( "Time (ms)", ImGuiTableColumnFlags_WidthFixed, 60 );
+                    ImGui::TableHeadersRow();
+
+                    int32_t const numNodes = (int32_t) schedule.m_nodes.size();
+                    for ( int32_t i = 0; i < numNodes; i++ )
+                    {
+                        auto pNode = schedule.m_nodes[i];
+                        bool const isOnCriticalPath = VectorContains( schedule.m_criticalPath, i );
+                        Color const textColor = isOnCriticalPath ? Colors::OrangeRed : Colors::White;
+
+                        ImGui::TableNextRow();
+
+                        ImGui::TableNextColumn();
+                        ImGui::Text( "%d", pNode->m_groupIdx );
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextColored( textColor.ToFloat4(), "%s", pNode->m_pSystem->GetTypeInfo()->GetFriendlyTypeName() );
+
+                        ImGui::TableNextColumn();
+                        if ( pNode->m_isBarrier )
+                        {
+                            ImGui::Text( "Barrier" );
+                        }
+                        else
+                        {
+                            ImGui::Text( schedule.m_isConcurrentGroup[pNode->m_groupIdx] ? "Concurrent" : "Serial" );
+                        }
+
+                        ImGui::TableNextColumn();
+                        for ( auto predecessorIdx : pNode->m_predecessors )
+                        {
+                            ImGui::TextUnformatted( schedule.m_nodes[predecessorIdx]->m_pSystem->GetTypeInfo()->GetFriendlyTypeName() );
+                        }
+
+                        ImGui::TableNextColumn();
+                        ImGui::TextColored( textColor.ToFloat4(), "%.3f", Milliseconds( pNode->m_endTime - pNode->m_startTime ).ToFloat() );
+                    }
+
+                    ImGui::EndTable();
+                }
+                ImGui::PopID();
+            }
+        }
+        ImGui::End();
+    }
+
     //-------------------------------------------------------------------------
     // World Browser
     //-------------------------------------------------------------------------
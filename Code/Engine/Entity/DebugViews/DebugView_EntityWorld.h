@@ -29,6 +29,8 @@ namespace EE
         void DrawMenu( EntityWorldUpdateContext const& context );
         void DrawWorldBrowser( EntityWorldUpdateContext const& context );
         void DrawMapLoader( EntityWorldUpdateContext const& context );
+        void DrawSystemScheduler( EntityWorldUpdateContext const& context );
+        void DrawEntityPools( EntityWorldUpdateContext const& context );
 
         void DrawComponentEntry( EntityComponent const* pComponent );
         void DrawSpatialComponentTree( SpatialEntityComponent const* pComponent );
@@ -37,6 +39,8 @@ namespace EE
 
         bool                    m_isWorldBrowserOpen = false;
         bool                    m_isMapLoaderOpen = false;
+        bool                    m_isSystemSchedulerOpen = false;
+        bool                    m_isEntityPoolsOpen = false;
 
         // Browser Data
         TVector<Entity*>        m_entities;
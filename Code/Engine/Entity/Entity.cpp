@@ -199,7 +199,7 @@ namespace EE
         for ( auto pAttachedEntity : m_attachedEntities )
         {
             EE_ASSERT( !pAttachedEntity->IsInitialized() );
-            if ( pAttachedEntity->IsLoaded() )
+            if ( pAttachedEntity->IsLoaded() && !pAttachedEntity->m_isDeactivated )
             {
                 pAttachedEntity->Initialize( initializationContext );
             }
@@ -1095,6 +1095,46 @@ namespace EE
         EE::Delete( pComponent );
     }
 
+    void Entity::ResetComponents( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedEntityDescriptor const& entityDesc )
+    {
+        Threading::RecursiveScopeLock lock( m_internalStateMutex );
+        EE_ASSERT( !IsInitialized() && m_deferredActions.empty() );
+
+        // Pooled entities are not allowed to change their component structure, so the components still match the descriptor order
+        int32_t const numComponents = (int32_t) m_components.size();
+        EE_ASSERT( numComponents == (int32_t) entityDesc.m_components.size() );
+
+        for ( int32_t i = 0; i < numComponents; i++ )
+        {
+            EntityComponent* pComponent = m_components[i];
+            EntityModel::SerializedComponentDescriptor const& componentDesc = entityDesc.m_components[i];
+            EE_ASSERT( pComponent->m_name == componentDesc.m_name );
+            EE_ASSERT( !pComponent->m_isRegisteredWithEntity && !pComponent->m_isRegisteredWithWorld );
+
+            // Components can only be reset while shutdown, resources are kept loaded
+            bool const wasInitialized = pComponent->IsInitialized();
+            if ( wasInitialized )
+            {
+                pComponent->Shutdown();
+            }
+
+            componentDesc.ResetTypeInstance( typeRegistry, pComponent );
+
+            // Restore the values that are not set via the property overrides
+            pComponent->m_name = componentDesc.m_name;
+            if ( componentDesc.IsSpatialComponent() )
+            {
+                reinterpret_cast<SpatialEntityComponent*>( pComponent )->m_parentAttachmentSocketID = componentDesc.m_attachmentSocketID;
+            }
+
+            if ( wasInitialized )
+            {
+                pComponent->Initialize();
+                EE_ASSERT( pComponent->IsInitialized() ); // Did you forget to call the parent class initialize?
+            }
+        }
+    }
+
     void Entity::RemoveComponentFromSpatialHierarchy( SpatialEntityComponent* pSpatialComponent )
     {
         Threading::RecursiveScopeLock lock( m_internalStateMutex );
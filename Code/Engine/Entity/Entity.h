@@ -30,6 +30,7 @@ namespace EE
     class SystemRegistry;
     class EntitySystem;
     class EntityWorldUpdateContext;
+    class EntityUpdateScheduler;
 
     namespace EntityModel
     {
@@ -51,6 +52,7 @@ namespace EE
 
         friend EntityModel::Serializer;
         friend EntityModel::EntityMap;
+        friend EntityUpdateScheduler;
 
         #if EE_DEVELOPMENT_TOOLS
         friend EntityModel::EntityStructureEditor;
@@ -201,6 +203,9 @@ namespace EE
         inline bool IsUnloaded() const { return m_status == Status::Unloaded; }
         inline bool HasStateChangeActionsPending() const { return !m_deferredActions.empty(); }
 
+        // Deactivated entities keep their components loaded but are never initialized, this is used to keep pooled entities out of the world
+        inline bool IsDeactivated() const { return m_isDeactivated; }
+
         // Components
         //-------------------------------------------------------------------------
         // NB!!! Add and remove operations execute immediately for unloaded entities BUT will be deferred to the next loading phase for loaded entities
@@ -359,6 +364,9 @@ namespace EE
         void AddComponentImmediate( EntityComponent* pComponent, SpatialEntityComponent* pParentSpatialComponent );
         void DestroyComponentImmediate( EntityComponent* pComponent );
 
+        // Reset the properties of all components back to the values in the descriptor this entity was created from, only valid for shutdown entities
+        void ResetComponents( TypeSystem::TypeRegistry const& typeRegistry, EntityModel::SerializedEntityDescriptor const& entityDesc );
+
     protected:
 
         EntityID                                            m_ID = EntityID::Generate();                                            // The unique ID of this entity ( globally unique and generated at runtime )
@@ -370,12 +378,14 @@ namespace EE
         TVector<EntitySystem*>                              m_systems;
         TVector<EntityComponent*>                           m_components;
         SystemUpdateList                                    m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        float                                               m_updateCosts[(int8_t) UpdateStage::NumStages] = {};                     // The measured update time (in microseconds) for each stage on the last update
 
         SpatialEntityComponent*                             m_pRootSpatialComponent = nullptr;                                      // This spatial component defines our world position
         TVector<Entity*>                                    m_attachedEntities;                                                     // The list of entities that are attached to this entity
         Entity*                                             m_pParentSpatialEntity = nullptr;                                       // The parent entity we are attached to
         EE_REFLECT() StringID                               m_parentAttachmentSocketID;                                             // The socket that we are attached to on the parent
         bool                                                m_isSpatialAttachmentCreated = false;                                   // Has the actual component-to-component attachment been created
+        bool                                                m_isDeactivated = false;                                                // Is this entity kept out of the world (i.e. sitting in an entity pool)
 
         TVector<EntityInternalStateAction>                  m_deferredActions;                                                      // The set of internal entity state changes that need to be executed
         Threading::RecursiveMutex                           m_internalStateMutex;                                                   // A mutex that needs to be lock due to internal state changes
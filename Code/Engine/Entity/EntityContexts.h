@@ -11,6 +11,7 @@ namespace EE
     class EntityComponent;
     class TaskSystem;
     class IEntityWorldSystem;
+    class EntityTransformResolver;
     namespace Resource { class ResourceSystem; }
     namespace TypeSystem { class TypeRegistry; }
 }
@@ -86,6 +87,7 @@ namespace EE::EntityModel
 
         TaskSystem* const                                           m_pTaskSystem = nullptr;
         TypeSystem::TypeRegistry const*                             m_pTypeRegistry = nullptr;
+        EntityTransformResolver*                                    m_pTransformResolver = nullptr;     // Only set for worlds using deferred transforms
 
         // World system registration
         Threading::LockFreeQueue<EntityComponentPair>               m_componentsToRegister;
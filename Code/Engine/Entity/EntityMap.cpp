@@ -3,6 +3,8 @@
 #include "EntityContexts.h"
 #include "EntitySerialization.h"
 #include "EntityWorldSystem.h"
+#include "EntityTransformResolver.h"
+#include "EntitySpatialComponent.h"
 #include "Entity.h"
 #include "System/Resource/ResourceSystem.h"
 #include "System/TypeSystem/TypeRegistry.h"
@@ -203,6 +205,13 @@ namespace EE::EntityModel
         m_entityNameLookupMap.erase( nameLookupIter );
         #endif
 
+        // Cancel any pending deactivation
+        int32_t const deactivationRequestIdx = VectorFindIndex( m_entitiesToDeactivate, pEntityToRemove, [] ( DeactivationRequest const& request, Entity* pEntity ) { return request.m_pEntity == pEntity; } );
+        if ( deactivationRequestIdx != InvalidIndex )
+        {
+            m_entitiesToDeactivate.erase_unsorted( m_entitiesToDeactivate.begin() + deactivationRequestIdx );
+        }
+
         // Schedule unload
         //-------------------------------------------------------------------------
 
@@ -246,6 +255,45 @@ namespace EE::EntityModel
         RemoveEntityInternal( entityID, true );
     }
 
+    void EntityMap::DeactivateEntity( EntityID entityID, SerializedEntityDescriptor const* pResetDesc )
+    {
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        Entity* pEntity = FindEntity( entityID );
+        EE_ASSERT( pEntity != nullptr && !pEntity->m_isDeactivated );
+        pEntity->m_isDeactivated = true;
+
+        // Entities that havent requested their load yet, dont need to be shutdown
+        if ( !pEntity->HasRequestedComponentLoad() && pResetDesc == nullptr )
+        {
+            return;
+        }
+
+        m_entitiesToDeactivate.emplace_back( DeactivationRequest( pEntity, pResetDesc ) );
+    }
+
+    void EntityMap::ActivateEntity( EntityID entityID )
+    {
+        Threading::RecursiveScopeLock lock( m_mutex );
+
+        Entity* pEntity = FindEntity( entityID );
+        EE_ASSERT( pEntity != nullptr && pEntity->m_isDeactivated );
+        pEntity->m_isDeactivated = false;
+
+        // Cancel any pending deactivation
+        int32_t const requestIdx = VectorFindIndex( m_entitiesToDeactivate, pEntity, [] ( DeactivationRequest const& request, Entity* pEntity ) { return request.m_pEntity == pEntity; } );
+        if ( requestIdx != InvalidIndex )
+        {
+            m_entitiesToDeactivate.erase_unsorted( m_entitiesToDeactivate.begin() + requestIdx );
+        }
+
+        // Schedule the initialization, entities that havent requested their load yet will be initialized once loaded
+        if ( pEntity->HasRequestedComponentLoad() && !pEntity->IsInitialized() && !VectorContains( m_entitiesCurrentlyLoading, pEntity ) )
+        {
+            m_entitiesCurrentlyLoading.emplace_back( pEntity );
+        }
+    }
+
     void EntityMap::OnEntityStateUpdated( Entity* pEntity )
     {
         if ( pEntity->GetMapID() == m_ID )
@@ -357,6 +405,7 @@ namespace EE::EntityModel
 
         m_entitiesCurrentlyLoading.clear();
         m_entitiesToLoad.clear();
+        m_entitiesToDeactivate.clear();
 
         // Shutdown all entities
         //-------------------------------------------------------------------------
@@ -456,6 +505,14 @@ namespace EE::EntityModel
                 pEntityToShutdown->Shutdown( initializationContext );
             }
         }
+
+        for ( auto const& deactivationRequest : m_entitiesToDeactivate )
+        {
+            if ( deactivationRequest.m_pEntity->IsInitialized() )
+            {
+                deactivationRequest.m_pEntity->Shutdown( initializationContext );
+            }
+        }
     }
 
     void EntityMap::ProcessEntityRemovalRequests( LoadingContext const& loadingContext )
@@ -486,6 +543,31 @@ namespace EE::EntityModel
         }
     }
 
+    void EntityMap::ProcessEntityDeactivationRequests( LoadingContext const& loadingContext )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Entity Deactivation" );
+
+        for ( int32_t i = (int32_t) m_entitiesToDeactivate.size() - 1; i >= 0; i-- )
+        {
+            auto const& deactivationRequest = m_entitiesToDeactivate[i];
+            auto pEntityToDeactivate = deactivationRequest.m_pEntity;
+            EE_ASSERT( pEntityToDeactivate->m_isDeactivated && !pEntityToDeactivate->IsInitialized() );
+
+            // Components can only be reset once all loading and state changes are complete
+            if ( deactivationRequest.m_pResetDesc != nullptr )
+            {
+                if ( !pEntityToDeactivate->IsLoaded() || pEntityToDeactivate->HasStateChangeActionsPending() )
+                {
+                    continue;
+                }
+
+                pEntityToDeactivate->ResetComponents( *loadingContext.m_pTypeRegistry, *deactivationRequest.m_pResetDesc );
+            }
+
+            m_entitiesToDeactivate.erase_unsorted( m_entitiesToDeactivate.begin() + i );
+        }
+    }
+
     void EntityMap::ProcessEntityLoadingAndInitialization( LoadingContext const& loadingContext, InitializationContext& initializationContext )
     {
         EE_PROFILE_SCOPE_ENTITY( "Entity Loading/Initialization" );
@@ -532,8 +614,8 @@ namespace EE::EntityModel
                         }
                         #endif
 
-                        // Initialize any entities that loaded successfully
-                        if ( pEntity->IsLoaded() )
+                        // Initialize any entities that loaded successfully, deactivated entities stay loaded until they are activated
+                        if ( pEntity->IsLoaded() && !pEntity->m_isDeactivated )
                         {
                             // Prevent us from initializing entities whose parents are not yet initialized, this ensures that our attachment chains have a consistent initialized state
                             if ( pEntity->HasSpatialParent() )
@@ -720,11 +802,22 @@ namespace EE::EntityModel
             // Finalize component registration
             //-------------------------------------------------------------------------
 
+            // Flush any pending transform updates, since unregistered components leave deferred transform mode and might get destroyed
+            if ( initializationContext.m_pTransformResolver != nullptr && numComponentsToUnregister > 0 )
+            {
+                initializationContext.m_pTransformResolver->ResolveTransforms();
+            }
+
             // Remove from type tracking table
             for ( auto const& pair : componentsToUnregister )
             {
                 pair.m_pComponent->m_isRegisteredWithWorld = false;
 
+                if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pair.m_pComponent ) )
+                {
+                    pSpatialComponent->m_pTransformResolver = nullptr;
+                }
+
                 #if EE_DEVELOPMENT_TOOLS
                 EntityComponentTypeMap& componentTypeMap = *initializationContext.m_pComponentTypeMap;
                 auto const castableTypeIDs = initializationContext.m_pTypeRegistry->GetAllCastableTypes( pair.m_pComponent );
@@ -740,6 +833,11 @@ namespace EE::EntityModel
             {
                 pair.m_pComponent->m_isRegisteredWithWorld = true;
 
+                if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pair.m_pComponent ) )
+                {
+                    pSpatialComponent->m_pTransformResolver = initializationContext.m_pTransformResolver;
+                }
+
                 #if EE_DEVELOPMENT_TOOLS
                 EntityComponentTypeMap& componentTypeMap = *initializationContext.m_pComponentTypeMap;
                 auto const castableTypeIDs = initializationContext.m_pTypeRegistry->GetAllCastableTypes( pair.m_pComponent );
@@ -794,6 +892,7 @@ namespace EE::EntityModel
         ProcessEntityShutdownRequests( initializationContext );
         ProcessEntityRegistrationRequests( initializationContext );
         ProcessEntityRemovalRequests( loadingContext );
+        ProcessEntityDeactivationRequests( loadingContext );
 
         // Update entity load states
         //-------------------------------------------------------------------------
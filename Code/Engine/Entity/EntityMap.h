@@ -52,6 +52,14 @@ namespace EE
                 bool        m_shouldDestroy = false;
             };
 
+            struct DeactivationRequest
+            {
+                DeactivationRequest( Entity* pEntity, SerializedEntityDescriptor const* pResetDesc ) : m_pEntity( pEntity ), m_pResetDesc( pResetDesc ) {}
+
+                Entity*                                 m_pEntity = nullptr;
+                SerializedEntityDescriptor const*       m_pResetDesc = nullptr;
+            };
+
         public:
 
             EntityMap(); // Default constructor creates a transient map
@@ -133,6 +141,14 @@ namespace EE
             // May take multiple frames to be fully destroyed, as the removal occurs during the loading update
             void DestroyEntity( EntityID entityID );
 
+            // Take an entity out of the world without unloading it, deactivated entities are shutdown but keep all their components loaded
+            // If a descriptor is supplied, all component properties will be reset to it once shutdown (resource properties are left untouched)
+            // Takes 1 frame to be fully deactivated
+            void DeactivateEntity( EntityID entityID, SerializedEntityDescriptor const* pResetDesc = nullptr );
+
+            // Bring a deactivated entity back into the world, since its components are still loaded, it will be initialized in the next loading update
+            void ActivateEntity( EntityID entityID );
+
             //-------------------------------------------------------------------------
             // Tools API
             //-------------------------------------------------------------------------
@@ -177,6 +193,7 @@ namespace EE
             void ProcessEntityRegistrationRequests( InitializationContext& initializationContext );
             void ProcessEntityShutdownRequests( InitializationContext& initializationContext );
             void ProcessEntityRemovalRequests( LoadingContext const& loadingContext );
+            void ProcessEntityDeactivationRequests( LoadingContext const& loadingContext );
             void ProcessEntityLoadingAndInitialization( LoadingContext const& loadingContext, InitializationContext& initializationContext );
 
             // Remove entity
@@ -192,6 +209,7 @@ namespace EE
             TVector<Entity*>                            m_entitiesCurrentlyLoading;
             TInlineVector<Entity*, 5>                   m_entitiesToLoad;
             TInlineVector<RemovalRequest, 5>            m_entitiesToRemove;
+            TInlineVector<DeactivationRequest, 5>       m_entitiesToDeactivate;
             EventBindingID                              m_entityUpdateEventBindingID;
             Status                                      m_status = Status::Unloaded;
             bool const                                  m_isTransientMap = false; // If this is set, then this is a transient map i.e.created and managed at runtime and not loaded from disk
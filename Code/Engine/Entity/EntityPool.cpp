@@ -0,0 +1,156 @@
+#include "EntityPool.h"
+#include "EntityMap.h"
+#include "EntitySerialization.h"
+#include "EntityDescriptors.h"
+#include "Entity.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    EntityPool::EntityPool( EntityMap* pMap, TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, int32_t numInstances )
+        : m_pMap( pMap )
+        , m_pEntityCollectionDesc( &entityCollectionDesc )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Warm Entity Pool" );
+        EE_ASSERT( m_pMap != nullptr && numInstances > 0 );
+
+        m_instances.resize( numInstances );
+        m_freeInstanceIndices.reserve( numInstances );
+
+        for ( auto& instance : m_instances )
+        {
+            instance.m_entities = Serializer::CreateEntities( pTaskSystem, typeRegistry, entityCollectionDesc );
+
+            // Record the collection transforms so we can offset instances on each acquire
+            if ( m_initialTransforms.empty() )
+            {
+                m_initialTransforms.reserve( instance.m_entities.size() );
+                for ( auto pEntity : instance.m_entities )
+                {
+                    m_initialTransforms.emplace_back( pEntity->IsSpatialEntity() ? pEntity->GetWorldTransform() : Transform::Identity );
+                }
+            }
+
+            // Add the entities to the map deactivated, so they are loaded but never initialized
+            m_pMap->AddEntities( instance.m_entities );
+            for ( auto pEntity : instance.m_entities )
+            {
+                m_pMap->DeactivateEntity( pEntity->GetID() );
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t EntityPool::AcquireInstance( Transform const& offsetTransform )
+    {
+        if ( m_freeInstanceIndices.empty() )
+        {
+            return InvalidIndex;
+        }
+
+        int32_t const instanceIdx = m_freeInstanceIndices.back();
+        m_freeInstanceIndices.pop_back();
+
+        Instance& instance = m_instances[instanceIdx];
+        EE_ASSERT( instance.m_state == InstanceState::Free );
+
+        int32_t const numEntities = (int32_t) instance.m_entities.size();
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            Entity* pEntity = instance.m_entities[i];
+            if ( pEntity->IsSpatialEntity() )
+            {
+                pEntity->SetWorldTransform( m_initialTransforms[i] * offsetTransform );
+            }
+
+            m_pMap->ActivateEntity( pEntity->GetID() );
+        }
+
+        instance.m_state = InstanceState::Active;
+        m_numActiveInstances++;
+        return instanceIdx;
+    }
+
+    void EntityPool::ReleaseInstance( int32_t instanceIdx )
+    {
+        EE_ASSERT( instanceIdx >= 0 && instanceIdx < m_instances.size() );
+
+        Instance& instance = m_instances[instanceIdx];
+        EE_ASSERT( instance.m_state == InstanceState::Active );
+
+        auto const& entityDescriptors = m_pEntityCollectionDesc->GetEntityDescriptors();
+        int32_t const numEntities = (int32_t) instance.m_entities.size();
+        for ( int32_t i = 0; i < numEntities; i++ )
+        {
+            m_pMap->DeactivateEntity( instance.m_entities[i]->GetID(), &entityDescriptors[i] );
+        }
+
+        instance.m_state = InstanceState::Releasing;
+        m_numActiveInstances--;
+    }
+
+    int32_t EntityPool::FindInstanceIndex( EntityID const& entityID ) const
+    {
+        int32_t const numInstances = (int32_t) m_instances.size();
+        for ( int32_t i = 0; i < numInstances; i++ )
+        {
+            if ( VectorContains( m_instances[i].m_entities, entityID, [] ( Entity* pEntity, EntityID const& entityID ) { return pEntity->GetID() == entityID; } ) )
+            {
+                return i;
+            }
+        }
+
+        return InvalidIndex;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityPool::UpdateState()
+    {
+        int32_t const numInstances = (int32_t) m_instances.size();
+        for ( int32_t i = 0; i < numInstances; i++ )
+        {
+            Instance& instance = m_instances[i];
+            if ( instance.m_state != InstanceState::Warming && instance.m_state != InstanceState::Releasing )
+            {
+                continue;
+            }
+
+            // An instance is free once all its entities are fully loaded, shutdown and reset
+            bool isInstanceReady = true;
+            for ( auto pEntity : instance.m_entities )
+            {
+                EE_ASSERT( pEntity->IsDeactivated() );
+                if ( !pEntity->IsLoaded() || pEntity->HasStateChangeActionsPending() )
+                {
+                    isInstanceReady = false;
+                    break;
+                }
+            }
+
+            if ( isInstanceReady )
+            {
+                instance.m_state = InstanceState::Free;
+                m_freeInstanceIndices.emplace_back( i );
+            }
+        }
+    }
+
+    void EntityPool::DestroyEntities()
+    {
+        for ( auto& instance : m_instances )
+        {
+            for ( auto pEntity : instance.m_entities )
+            {
+                m_pMap->DestroyEntity( pEntity->GetID() );
+            }
+        }
+
+        m_instances.clear();
+        m_freeInstanceIndices.clear();
+        m_numActiveInstances = 0;
+    }
+}
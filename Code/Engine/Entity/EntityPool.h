@@ -0,0 +1,105 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "EntityIDs.h"
+#include "System/Math/Transform.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Entity Pool
+//-------------------------------------------------------------------------
+// A set of pre-warmed instances of an entity collection, used for high churn spawns (AI, projectiles, etc...)
+//
+// * All instances are created and loaded up front and are kept loaded for the lifetime of the pool
+// * Acquiring an instance only initializes its entities, releasing it only shuts them down
+// * Released instances have all their component properties reset back to the collection values
+// * Resource properties are never reset, so pooled entities should not change the resources they use
+// * Pooled entities are not allowed to add/remove components or systems
+//
+// Pools are created and owned by the entity world, and the entities live in the world's persistent map
+// The collection needs to stay loaded for the lifetime of the pool!
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    class Entity;
+    class TaskSystem;
+    class EntityDebugView;
+    namespace TypeSystem { class TypeRegistry; }
+
+    //-------------------------------------------------------------------------
+
+    namespace EntityModel
+    {
+        class EntityMap;
+        class SerializedEntityCollection;
+
+        //-------------------------------------------------------------------------
+
+        class EE_ENGINE_API EntityPool
+        {
+            friend EntityDebugView;
+
+            enum class InstanceState : uint8_t
+            {
+                Warming,        // Still loading
+                Free,           // Loaded and out of the world, ready to be acquired
+                Active,         // In the world
+                Releasing,      // Waiting for the shutdown and component reset to complete
+            };
+
+            struct Instance
+            {
+                TVector<Entity*>                            m_entities; // Same order as the collection entity descriptors
+                InstanceState                               m_state = InstanceState::Warming;
+            };
+
+        public:
+
+            EntityPool( EntityMap* pMap, TaskSystem* pTaskSystem, TypeSystem::TypeRegistry const& typeRegistry, SerializedEntityCollection const& entityCollectionDesc, int32_t numInstances );
+            EntityPool( EntityPool const& ) = delete;
+            EntityPool& operator=( EntityPool const& ) = delete;
+
+            inline SerializedEntityCollection const* GetEntityCollectionDesc() const { return m_pEntityCollectionDesc; }
+
+            // Occupancy
+            //-------------------------------------------------------------------------
+
+            inline int32_t GetNumInstances() const { return (int32_t) m_instances.size(); }
+            inline int32_t GetNumFreeInstances() const { return (int32_t) m_freeInstanceIndices.size(); }
+            inline int32_t GetNumActiveInstances() const { return m_numActiveInstances; }
+            inline bool HasFreeInstance() const { return !m_freeInstanceIndices.empty(); }
+
+            // Instances
+            //-------------------------------------------------------------------------
+
+            // Bring a free instance into the world with the supplied offset, returns the instance index or InvalidIndex if there are no free instances
+            // Takes 1 frame for the entities to be initialized
+            int32_t AcquireInstance( Transform const& offsetTransform = Transform::Identity );
+
+            // Take an active instance out of the world and reset it, the instance will be available again after the next loading update
+            void ReleaseInstance( int32_t instanceIdx );
+
+            // Get the entities for an instance
+            inline TVector<Entity*> const& GetInstanceEntities( int32_t instanceIdx ) const { EE_ASSERT( instanceIdx >= 0 && instanceIdx < m_instances.size() ); return m_instances[instanceIdx].m_entities; }
+
+            // Find the instance that owns the specified entity, returns InvalidIndex if the entity is not part of this pool
+            int32_t FindInstanceIndex( EntityID const& entityID ) const;
+
+            // Update the instance states, needs to be called after the map loading update
+            void UpdateState();
+
+            // Request the destruction of all pooled entities, this includes the active ones
+            void DestroyEntities();
+
+        private:
+
+            EntityMap*                                      m_pMap = nullptr;
+            SerializedEntityCollection const*               m_pEntityCollectionDesc = nullptr;
+            TVector<Instance>                               m_instances;
+            TVector<Transform>                              m_initialTransforms; // The world transforms for each entity in the collection
+            TVector<int32_t>                                m_freeInstanceIndices;
+            int32_t                                         m_numActiveInstances = 0;
+        };
+    }
+}
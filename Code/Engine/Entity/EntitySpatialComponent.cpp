@@ -1,5 +1,7 @@
 #include "EntitySpatialComponent.h"
+#include "EntityTransformResolver.h"
 #include "EntityLog.h"
+#include <thread>
 
 //-------------------------------------------------------------------------
 
@@ -59,7 +61,7 @@ namespace EE
         // If the socket ID is invalid, just return the current transform
         if ( !socketID.IsValid() )
         {
-            socketTransform = m_worldTransform;
+            socketTransform = GetWorldTransform();
             return socketTransform;
         }
 
@@ -90,7 +92,7 @@ namespace EE
         }
 
         // Fallback to the world transform
-        socketTransform = m_worldTransform;
+        socketTransform = GetWorldTransform();
         return socketTransform;
     }
 
@@ -127,18 +129,134 @@ namespace EE
 
     bool SpatialEntityComponent::TryFindAttachmentSocketTransform( StringID socketID, Transform& outSocketWorldTransform ) const
     {
-        outSocketWorldTransform = m_worldTransform;
+        outSocketWorldTransform = GetWorldTransform();
         return false;
     }
 
     void SpatialEntityComponent::NotifySocketsUpdated()
     {
+        if ( IsInDeferredTransformMode() )
+        {
+            MarkChildWorldTransformsDirty();
+            return;
+        }
+
         for ( auto& pChildComponent : m_spatialChildren )
         {
             pChildComponent->CalculateWorldTransform();
         }
     }
 
+    //-------------------------------------------------------------------------
+
+    bool SpatialEntityComponent::MarkChildrenDirty()
+    {
+        bool wasAnyChildQueued = false;
+        for ( auto pChild : m_spatialChildren )
+        {
+            // Dirty children always have dirty children, so there is no need to go any further
+            if ( pChild->m_worldTransformState.load( std::memory_order_relaxed ) == WorldTransformState::Dirty )
+            {
+                continue;
+            }
+
+            pChild->m_worldTransformState.store( WorldTransformState::Dirty, std::memory_order_release );
+            pChild->MarkChildrenDirty();
+
+            // Children that are still waiting on a callback will already be visited by the batched update
+            if ( !pChild->m_isTransformCallbackPending )
+            {
+                pChild->m_isTransformCallbackPending = true;
+                wasAnyChildQueued = true;
+            }
+        }
+
+        return wasAnyChildQueued;
+    }
+
+    void SpatialEntityComponent::ResolveWorldTransform()
+    {
+        while ( true )
+        {
+            WorldTransformState expectedState = WorldTransformState::Dirty;
+            if ( m_worldTransformState.compare_exchange_strong( expectedState, WorldTransformState::Resolving, std::memory_order_acq_rel ) )
+            {
+                // Our parent's world transform is resolved as part of the socket transform lookup
+                UpdateWorldTransformFromParent();
+
+                // If we were flagged as dirty again while resolving, we need to resolve again
+                expectedState = WorldTransformState::Resolving;
+                if ( m_worldTransformState.compare_exchange_strong( expectedState, WorldTransformState::Clean, std::memory_order_acq_rel ) )
+                {
+                    return;
+                }
+
+                continue;
+            }
+
+            if ( expectedState == WorldTransformState::Clean )
+            {
+                return;
+            }
+
+            // Another thread is already resolving this transform
+            while ( m_worldTransformState.load( std::memory_order_acquire ) == WorldTransformState::Resolving )
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void SpatialEntityComponent::AcquireWorldTransformForWrite()
+    {
+        WorldTransformState currentState = m_worldTransformState.load( std::memory_order_acquire );
+        while ( true )
+        {
+            if ( currentState == WorldTransformState::Resolving )
+            {
+                std::this_thread::yield();
+                currentState = m_worldTransformState.load( std::memory_order_acquire );
+                continue;
+            }
+
+            if ( m_worldTransformState.compare_exchange_weak( currentState, WorldTransformState::Resolving, std::memory_order_acq_rel ) )
+            {
+                return;
+            }
+        }
+    }
+
+    void SpatialEntityComponent::MarkWorldTransformDirty()
+    {
+        EE_ASSERT( IsInDeferredTransformMode() );
+
+        // Already queued either directly or via one of our parents
+        if ( m_worldTransformState.load( std::memory_order_relaxed ) == WorldTransformState::Dirty )
+        {
+            return;
+        }
+
+        m_worldTransformState.store( WorldTransformState::Dirty, std::memory_order_release );
+        MarkChildrenDirty();
+
+        // If we were resolved on demand, we are still waiting on the callback and are already queued
+        if ( !m_isTransformCallbackPending )
+        {
+            m_isTransformCallbackPending = true;
+            m_pTransformResolver->QueueDirtyComponent( this );
+        }
+    }
+
+    void SpatialEntityComponent::MarkChildWorldTransformsDirty()
+    {
+        EE_ASSERT( IsInDeferredTransformMode() );
+
+        if ( MarkChildrenDirty() )
+        {
+            m_pTransformResolver->QueueDirtyComponent( this );
+        }
+    }
+
     void SpatialEntityComponent::Initialize()
     {
         EntityComponent::Initialize();
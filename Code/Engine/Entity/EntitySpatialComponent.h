@@ -3,11 +3,17 @@
 #include "EntityComponent.h"
 #include "System/Math/BoundingVolumes.h"
 #include "System/Math/Transform.h"
+#include "System/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    class EntityTransformResolver;
+
+    //-------------------------------------------------------------------------
+
     #if EE_DEVELOPMENT_TOOLS
     namespace EntityModel
     {
@@ -23,6 +29,8 @@ namespace EE
 
         friend class Entity;
         friend class EntityDebugView;
+        friend EntityTransformResolver;
+        friend EntityModel::EntityMap;
         friend EntityModel::Serializer;
         friend EntityModel::EntityMapEditor;
         friend EntityModel::EntityCollection;
@@ -31,6 +39,13 @@ namespace EE
         friend EntityModel::EntityStructureEditor;
         #endif
 
+        enum class WorldTransformState : uint8_t
+        {
+            Clean = 0,
+            Dirty,
+            Resolving,
+        };
+
         struct AttachmentSocketTransformResult
         {
             AttachmentSocketTransformResult( Matrix transform ) : m_transform( transform ) {}
@@ -50,29 +65,38 @@ namespace EE
         inline Transform const& GetLocalTransform() const { return m_transform; }
         inline OBB const& GetLocalBounds() const { return m_bounds; }
 
-        inline Transform const& GetWorldTransform() const { return m_worldTransform; }
-        inline OBB const& GetWorldBounds() const { return m_worldBounds; }
+        inline Transform const& GetWorldTransform() const { ResolveWorldTransformIfDirty(); return m_worldTransform; }
+        inline OBB const& GetWorldBounds() const { ResolveWorldTransformIfDirty(); return m_worldBounds; }
 
         // Get world space position
-        inline Vector const& GetPosition() const { return m_worldTransform.GetTranslation(); }
+        inline Vector const& GetPosition() const { return GetWorldTransform().GetTranslation(); }
 
         // Get world space orientation
-        inline Quaternion const& GetOrientation() const { return m_worldTransform.GetRotation(); }
+        inline Quaternion const& GetOrientation() const { return GetWorldTransform().GetRotation(); }
         
         // Get world space forward vector
-        inline Vector GetForwardVector() const { return m_worldTransform.GetForwardVector(); }
+        inline Vector GetForwardVector() const { return GetWorldTransform().GetForwardVector(); }
 
         // Get world space up vector
-        inline Vector GetUpVector() const { return m_worldTransform.GetUpVector(); }
+        inline Vector GetUpVector() const { return GetWorldTransform().GetUpVector(); }
 
         // Get world space right vector
-        inline Vector GetRightVector() const { return m_worldTransform.GetRightVector(); }
+        inline Vector GetRightVector() const { return GetWorldTransform().GetRightVector(); }
 
         // Call to update the local transform - this will also update the world transform for this component and all children
+        // In deferred transform mode, the world transforms are only flagged as dirty and will be resolved in the next batched update or on the next read
         inline void SetLocalTransform( Transform const& newTransform )
         {
             m_transform = newTransform;
-            CalculateWorldTransform();
+
+            if ( IsInDeferredTransformMode() )
+            {
+                MarkWorldTransformDirty();
+            }
+            else
+            {
+                CalculateWorldTransform();
+            }
         }
 
         // Call to update the world transform - this will also updated the local transform for this component and all children's world transforms
@@ -81,6 +105,47 @@ namespace EE
             SetWorldTransformDirectly( newTransform );
         }
 
+        // Deferred Transforms
+        //-------------------------------------------------------------------------
+
+        // Are world transform updates for this component batched by the world? This is enabled on registration with a world that uses deferred transforms
+        inline bool IsInDeferredTransformMode() const { return m_pTransformResolver != nullptr; }
+
+        // Is the world transform waiting on a deferred update?
+        inline bool IsWorldTransformDirty() const { return m_worldTransformState.load( std::memory_order_acquire ) != WorldTransformState::Clean; }
+
+        // Synchronously update the world transform (and any dirty parents) if it is waiting on a deferred update
+        // This is safe to call from any thread, it only calculates the transform - the transform updated callback is always fired from the batched update
+        inline void ResolveWorldTransformIfDirty() const
+        {
+            if ( IsWorldTransformDirty() )
+            {
+                const_cast<SpatialEntityComponent*>( this )->ResolveWorldTransform();
+            }
+        }
+
+        // Get a counter that is incremented whenever the world transform changes, allows external systems to cheaply detect movement
+        inline uint32_t GetWorldTransformVersion() const { ResolveWorldTransformIfDirty(); return m_worldTransformVersion; }
+
+        // World Transform Change Tracking
+        //-------------------------------------------------------------------------
+        // A world system can register a queue that this component will add itself to whenever its world transform changes, so moving components can be tracked without polling
+        // The component is only added once, until the tracking system clears the queued flag. Only a single queue is supported per component.
+
+        using WorldTransformChangeQueue = Threading::LockFreeQueue<SpatialEntityComponent*>;
+
+        inline void SetWorldTransformChangeQueue( WorldTransformChangeQueue* pQueue )
+        {
+            EE_ASSERT( pQueue == nullptr || m_pWorldTransformChangeQueue == nullptr );
+            m_pWorldTransformChangeQueue = pQueue;
+            m_isQueuedForWorldTransformChange.store( false, std::memory_order_relaxed );
+        }
+
+        inline bool IsQueuedForWorldTransformChange() const { return m_isQueuedForWorldTransformChange.load( std::memory_order_acquire ); }
+
+        // Needs to be called by the tracking system before reading the transform of a dequeued component, so that any subsequent changes queue it again
+        inline void ClearQueuedForWorldTransformChange() { m_isQueuedForWorldTransformChange.store( false, std::memory_order_release ); }
+
         // Move the component by the specified delta transform
         inline void MoveByDelta( Transform const& deltaTransform )
         {
@@ -123,6 +188,12 @@ namespace EE
         // Apply an translation offset to all children, needed in many cases to maintain relative offset when a spatial component's bound change
         void ApplyOffsetToAllChildren( Vector const& offset );
 
+        // Spatial Queries
+        //-------------------------------------------------------------------------
+
+        // Components returning a valid category are tracked by the spatial query world system and can be found via proximity queries
+        virtual StringID GetSpatialQueryCategory() const { return StringID(); }
+
         // Local Scale
         //-------------------------------------------------------------------------
 
@@ -136,13 +207,13 @@ namespace EE
         //-------------------------------------------------------------------------
 
         // Convert a world transform to a component local transform
-        inline Transform ConvertWorldTransformToLocalTransform( Transform const& worldTransform ) const { return Transform::Delta( m_worldTransform, worldTransform ); }
+        inline Transform ConvertWorldTransformToLocalTransform( Transform const& worldTransform ) const { return Transform::Delta( GetWorldTransform(), worldTransform ); }
 
         // Convert a world point to a component local point 
-        inline Vector ConvertWorldPointToLocalPoint( Vector const& worldPoint ) const { return m_worldTransform.GetInverse().TransformPoint( worldPoint ); }
+        inline Vector ConvertWorldPointToLocalPoint( Vector const& worldPoint ) const { return GetWorldTransform().GetInverse().TransformPoint( worldPoint ); }
 
         // Convert a world direction to a component local direction 
-        inline Vector ConvertWorldVectorToLocalVector( Vector const& worldVector ) const { return m_worldTransform.GetInverse().RotateVector( worldVector ); }
+        inline Vector ConvertWorldVectorToLocalVector( Vector const& worldVector ) const { return GetWorldTransform().GetInverse().RotateVector( worldVector ); }
 
     protected:
 
@@ -165,7 +236,7 @@ namespace EE
         {
             EE_DEVELOPMENT_TOOLS_ONLY( m_boundsValidationGuard = true );
             m_bounds = CalculateLocalBounds();
-            m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
+            m_worldBounds = m_bounds.GetTransformed( GetWorldTransform() );
         }
 
         // Try to find and return the world space transform for the specified socket
@@ -192,22 +263,39 @@ namespace EE
             if ( m_pSpatialParent != nullptr )
             {
                 auto parentWorldTransform = m_pSpatialParent->GetAttachmentSocketTransform( m_parentAttachmentSocketID );
-                m_worldTransform = newWorldTransform;
-                m_transform = Transform::Delta( parentWorldTransform, m_worldTransform );
+                m_transform = Transform::Delta( parentWorldTransform, newWorldTransform );
             }
             else
             {
-                m_worldTransform = newWorldTransform;
                 m_transform = newWorldTransform;
             }
 
-            // Calculate world bounds
+            // In deferred mode, the callback will be fired once the world transform is resolved
+            if ( IsInDeferredTransformMode() && triggerCallback )
+            {
+                MarkWorldTransformDirty();
+                return;
+            }
+
+            // Any callback that is still pending from an earlier deferred update is left queued and will be fired by the batched update
+            // We need to wait for any concurrent on-demand resolve to complete, so that it cant overwrite the new transform
+            AcquireWorldTransformForWrite();
+            m_worldTransform = newWorldTransform;
             m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
+            NotifyWorldTransformChanged();
+            m_worldTransformState.store( WorldTransformState::Clean, std::memory_order_release );
 
             // Propagate the world transforms on the children - children will always have their callbacks fired!
-            for ( auto pChild : m_spatialChildren )
+            if ( IsInDeferredTransformMode() )
             {
-                pChild->CalculateWorldTransform();
+                MarkChildWorldTransformsDirty();
+            }
+            else
+            {
+                for ( auto pChild : m_spatialChildren )
+                {
+                    pChild->CalculateWorldTransform();
+                }
             }
 
             // Should we fire the transform updated callback?
@@ -225,6 +313,23 @@ namespace EE
 
         // Called whenever the local transform is modified
         inline void CalculateWorldTransform( bool triggerCallback = true )
+        {
+            UpdateWorldTransformFromParent();
+
+            // Propagate the world transforms on the children
+            for ( auto pChild : m_spatialChildren )
+            {
+                pChild->CalculateWorldTransform( triggerCallback );
+            }
+
+            if ( triggerCallback )
+            {
+                OnWorldTransformUpdated();
+            }
+        }
+
+        // Calculate the world transform and bounds from the local transform and our parent
+        inline void UpdateWorldTransformFromParent()
         {
             // Only update the transform if we have a parent, if we dont have a parent it means we are the root transform
             if ( m_pSpatialParent != nullptr )
@@ -237,27 +342,46 @@ namespace EE
                 m_worldTransform = m_transform;
             }
 
+            NotifyWorldTransformChanged();
+
             // Calculate world bounds
             m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
+        }
 
-            // Propagate the world transforms on the children
-            for ( auto pChild : m_spatialChildren )
-            {
-                pChild->CalculateWorldTransform( triggerCallback );
-            }
+        // Increment the transform version and add ourselves to the transform change queue, if we have one. This can be called from any thread.
+        inline void NotifyWorldTransformChanged()
+        {
+            m_worldTransformVersion++;
 
-            if ( triggerCallback )
+            if ( m_pWorldTransformChangeQueue != nullptr && !m_isQueuedForWorldTransformChange.exchange( true, std::memory_order_acq_rel ) )
             {
-                OnWorldTransformUpdated();
+                m_pWorldTransformChangeQueue->enqueue( this );
             }
         }
 
+        // Deferred mode: resolve a dirty world transform, this will first resolve our parents if needed
+        // Only a single thread will calculate the transform, any other threads reading it concurrently will wait for it to complete
+        void ResolveWorldTransform();
+
+        // Move the world transform state to 'Resolving', waiting for any other thread that is currently resolving it
+        void AcquireWorldTransformForWrite();
+
+        // Deferred mode: flag our world transform and the world transforms of all our children as dirty
+        void MarkWorldTransformDirty();
+
+        // Deferred mode: flag the world transforms of all our children as dirty
+        void MarkChildWorldTransformsDirty();
+
+        // Flag all children that are not yet dirty (and their children), returns true if any child was flagged that wasnt already waiting on a callback
+        bool MarkChildrenDirty();
+
     private:
 
         EE_REFLECT() Transform                                                 m_transform;                            // Local space transform
         OBB                                                                 m_bounds;                               // Local space bounding box
         Transform                                                           m_worldTransform;                       // World space transform (left uninitialized to catch initialization errors)
         OBB                                                                 m_worldBounds;                          // World space bounding box
+        uint32_t                                                            m_worldTransformVersion = 0;            // Incremented on each world transform change
 
         //-------------------------------------------------------------------------
 
@@ -267,6 +391,17 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        EntityTransformResolver*                                            m_pTransformResolver = nullptr;         // Set when in deferred transform mode
+        std::atomic<WorldTransformState>                                    m_worldTransformState = WorldTransformState::Clean; // If we are dirty, all our children are dirty too
+        bool                                                                m_isTransformCallbackPending = false;   // Set while dirty, only cleared once the batched update has fired the callback
+
+        //-------------------------------------------------------------------------
+
+        WorldTransformChangeQueue*                                          m_pWorldTransformChangeQueue = nullptr; // Optional queue that is notified of world transform changes
+        std::atomic<bool>                                                   m_isQueuedForWorldTransformChange = false;
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         bool                                                                m_boundsValidationGuard = false;
         #endif
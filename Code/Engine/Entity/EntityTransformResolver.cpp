@@ -0,0 +1,156 @@
+#include "EntityTransformResolver.h"
+#include "EntitySpatialComponent.h"
+#include "System/Profiling.h"
+#include <eastl/sort.h>
+#include <eastl/algorithm.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    // Parents are always resolved before their children, clean components still need to be walked since their children might be dirty
+    // Components that were already resolved on demand will only have their callback fired
+    void EntityTransformResolver::ResolveSubtree( SpatialEntityComponent* pComponent )
+    {
+        if ( pComponent->m_isTransformCallbackPending )
+        {
+            pComponent->ResolveWorldTransformIfDirty();
+            pComponent->m_isTransformCallbackPending = false;
+            pComponent->OnWorldTransformUpdated();
+        }
+
+        for ( auto pChild : pComponent->m_spatialChildren )
+        {
+            ResolveSubtree( pChild );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    EntityTransformResolver::ResolveTask::ResolveTask( TVector<DirtyComponent> const& dirtyComponents, TVector<uint32_t> const& hierarchyEnds )
+        : m_dirtyComponents( dirtyComponents )
+        , m_hierarchyEnds( hierarchyEnds )
+    {
+        m_SetSize = (uint32_t) hierarchyEnds.size();
+        m_MinRange = s_minHierarchiesPerTask;
+    }
+
+    void EntityTransformResolver::ResolveTask::ExecuteRange( TaskSetPartition range, uint32_t threadnum )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Resolve Transforms Task" );
+
+        for ( uint32_t i = range.start; i < range.end; ++i )
+        {
+            ResolveHierarchy( i );
+        }
+    }
+
+    void EntityTransformResolver::ResolveTask::ResolveHierarchy( uint32_t hierarchyIdx )
+    {
+        uint32_t const hierarchyStart = ( hierarchyIdx == 0 ) ? 0 : m_hierarchyEnds[hierarchyIdx - 1];
+        uint32_t const hierarchyEnd = m_hierarchyEnds[hierarchyIdx];
+
+        for ( uint32_t i = hierarchyStart; i < hierarchyEnd; ++i )
+        {
+            ResolveSubtree( m_dirtyComponents[i].m_pComponent );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityTransformResolver::Initialize( TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+        m_pTaskSystem = pTaskSystem;
+    }
+
+    void EntityTransformResolver::Shutdown()
+    {
+        EE_ASSERT( m_queuedComponents.size_approx() == 0 );
+        m_dequeuedComponents.clear();
+        m_dirtyComponents.clear();
+        m_hierarchyEnds.clear();
+        m_pTaskSystem = nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool EntityTransformResolver::GatherDirtyComponents()
+    {
+        m_dirtyComponents.clear();
+        m_hierarchyEnds.clear();
+
+        size_t const numQueued = m_queuedComponents.size_approx();
+        if ( numQueued == 0 )
+        {
+            return false;
+        }
+
+        m_dequeuedComponents.resize( numQueued );
+        size_t const numDequeued = m_queuedComponents.try_dequeue_bulk( m_dequeuedComponents.data(), numQueued );
+
+        // Find the hierarchy root for each queued component, hierarchies span attached entities
+        for ( size_t i = 0; i < numDequeued; i++ )
+        {
+            int32_t hierarchyDepth = 0;
+            SpatialEntityComponent* pHierarchyRoot = m_dequeuedComponents[i];
+            while ( pHierarchyRoot->m_pSpatialParent != nullptr )
+            {
+                pHierarchyRoot = pHierarchyRoot->m_pSpatialParent;
+                hierarchyDepth++;
+            }
+
+            m_dirtyComponents.push_back( { pHierarchyRoot, m_dequeuedComponents[i], hierarchyDepth } );
+        }
+
+        // Remove duplicates and group by hierarchy, sorted by depth within each hierarchy so that queued parents are resolved before queued children
+        eastl::sort( m_dirtyComponents.begin(), m_dirtyComponents.end() );
+        m_dirtyComponents.erase( eastl::unique( m_dirtyComponents.begin(), m_dirtyComponents.end() ), m_dirtyComponents.end() );
+
+        uint32_t const numDirtyComponents = (uint32_t) m_dirtyComponents.size();
+        for ( uint32_t i = 1; i < numDirtyComponents; i++ )
+        {
+            if ( m_dirtyComponents[i].m_pHierarchyRoot != m_dirtyComponents[i - 1].m_pHierarchyRoot )
+            {
+                m_hierarchyEnds.emplace_back( i );
+            }
+        }
+        m_hierarchyEnds.emplace_back( numDirtyComponents );
+
+        return true;
+    }
+
+    void EntityTransformResolver::ResolveTransforms()
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_numHierarchiesResolved = 0;
+        #endif
+
+        // Transform callbacks are allowed to move other components, so keep going until nothing new was queued
+        while ( GatherDirtyComponents() )
+        {
+            EE_PROFILE_SCOPE_ENTITY( "Resolve Transforms" );
+
+            ResolveTask resolveTask( m_dirtyComponents, m_hierarchyEnds );
+            uint32_t const numHierarchies = (uint32_t) m_hierarchyEnds.size();
+            if ( numHierarchies <= s_minHierarchiesPerTask )
+            {
+                for ( uint32_t i = 0; i < numHierarchies; i++ )
+                {
+                    resolveTask.ResolveHierarchy( i );
+                }
+            }
+            else
+            {
+                m_pTaskSystem->ScheduleTask( &resolveTask );
+                m_pTaskSystem->WaitForTask( &resolveTask );
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_numHierarchiesResolved += (int32_t) numHierarchies;
+            #endif
+        }
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Threading/Threading.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Entity Transform Resolver
+//-------------------------------------------------------------------------
+// Batched world transform propagation for spatial components in deferred transform mode
+//
+// * Setting a transform only updates the local transform and flags the component and all its spatial children as dirty
+// * The component that started the dirty subtree is queued, this is thread-safe so entities can be updated in parallel
+// * Each resolve pass walks all queued subtrees in hierarchy order, fires the transform updated callbacks once and clears the flags
+// * Queued components are grouped by their top-most spatial parent, independent hierarchies are resolved in parallel
+//
+// Reading a dirty world transform will resolve it (and any dirty parents) on demand, so explicit reads are always valid
+// On demand resolves only calculate the transform, the transform updated callbacks are only ever fired by the batched resolve
+
+namespace EE
+{
+    class SpatialEntityComponent;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API EntityTransformResolver
+    {
+        constexpr static uint32_t const s_minHierarchiesPerTask = 8;
+
+        struct DirtyComponent
+        {
+            // Grouped by hierarchy, parents always come before their children
+            inline bool operator<( DirtyComponent const& rhs ) const
+            {
+                if ( m_pHierarchyRoot != rhs.m_pHierarchyRoot )
+                {
+                    return m_pHierarchyRoot < rhs.m_pHierarchyRoot;
+                }
+
+                return ( m_hierarchyDepth != rhs.m_hierarchyDepth ) ? m_hierarchyDepth < rhs.m_hierarchyDepth : m_pComponent < rhs.m_pComponent;
+            }
+
+            inline bool operator==( DirtyComponent const& rhs ) const
+            {
+                return m_pHierarchyRoot == rhs.m_pHierarchyRoot && m_pComponent == rhs.m_pComponent;
+            }
+
+        public:
+
+            SpatialEntityComponent*                     m_pHierarchyRoot = nullptr;
+            SpatialEntityComponent*                     m_pComponent = nullptr;
+            int32_t                                     m_hierarchyDepth = 0;
+        };
+
+        struct ResolveTask final : public ITaskSet
+        {
+            ResolveTask( TVector<DirtyComponent> const& dirtyComponents, TVector<uint32_t> const& hierarchyEnds );
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final;
+            void ResolveHierarchy( uint32_t hierarchyIdx );
+
+        private:
+
+            TVector<DirtyComponent> const&              m_dirtyComponents;
+            TVector<uint32_t> const&                    m_hierarchyEnds;
+        };
+
+    public:
+
+        void Initialize( TaskSystem* pTaskSystem );
+        void Shutdown();
+
+        // Queue a component whose subtree was flagged as dirty - thread-safe
+        inline void QueueDirtyComponent( SpatialEntityComponent* pComponent ) { m_queuedComponents.enqueue( pComponent ); }
+
+        // Resolve all dirty world transforms, must be called from the main thread while no entity/system updates are running
+        void ResolveTransforms();
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline int32_t GetNumHierarchiesResolvedLastPass() const { return m_numHierarchiesResolved; }
+        #endif
+
+    private:
+
+        static void ResolveSubtree( SpatialEntityComponent* pComponent );
+
+        // Drain the queue, sort the dirty components by hierarchy and build the per-hierarchy ranges
+        bool GatherDirtyComponents();
+
+    private:
+
+        TaskSystem*                                     m_pTaskSystem = nullptr;
+        Threading::LockFreeQueue<SpatialEntityComponent*> m_queuedComponents;
+        TVector<SpatialEntityComponent*>                m_dequeuedComponents;
+        TVector<DirtyComponent>                         m_dirtyComponents;
+        TVector<uint32_t>                               m_hierarchyEnds;        // The (exclusive) end index of each hierarchy within the dirty component list
+
+        #if EE_DEVELOPMENT_TOOLS
+        int32_t                                         m_numHierarchiesResolved = 0;
+        #endif
+    };
+}
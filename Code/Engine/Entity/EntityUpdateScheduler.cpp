@@ -0,0 +1,192 @@
+#include "EntityUpdateScheduler.h"
+#include "EntityWorldUpdateContext.h"
+#include "EntityTransformResolver.h"
+#include "Entity.h"
+#include "System/Math/Math.h"
+#include "System/Time/Time.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    EntityUpdateScheduler::LevelUpdateTask::LevelUpdateTask( EntityWorldUpdateContext const& context, TVector<Entity*> const& level, TVector<uint32_t> const& partitionEnds )
+        : m_context( context )
+        , m_level( level )
+        , m_partitionEnds( partitionEnds )
+    {
+        m_SetSize = (uint32_t) partitionEnds.size();
+        m_MinRange = 1;
+    }
+
+    void EntityUpdateScheduler::LevelUpdateTask::ExecuteRange( TaskSetPartition range, uint32_t threadnum )
+    {
+        for ( uint32_t i = range.start; i < range.end; ++i )
+        {
+            UpdatePartition( i );
+        }
+    }
+
+    void EntityUpdateScheduler::LevelUpdateTask::UpdatePartition( uint32_t partitionIdx )
+    {
+        int8_t const stageIdx = (int8_t) m_context.GetUpdateStage();
+        uint32_t const partitionStart = ( partitionIdx == 0 ) ? 0 : m_partitionEnds[partitionIdx - 1];
+        uint32_t const partitionEnd = m_partitionEnds[partitionIdx];
+
+        for ( uint32_t i = partitionStart; i < partitionEnd; ++i )
+        {
+            EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
+
+            Entity* pEntity = m_level[i];
+            Nanoseconds const startTime = PlatformClock::GetTime();
+            pEntity->UpdateSystems( m_context );
+            pEntity->m_updateCosts[stageIdx] = Microseconds( PlatformClock::GetTime() - startTime ).ToFloat();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityUpdateScheduler::Initialize( TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( pTaskSystem != nullptr );
+        m_pTaskSystem = pTaskSystem;
+    }
+
+    void EntityUpdateScheduler::Shutdown()
+    {
+        m_levels.clear();
+        m_partitionEnds.clear();
+        m_numLevels = 0;
+        m_pTaskSystem = nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityUpdateScheduler::BuildLevels( TVector<Entity*> const& entityUpdateList )
+    {
+        for ( auto& level : m_levels )
+        {
+            level.clear();
+        }
+
+        if ( m_levels.empty() )
+        {
+            m_levels.emplace_back();
+        }
+
+        // Root level - entities with spatial parents are reached via their parents
+        for ( auto pEntity : entityUpdateList )
+        {
+            if ( !pEntity->HasSpatialParent() )
+            {
+                m_levels[0].emplace_back( pEntity );
+            }
+        }
+
+        // Attached entities - each level is the set of entities attached to the previous level
+        m_numLevels = 1;
+        while ( true )
+        {
+            if ( m_numLevels == m_levels.size() )
+            {
+                m_levels.emplace_back();
+            }
+
+            TVector<Entity*> const& parentLevel = m_levels[m_numLevels - 1];
+            TVector<Entity*>& childLevel = m_levels[m_numLevels];
+            for ( auto pEntity : parentLevel )
+            {
+                for ( auto pAttachedEntity : pEntity->GetAttachedEntities() )
+                {
+                    childLevel.emplace_back( pAttachedEntity );
+                }
+            }
+
+            if ( childLevel.empty() )
+            {
+                break;
+            }
+
+            m_numLevels++;
+        }
+    }
+
+    void EntityUpdateScheduler::BuildPartitions( UpdateStage stage, TVector<Entity*> const& level )
+    {
+        m_partitionEnds.clear();
+
+        int8_t const stageIdx = (int8_t) stage;
+        uint32_t const numEntities = (uint32_t) level.size();
+
+        // Estimate the level cost from last update's measurements
+        //-------------------------------------------------------------------------
+
+        float totalCost = 0.0f;
+        for ( auto pEntity : level )
+        {
+            float const cost = pEntity->m_updateCosts[stageIdx];
+            totalCost += ( cost > 0.0f ) ? cost : s_defaultEntityUpdateCost;
+        }
+
+        // Greedily fill each partition up to the target cost
+        //-------------------------------------------------------------------------
+
+        uint32_t const numPartitions = Math::Min( numEntities, ( m_pTaskSystem->GetNumWorkers() + 1 ) * s_partitionsPerWorker );
+        float const targetPartitionCost = totalCost / numPartitions;
+
+        float partitionCost = 0.0f;
+        for ( uint32_t i = 0; i < numEntities; i++ )
+        {
+            float const cost = level[i]->m_updateCosts[stageIdx];
+            partitionCost += ( cost > 0.0f ) ? cost : s_defaultEntityUpdateCost;
+
+            if ( partitionCost >= targetPartitionCost )
+            {
+                m_partitionEnds.emplace_back( i + 1 );
+                partitionCost = 0.0f;
+            }
+        }
+
+        if ( m_partitionEnds.empty() || m_partitionEnds.back() != numEntities )
+        {
+            m_partitionEnds.emplace_back( numEntities );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityUpdateScheduler::UpdateEntities( EntityWorldUpdateContext const& context, TVector<Entity*> const& entityUpdateList, EntityTransformResolver* pTransformResolver )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
+        BuildLevels( entityUpdateList );
+
+        for ( int32_t levelIdx = 0; levelIdx < m_numLevels; levelIdx++ )
+        {
+            TVector<Entity*> const& level = m_levels[levelIdx];
+            if ( level.empty() )
+            {
+                continue;
+            }
+
+            BuildPartitions( context.GetUpdateStage(), level );
+
+            // The task system wait acts as the barrier between levels
+            LevelUpdateTask levelUpdateTask( context, level, m_partitionEnds );
+            if ( m_partitionEnds.size() == 1 )
+            {
+                levelUpdateTask.UpdatePartition( 0 );
+            }
+            else
+            {
+                m_pTaskSystem->ScheduleTask( &levelUpdateTask );
+                m_pTaskSystem->WaitForTask( &levelUpdateTask );
+            }
+
+            if ( pTransformResolver != nullptr )
+            {
+                pTransformResolver->ResolveTransforms();
+            }
+        }
+    }
+}
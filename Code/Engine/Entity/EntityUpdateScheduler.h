@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/UpdateStage.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Entity Update Scheduler
+//-------------------------------------------------------------------------
+// Splits the entity update list into spatial hierarchy depth levels and updates each level in parallel
+//
+// * Level 0 contains all entities without a spatial parent, level N contains the entities attached to level N-1
+// * Each level is only started once the previous level is complete, so attached entities are always updated after their parents
+// * Each level is split into partitions of roughly equal cost, using the update time measured for each entity on its last update
+//
+// This allows long attachment chains (i.e. a vehicle with lots of attached entities) to be spread across all workers
+
+namespace EE
+{
+    class Entity;
+    class EntityWorldUpdateContext;
+    class EntityTransformResolver;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API EntityUpdateScheduler
+    {
+        constexpr static uint32_t const s_partitionsPerWorker = 4;
+        constexpr static float const s_defaultEntityUpdateCost = 5.0f;      // The cost (in microseconds) assumed for entities that have not been measured yet
+
+        struct LevelUpdateTask final : public ITaskSet
+        {
+            LevelUpdateTask( EntityWorldUpdateContext const& context, TVector<Entity*> const& level, TVector<uint32_t> const& partitionEnds );
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final;
+            void UpdatePartition( uint32_t partitionIdx );
+
+        private:
+
+            EntityWorldUpdateContext const&             m_context;
+            TVector<Entity*> const&                     m_level;
+            TVector<uint32_t> const&                    m_partitionEnds;
+        };
+
+    public:
+
+        void Initialize( TaskSystem* pTaskSystem );
+        void Shutdown();
+
+        // Update all entities for the context's update stage, if a transform resolver is supplied, dirty transforms are resolved after each level
+        void UpdateEntities( EntityWorldUpdateContext const& context, TVector<Entity*> const& entityUpdateList, EntityTransformResolver* pTransformResolver = nullptr );
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline int32_t GetNumLevels() const { return m_numLevels; }
+        inline uint32_t GetNumEntitiesInLevel( int32_t levelIdx ) const { EE_ASSERT( levelIdx >= 0 && levelIdx < m_numLevels ); return (uint32_t) m_levels[levelIdx].size(); }
+        #endif
+
+    private:
+
+        // Sort the update list into depth levels, the level storage is reused across updates
+        void BuildLevels( TVector<Entity*> const& entityUpdateList );
+
+        // Split a level into contiguous partitions of roughly equal estimated cost
+        void BuildPartitions( UpdateStage stage, TVector<Entity*> const& level );
+
+    private:
+
+        TaskSystem*                                     m_pTaskSystem = nullptr;
+        TVector<TVector<Entity*>>                       m_levels;
+        int32_t                                         m_numLevels = 0;
+        TVector<uint32_t>                               m_partitionEnds;        // The (exclusive) end index of each partition within the level being updated
+    };
+}
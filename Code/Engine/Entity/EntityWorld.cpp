@@ -91,6 +91,16 @@ namespace EE
             }
         }
 
+        m_entityUpdateScheduler.Initialize( m_pTaskSystem );
+        m_systemScheduler.Initialize( m_pTaskSystem, m_systemUpdateLists );
+        m_transformResolver.Initialize( m_pTaskSystem );
+
+        // Game worlds batch their spatial transform updates, tools worlds keep immediate updates for editing
+        if ( IsGameWorld() )
+        {
+            m_initializationContext.m_pTransformResolver = &m_transformResolver;
+        }
+
         // Create and initialize the persistent map
         //-------------------------------------------------------------------------
 
@@ -104,6 +114,15 @@ namespace EE
 
     void EntityWorld::Shutdown()
     {
+        // Destroy entity pools, the pooled entities are unloaded along with the persistent map
+        //-------------------------------------------------------------------------
+
+        for ( auto& pPool : m_entityPools )
+        {
+            EE::Delete( pPool );
+        }
+        m_entityPools.clear();
+
         // Unload maps
         //-------------------------------------------------------------------------
         
@@ -123,6 +142,11 @@ namespace EE
         // Shutdown all world systems
         //-------------------------------------------------------------------------
 
+        m_entityUpdateScheduler.Shutdown();
+        m_transformResolver.Shutdown();
+        m_initializationContext.m_pTransformResolver = nullptr;
+        m_systemScheduler.Shutdown();
+
         for( auto pWorldSystem : m_worldSystems )
         {
             // Remove from update lists
@@ -203,6 +227,9 @@ namespace EE
     {
         EE_PROFILE_SCOPE_ENTITY( "World Loading" );
 
+        // Entities might be unloaded or destroyed, so no transform updates can be pending
+        m_transformResolver.ResolveTransforms();
+
         // Update all maps internal loading state
         //-------------------------------------------------------------------------
         // This will fill the world initialization/registration lists used below
@@ -219,6 +246,15 @@ namespace EE
                 }
             }
         }
+
+        // Update pooled instances
+        //-------------------------------------------------------------------------
+        // Needs to happen after the map update since that is where pooled entities are loaded, shutdown and reset
+
+        for ( auto pPool : m_entityPools )
+        {
+            pPool->UpdateState();
+        }
     }
 
     void EntityWorld::Update( UpdateContext const& context )
@@ -226,61 +262,6 @@ namespace EE
         EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( !m_isSuspended );
 
-        struct EntityUpdateTask final : public ITaskSet
-        {
-            EntityUpdateTask( EntityWorldUpdateContext const& context, TVector<Entity*>& updateList )
-                : m_context( context )
-                , m_updateList( updateList )
-            {
-                m_SetSize = (uint32_t) updateList.size();
-            }
-
-            // Only used for spatial dependency chain updates
-            inline void RecursiveEntityUpdate( Entity* pEntity )
-            {
-                pEntity->UpdateSystems( m_context );
-
-                for ( auto pAttachedEntity : pEntity->GetAttachedEntities() )
-                {
-                    RecursiveEntityUpdate( pAttachedEntity );
-                }
-            }
-
-            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
-            {
-                for ( uint64_t i = range.start; i < range.end; ++i )
-                {
-                    auto pEntity = m_updateList[i];
-
-                    // Ignore any entities with spatial parents, these will be updated by their parents
-                    if ( pEntity->HasSpatialParent() )
-                    {
-                        continue;
-                    }
-
-                    //-------------------------------------------------------------------------
-
-                    if ( pEntity->HasAttachedEntities() )
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity Chain" );
-                        RecursiveEntityUpdate( pEntity );
-                    }
-                    else // Direct entity update
-                    {
-                        EE_PROFILE_SCOPE_ENTITY( "Update Entity" );
-                        pEntity->UpdateSystems( m_context );
-                    }
-                }
-            }
-
-        private:
-
-            EntityWorldUpdateContext const&              m_context;
-            TVector<Entity*>&                            m_updateList;
-        };
-
-        //-------------------------------------------------------------------------
-
         UpdateStage const updateStage = context.GetUpdateStage();
         bool const isWorldPaused = IsPaused() && !m_timeStepRequested;
 
@@ -303,21 +284,21 @@ namespace EE
         // Update entities
         //-------------------------------------------------------------------------
 
-        EntityUpdateTask entityUpdateTask( entityWorldUpdateContext, m_entityUpdateList );
-        m_pTaskSystem->ScheduleTask( &entityUpdateTask );
-        m_pTaskSystem->WaitForTask( &entityUpdateTask );
+        // Entities are updated in spatial hierarchy levels, each level is split across all workers based on the measured entity update cost
+        // Any deferred transform updates are resolved after each level, so attached entities always see up to date parent transforms
 
-        // Force execution on main thread for debugging purposes
-        //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
+        m_entityUpdateScheduler.UpdateEntities( entityWorldUpdateContext, m_entityUpdateList, m_initializationContext.m_pTransformResolver );
 
         // Update systems
         //-------------------------------------------------------------------------
+        // Systems with declared access are updated concurrently where possible, all others are updated serially in priority order
 
-        for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
+        m_systemScheduler.UpdateSystems( entityWorldUpdateContext );
+
+        // Resolve any transforms modified by the systems, so the next stage starts with a clean hierarchy
+        if ( m_initializationContext.m_pTransformResolver != nullptr )
         {
-            EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
-            EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
-            pSystem->UpdateSystem( entityWorldUpdateContext );
+            m_transformResolver.ResolveTransforms();
         }
 
         //-------------------------------------------------------------------------
@@ -410,6 +391,24 @@ namespace EE
         return pNewMap;
     }
 
+    EntityModel::EntityPool* EntityWorld::CreateEntityPool( EntityModel::SerializedEntityCollection const& entityCollectionDesc, int32_t numInstances )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+        return m_entityPools.emplace_back( EE::New<EntityModel::EntityPool>( GetPersistentMap(), m_pTaskSystem, *m_loadingContext.m_pTypeRegistry, entityCollectionDesc, numInstances ) );
+    }
+
+    void EntityWorld::DestroyEntityPool( EntityModel::EntityPool* pPool )
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        auto foundIter = VectorFind( m_entityPools, pPool );
+        EE_ASSERT( foundIter != m_entityPools.end() );
+        m_entityPools.erase_unsorted( foundIter );
+
+        pPool->DestroyEntities();
+        EE::Delete( pPool );
+    }
+
     EntityModel::EntityMap const* EntityWorld::GetMap( ResourceID const& mapResourceID ) const
     {
         EE_ASSERT( mapResourceID.IsValid() && mapResourceID.GetResourceTypeID() == EntityModel::SerializedEntityMap::GetStaticResourceTypeID() );
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "EntityWorldSystem.h"
+#include "EntityWorldSystemScheduler.h"
+#include "EntityUpdateScheduler.h"
+#include "EntityTransformResolver.h"
 #include "EntityContexts.h"
 #include "Entity.h"
 #include "EntityMap.h"
+#include "EntityPool.h"
 #include "System/Render/RenderViewport.h"
 #include "System/Types/Arrays.h"
 #include "System/Drawing/DebugDrawingSystem.h"
@@ -175,6 +179,21 @@ namespace EE
             return pEntity;
         }
 
+        //-------------------------------------------------------------------------
+        // Entity Pools
+        //-------------------------------------------------------------------------
+        // Pools keep a set of pre-warmed instances of a collection loaded in the persistent map, use these for frequently spawned/destroyed entities
+        // The entity collection needs to stay loaded for the lifetime of the pool
+
+        // Create a new pool with the specified number of instances, instances only become available once they have finished loading
+        EntityModel::EntityPool* CreateEntityPool( EntityModel::SerializedEntityCollection const& entityCollectionDesc, int32_t numInstances );
+
+        // Destroy a pool and all its entities, this includes the instances that are still active
+        void DestroyEntityPool( EntityModel::EntityPool* pPool );
+
+        // Get all the pools in this world
+        inline TVector<EntityModel::EntityPool*> const& GetEntityPools() const { return m_entityPools; }
+
         //-------------------------------------------------------------------------
         // Editor
         //-------------------------------------------------------------------------
@@ -252,6 +271,8 @@ namespace EE
 
         inline Drawing::DrawingSystem* GetDebugDrawingSystem() { return &m_debugDrawingSystem; }
         inline void ResetDebugDrawingSystem() { m_debugDrawingSystem.Reset(); }
+
+        inline EntityWorldSystemScheduler const& GetSystemScheduler() const { return m_systemScheduler; }
         #endif
 
         //-------------------------------------------------------------------------
@@ -281,10 +302,14 @@ namespace EE
 
         // Maps
         TInlineVector<EntityModel::EntityMap*, 3>                               m_maps;
+        TVector<EntityModel::EntityPool*>                                       m_entityPools;
 
         // Entities
         TVector<Entity*>                                                        m_entityUpdateList;
+        EntityUpdateScheduler                                                   m_entityUpdateScheduler;
+        EntityTransformResolver                                                 m_transformResolver;
         TVector<IEntityWorldSystem*>                                            m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        EntityWorldSystemScheduler                                              m_systemScheduler;
 
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
@@ -1,3 +1,70 @@
 #include "EntityWorldSystem.h"
+#include "System/TypeSystem/TypeInfo.h"
 
 //-------------------------------------------------------------------------
+
+namespace EE
+{
+    bool WorldSystemAccess::IsComponentTypeRead( TypeSystem::TypeInfo const* pTypeInfo ) const
+    {
+        for ( auto pReadTypeInfo : m_readComponentTypes )
+        {
+            if ( pReadTypeInfo->IsDerivedFrom( pTypeInfo->m_ID ) || pTypeInfo->IsDerivedFrom( pReadTypeInfo->m_ID ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool WorldSystemAccess::IsComponentTypeWritten( TypeSystem::TypeInfo const* pTypeInfo ) const
+    {
+        for ( auto pWrittenTypeInfo : m_writtenComponentTypes )
+        {
+            if ( pWrittenTypeInfo->IsDerivedFrom( pTypeInfo->m_ID ) || pTypeInfo->IsDerivedFrom( pWrittenTypeInfo->m_ID ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool WorldSystemAccess::TouchesWritesOf( uint32_t otherSystemID, WorldSystemAccess const& otherAccess ) const
+    {
+        // Systems always write to themselves
+        if ( IsSystemRead( otherSystemID ) || IsSystemWritten( otherSystemID ) )
+        {
+            return true;
+        }
+
+        for ( auto writtenSystemID : otherAccess.m_writtenSystemIDs )
+        {
+            if ( IsSystemRead( writtenSystemID ) || IsSystemWritten( writtenSystemID ) )
+            {
+                return true;
+            }
+        }
+
+        for ( auto pWrittenTypeInfo : otherAccess.m_writtenComponentTypes )
+        {
+            if ( IsComponentTypeRead( pWrittenTypeInfo ) || IsComponentTypeWritten( pWrittenTypeInfo ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool WorldSystemAccess::HasConflict( uint32_t systemID, WorldSystemAccess const& access, uint32_t otherSystemID, WorldSystemAccess const& otherAccess )
+    {
+        if ( systemID == otherSystemID )
+        {
+            return true;
+        }
+
+        return access.TouchesWritesOf( otherSystemID, otherAccess ) || otherAccess.TouchesWritesOf( systemID, access );
+    }
+}
@@ -21,6 +21,51 @@ namespace EE
     class EntityComponent;
     namespace EntityModel { class EntityMap; }
 
+    //-------------------------------------------------------------------------
+    // World System Access
+    //-------------------------------------------------------------------------
+    // Declares the component types and other world systems that a world system reads/writes during its update
+    // A world system always implicitly writes to itself
+    // Component access is hierarchy aware, i.e. writing a base component type conflicts with reading any derived type
+
+    class EE_ENGINE_API WorldSystemAccess
+    {
+    public:
+
+        template<typename T> inline WorldSystemAccess& ReadsComponent() { m_readComponentTypes.emplace_back( T::s_pTypeInfo ); return *this; }
+        template<typename T> inline WorldSystemAccess& WritesComponent() { m_writtenComponentTypes.emplace_back( T::s_pTypeInfo ); return *this; }
+        template<typename T> inline WorldSystemAccess& ReadsWorldSystem() { m_readSystemIDs.emplace_back( T::s_entitySystemID ); return *this; }
+        template<typename T> inline WorldSystemAccess& WritesWorldSystem() { m_writtenSystemIDs.emplace_back( T::s_entitySystemID ); return *this; }
+
+        inline void Clear()
+        {
+            m_readComponentTypes.clear();
+            m_writtenComponentTypes.clear();
+            m_readSystemIDs.clear();
+            m_writtenSystemIDs.clear();
+        }
+
+        // Can the two systems be updated concurrently?
+        static bool HasConflict( uint32_t systemID, WorldSystemAccess const& access, uint32_t otherSystemID, WorldSystemAccess const& otherAccess );
+
+    private:
+
+        bool IsComponentTypeRead( TypeSystem::TypeInfo const* pTypeInfo ) const;
+        bool IsComponentTypeWritten( TypeSystem::TypeInfo const* pTypeInfo ) const;
+        bool IsSystemRead( uint32_t systemID ) const { return VectorContains( m_readSystemIDs, systemID ); }
+        bool IsSystemWritten( uint32_t systemID ) const { return VectorContains( m_writtenSystemIDs, systemID ); }
+
+        // Does this access (reading or writing) touch any of the component types or systems written by the other access
+        bool TouchesWritesOf( uint32_t otherSystemID, WorldSystemAccess const& otherAccess ) const;
+
+    private:
+
+        TInlineVector<TypeSystem::TypeInfo const*, 4>   m_readComponentTypes;
+        TInlineVector<TypeSystem::TypeInfo const*, 4>   m_writtenComponentTypes;
+        TInlineVector<uint32_t, 4>                      m_readSystemIDs;
+        TInlineVector<uint32_t, 4>                      m_writtenSystemIDs;
+    };
+
     //-------------------------------------------------------------------------
 
     class EE_ENGINE_API IEntityWorldSystem : public IReflectedType
@@ -28,6 +73,7 @@ namespace EE
         EE_REFLECT_TYPE( IEntityWorldSystem );
 
         friend class EntityWorld;
+        friend class EntityWorldSystemScheduler;
         friend EntityModel::EntityMap;
 
     public:
@@ -45,6 +91,10 @@ namespace EE
         // Get the required update stages and priorities for this component
         virtual UpdatePriorityList const& GetRequiredUpdatePriorities() = 0;
 
+        // Declare the data this system accesses when updating the specified stage, this allows it to be updated concurrently with other non-conflicting systems
+        // Returning false means the access is unknown, so the system will be updated on the main thread in priority order with respect to all other systems
+        virtual bool GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const { return false; }
+
         // Called when the system is registered with the world - using explicit "EntitySystem" name to allow for a standalone initialize function
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) {};
 
@@ -0,0 +1,305 @@
+#include "EntityWorldSystemScheduler.h"
+#include "EntityWorldUpdateContext.h"
+#include "System/Time/Timers.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    void EntityWorldSystemScheduler::SystemNode::Update()
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
+        EE_ASSERT( m_pContext != nullptr );
+        EE_ASSERT( m_pSystem->GetRequiredUpdatePriorities().IsStageEnabled( m_pContext->GetUpdateStage() ) );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_startTime = PlatformClock::GetTime();
+        #endif
+
+        m_pSystem->UpdateSystem( *m_pContext );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_endTime = PlatformClock::GetTime();
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityWorldSystemScheduler::Initialize( TaskSystem* pTaskSystem, TVector<IEntityWorldSystem*> const* pSystemUpdateLists )
+    {
+        EE_ASSERT( !m_isInitialized );
+        EE_ASSERT( pTaskSystem != nullptr && pSystemUpdateLists != nullptr );
+        m_pTaskSystem = pTaskSystem;
+
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            BuildStageSchedule( (UpdateStage) i, pSystemUpdateLists[i], m_stageSchedules[i] );
+        }
+
+        m_isInitialized = true;
+    }
+
+    void EntityWorldSystemScheduler::Shutdown()
+    {
+        EE_ASSERT( m_isInitialized );
+
+        for ( auto& schedule : m_stageSchedules )
+        {
+            // Dependencies reference the nodes so need to be cleared first
+            schedule.m_dependencies.clear();
+
+            for ( auto pNode : schedule.m_nodes )
+            {
+                EE_ASSERT( pNode->GetIsComplete() );
+                EE::Delete( pNode );
+            }
+
+            schedule.m_nodes.clear();
+            schedule.m_groupStartIndices.clear();
+            schedule.m_isConcurrentGroup.clear();
+
+            #if EE_DEVELOPMENT_TOOLS
+            schedule.m_criticalPath.clear();
+            #endif
+        }
+
+        m_pTaskSystem = nullptr;
+        m_isInitialized = false;
+    }
+
+    void EntityWorldSystemScheduler::BuildStageSchedule( UpdateStage stage, TVector<IEntityWorldSystem*> const& systemUpdateList, StageSchedule& schedule )
+    {
+        EE_ASSERT( schedule.m_nodes.empty() && schedule.m_dependencies.empty() );
+
+        int32_t const numSystems = (int32_t) systemUpdateList.size();
+        if ( numSystems == 0 )
+        {
+            return;
+        }
+
+        // Create nodes and gather the declared access
+        //-------------------------------------------------------------------------
+
+        TVector<WorldSystemAccess> systemAccess;
+        systemAccess.resize( numSystems );
+
+        for ( int32_t i = 0; i < numSystems; i++ )
+        {
+            auto pNode = schedule.m_nodes.emplace_back( EE::New<SystemNode>( systemUpdateList[i] ) );
+            pNode->m_isBarrier = !systemUpdateList[i]->GetUpdateAccess( stage, systemAccess[i] );
+        }
+
+        // Group consecutive declared systems, barriers are always in a group of their own
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < numSystems; i++ )
+        {
+            bool const startsNewGroup = ( i == 0 ) || schedule.m_nodes[i]->m_isBarrier || schedule.m_nodes[i - 1]->m_isBarrier;
+            if ( startsNewGroup )
+            {
+                schedule.m_groupStartIndices.emplace_back( i );
+            }
+
+            schedule.m_nodes[i]->m_groupIdx = (int32_t) schedule.m_groupStartIndices.size() - 1;
+        }
+
+        // Order conflicting systems within each group by priority
+        //-------------------------------------------------------------------------
+
+        int32_t const numGroups = (int32_t) schedule.m_groupStartIndices.size();
+        schedule.m_isConcurrentGroup.resize( numGroups, false );
+
+        TVector<int32_t> nodeLevels;
+        nodeLevels.resize( numSystems, 0 );
+
+        int32_t numDependencies = 0;
+        for ( int32_t groupIdx = 0; groupIdx < numGroups; groupIdx++ )
+        {
+            int32_t const groupStart = schedule.m_groupStartIndices[groupIdx];
+            int32_t const groupEnd = ( groupIdx + 1 < numGroups ) ? schedule.m_groupStartIndices[groupIdx + 1] : numSystems;
+            if ( schedule.m_nodes[groupStart]->m_isBarrier )
+            {
+                continue;
+            }
+
+            int32_t maxLevel = 0;
+            for ( int32_t j = groupStart; j < groupEnd; j++ )
+            {
+                SystemNode* pNode = schedule.m_nodes[j];
+                uint32_t const systemID = pNode->m_pSystem->GetSystemID();
+
+                for ( int32_t i = groupStart; i < j; i++ )
+                {
+                    if ( WorldSystemAccess::HasConflict( schedule.m_nodes[i]->m_pSystem->GetSystemID(), systemAccess[i], systemID, systemAccess[j] ) )
+                    {
+                        pNode->m_predecessors.emplace_back( i );
+                        nodeLevels[j] = Math::Max( nodeLevels[j], nodeLevels[i] + 1 );
+                        numDependencies++;
+                    }
+                }
+
+                maxLevel = Math::Max( maxLevel, nodeLevels[j] );
+            }
+
+            // If every system is in its own level, the group is fully serial
+            schedule.m_isConcurrentGroup[groupIdx] = ( maxLevel + 1 ) < ( groupEnd - groupStart );
+        }
+
+        // Create the task dependencies - the storage is sized once since the dependencies cannot move after being set
+        //-------------------------------------------------------------------------
+
+        schedule.m_dependencies.resize( numDependencies );
+
+        int32_t dependencyIdx = 0;
+        for ( auto pNode : schedule.m_nodes )
+        {
+            if ( !schedule.m_isConcurrentGroup[pNode->m_groupIdx] )
+            {
+                continue;
+            }
+
+            for ( auto predecessorIdx : pNode->m_predecessors )
+            {
+                schedule.m_dependencies[dependencyIdx++].SetDependency( schedule.m_nodes[predecessorIdx], pNode );
+            }
+        }
+
+        schedule.m_dependencies.resize( dependencyIdx );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void EntityWorldSystemScheduler::UpdateSystems( EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( m_isInitialized );
+
+        StageSchedule& schedule = m_stageSchedules[(int8_t) context.GetUpdateStage()];
+
+        #if EE_DEVELOPMENT_TOOLS
+        Timer<PlatformClock> stageTimer;
+        #endif
+
+        int32_t const numNodes = (int32_t) schedule.m_nodes.size();
+        int32_t const numGroups = (int32_t) schedule.m_groupStartIndices.size();
+        for ( int32_t groupIdx = 0; groupIdx < numGroups; groupIdx++ )
+        {
+            int32_t const groupStart = schedule.m_groupStartIndices[groupIdx];
+            int32_t const groupEnd = ( groupIdx + 1 < numGroups ) ? schedule.m_groupStartIndices[groupIdx + 1] : numNodes;
+
+            for ( int32_t i = groupStart; i < groupEnd; i++ )
+            {
+                schedule.m_nodes[i]->m_pContext = &context;
+            }
+
+            // Barriers and fully serial groups are updated directly in priority order
+            if ( !schedule.m_isConcurrentGroup[groupIdx] )
+            {
+                for ( int32_t i = groupStart; i < groupEnd; i++ )
+                {
+                    schedule.m_nodes[i]->Update();
+                }
+                continue;
+            }
+
+            // Kick off all systems without predecessors, the rest are scheduled by the task system once their predecessors complete
+            for ( int32_t i = groupStart; i < groupEnd; i++ )
+            {
+                if ( schedule.m_nodes[i]->m_predecessors.empty() )
+                {
+                    m_pTaskSystem->ScheduleTask( schedule.m_nodes[i] );
+                }
+            }
+
+            for ( int32_t i = groupStart; i < groupEnd; i++ )
+            {
+                m_pTaskSystem->WaitForTask( schedule.m_nodes[i] );
+            }
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        schedule.m_stageTime = stageTimer.GetElapsedTimeMilliseconds();
+        CalculateCriticalPath( schedule );
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    void EntityWorldSystemScheduler::CalculateCriticalPath( StageSchedule& schedule )
+    {
+        schedule.m_criticalPath.clear();
+        schedule.m_criticalPathTime = 0.0f;
+        schedule.m_totalSystemTime = 0.0f;
+
+        int32_t const numNodes = (int32_t) schedule.m_nodes.size();
+        if ( numNodes == 0 )
+        {
+            return;
+        }
+
+        // Calculate the longest (by update time) chain ending at each node
+        // Every node depends on its predecessors, or on the slowest chain of the previous group if it has none
+        //-------------------------------------------------------------------------
+
+        TInlineVector<float, 32> pathTimes;
+        TInlineVector<int32_t, 32> pathPrevious;
+        pathTimes.resize( numNodes, 0.0f );
+        pathPrevious.resize( numNodes, InvalidIndex );
+
+        int32_t previousGroupEndNodeIdx = InvalidIndex;
+        int32_t currentGroupIdx = 0;
+        int32_t currentGroupEndNodeIdx = InvalidIndex;
+
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            SystemNode const* pNode = schedule.m_nodes[i];
+
+            if ( pNode->m_groupIdx != currentGroupIdx )
+            {
+                previousGroupEndNodeIdx = currentGroupEndNodeIdx;
+                currentGroupIdx = pNode->m_groupIdx;
+            }
+
+            float const duration = Milliseconds( pNode->m_endTime - pNode->m_startTime ).ToFloat();
+            schedule.m_totalSystemTime += duration;
+
+            // Serial groups are a single chain
+            int32_t longestPreviousIdx = previousGroupEndNodeIdx;
+            if ( !schedule.m_isConcurrentGroup[currentGroupIdx] && i > schedule.m_groupStartIndices[currentGroupIdx] )
+            {
+                longestPreviousIdx = i - 1;
+            }
+            else if ( !pNode->m_predecessors.empty() )
+            {
+                longestPreviousIdx = pNode->m_predecessors[0];
+                for ( auto predecessorIdx : pNode->m_predecessors )
+                {
+                    if ( pathTimes[predecessorIdx] > pathTimes[longestPreviousIdx] )
+                    {
+                        longestPreviousIdx = predecessorIdx;
+                    }
+                }
+            }
+
+            pathPrevious[i] = longestPreviousIdx;
+            pathTimes[i] = duration + ( ( longestPreviousIdx != InvalidIndex ) ? pathTimes[longestPreviousIdx] : 0.0f );
+
+            if ( currentGroupEndNodeIdx == InvalidIndex || schedule.m_nodes[currentGroupEndNodeIdx]->m_groupIdx != currentGroupIdx || pathTimes[i] > pathTimes[currentGroupEndNodeIdx] )
+            {
+                currentGroupEndNodeIdx = i;
+            }
+        }
+
+        // Walk back from the end of the slowest chain
+        //-------------------------------------------------------------------------
+
+        schedule.m_criticalPathTime = pathTimes[currentGroupEndNodeIdx];
+
+        for ( int32_t nodeIdx = currentGroupEndNodeIdx; nodeIdx != InvalidIndex; nodeIdx = pathPrevious[nodeIdx] )
+        {
+            schedule.m_criticalPath.insert( schedule.m_criticalPath.begin(), nodeIdx );
+        }
+    }
+    #endif
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include "EntityWorldSystem.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// World System Scheduler
+//-------------------------------------------------------------------------
+// Builds a dependency graph per update stage from the access declared by each world system (see 'WorldSystemAccess')
+//
+// * Runs of consecutive systems with declared access form a group; within a group, conflicting systems are
+//   ordered by priority and all other systems are updated concurrently on the task system
+// * Systems without declared access act as barriers between groups: they are updated on the calling thread in priority order
+//
+// With no declared access this degenerates to the original serial priority-ordered update
+
+namespace EE
+{
+    class EntityWorldUpdateContext;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API EntityWorldSystemScheduler
+    {
+    public:
+
+        struct SystemNode final : public ITaskSet
+        {
+            SystemNode( IEntityWorldSystem* pSystem ) : m_pSystem( pSystem ) { m_SetSize = 1; }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final { Update(); }
+            void Update();
+
+        public:
+
+            IEntityWorldSystem*                     m_pSystem = nullptr;
+            EntityWorldUpdateContext const*         m_pContext = nullptr;
+            TInlineVector<int32_t, 4>               m_predecessors;             // Nodes within the same group that need to complete before this one
+            int32_t                                 m_groupIdx = InvalidIndex;
+            bool                                    m_isBarrier = true;         // Undeclared access, updated serially on the calling thread
+
+            #if EE_DEVELOPMENT_TOOLS
+            Nanoseconds                             m_startTime = 0;
+            Nanoseconds                             m_endTime = 0;
+            #endif
+        };
+
+        struct StageSchedule
+        {
+            TVector<SystemNode*>                    m_nodes;                    // All nodes in priority order
+            TVector<enki::Dependency>               m_dependencies;
+            TVector<int32_t>                        m_groupStartIndices;        // The first node of each group (barriers are a group of one)
+            TVector<bool>                           m_isConcurrentGroup;        // Can any of the systems in the group run concurrently?
+
+            #if EE_DEVELOPMENT_TOOLS
+            TVector<int32_t>                        m_criticalPath;             // The chain of nodes that determined the stage duration last update
+            Milliseconds                            m_criticalPathTime = 0;
+            Milliseconds                            m_totalSystemTime = 0;      // Sum of all system update times, i.e. the serial cost
+            Milliseconds                            m_stageTime = 0;            // Actual wall time for the stage
+            #endif
+        };
+
+    public:
+
+        ~EntityWorldSystemScheduler() { EE_ASSERT( !m_isInitialized ); }
+
+        // Build the per-stage schedules from the priority sorted system update lists
+        void Initialize( TaskSystem* pTaskSystem, TVector<IEntityWorldSystem*> const* pSystemUpdateLists );
+        void Shutdown();
+
+        // Update all systems for the context's update stage
+        void UpdateSystems( EntityWorldUpdateContext const& context );
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline StageSchedule const& GetStageSchedule( UpdateStage stage ) const { return m_stageSchedules[(int8_t) stage]; }
+        #endif
+
+    private:
+
+        void BuildStageSchedule( UpdateStage stage, TVector<IEntityWorldSystem*> const& systemUpdateList, StageSchedule& schedule );
+
+        #if EE_DEVELOPMENT_TOOLS
+        void CalculateCriticalPath( StageSchedule& schedule );
+        #endif
+
+    private:
+
+        TaskSystem*                                 m_pTaskSystem = nullptr;
+        StageSchedule                               m_stageSchedules[(int8_t) UpdateStage::NumStages];
+        bool                                        m_isInitialized = false;
+    };
+}
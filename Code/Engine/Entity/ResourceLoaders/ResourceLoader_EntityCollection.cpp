@@ -37,6 +37,15 @@ namespace EE::EntityModel
             pCollectionDesc = pEC;
         }
 
+        // Precompile all component descriptors, so that instantiating the entities doesnt need to resolve any property paths
+        for ( auto& entityDesc : pCollectionDesc->m_entityDescriptors )
+        {
+            for ( auto& componentDesc : entityDesc.m_components )
+            {
+                componentDesc.CompilePrototype( *m_pTypeRegistry );
+            }
+        }
+
         // Set loaded resource
         pResourceRecord->SetResourceData( pCollectionDesc );
         return true;
@@ -65,6 +65,8 @@ namespace EE::Navmesh
         void UnregisterNavmesh( NavmeshComponent* pComponent );
 
         void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        // The navmesh simulation and debug drawing use the shared viewport, debug drawing system and navpower renderer, so we need to be updated exclusively
+        virtual bool GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const override { return false; }
 
         #if EE_DEVELOPMENT_TOOLS
         bool IsDebugRendererDepthTestEnabled() const;
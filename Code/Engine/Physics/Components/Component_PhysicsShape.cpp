@@ -47,6 +47,9 @@ namespace EE::Physics
         pPhysicsScene->lockWrite();
         m_pPhysicsActor->setGlobalPose( ToPx( physicsActorTransform ) );
         pPhysicsScene->unlockWrite();
+
+        // Dont interpolate across the teleport
+        m_previousSimulatedTransform = GetWorldTransform();
     }
 
     void PhysicsShapeComponent::MoveTo( Transform const& newWorldTransform )
@@ -78,6 +81,8 @@ namespace EE::Physics
             pPhysicsScene->lockWrite();
             m_pPhysicsActor->setGlobalPose( ToPx( physicsActorTransform ) );
             pPhysicsScene->unlockWrite();
+
+            m_previousSimulatedTransform = GetWorldTransform();
         }
     }
 
@@ -114,6 +114,7 @@ namespace EE::Physics
 
         physx::PxRigidActor*                            m_pPhysicsActor = nullptr;
         physx::PxShape*                                 m_pPhysicsShape = nullptr;
+        Transform                                       m_previousSimulatedTransform; // Dynamic only: the world transform before the last fixed step, used for interpolation
 
         #if EE_DEVELOPMENT_TOOLS
         String                                          m_debugName; // Keep a debug name here since the physx SDK doesnt store the name data
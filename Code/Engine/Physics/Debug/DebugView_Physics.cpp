@@ -122,11 +122,59 @@ namespace EE::Physics
 
     void PhysicsDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
+        auto pWorld = m_pPhysicsWorldSystem->GetWorld();
+
+        //-------------------------------------------------------------------------
+        // Simulation
+        //-------------------------------------------------------------------------
+
+        float stepRate = 1.0f / pWorld->GetFixedTimeStep().ToFloat();
+        if ( ImGui::SliderFloat( "Step Rate (Hz)", &stepRate, 10.0f, 240.0f, "%.0f" ) )
+        {
+            pWorld->SetFixedTimeStep( 1.0f / stepRate );
+        }
+
+        int32_t maxSubsteps = pWorld->GetMaxSubsteps();
+        if ( ImGui::SliderInt( "Max Substeps", &maxSubsteps, 1, PhysicsWorld::s_maxSubstepsLimit ) )
+        {
+            pWorld->SetMaxSubsteps( maxSubsteps );
+        }
+
+        bool isInterpolationEnabled = pWorld->IsInterpolationEnabled();
+        if ( ImGui::Checkbox( "Interpolate Transforms", &isInterpolationEnabled ) )
+        {
+            pWorld->SetInterpolationEnabled( isInterpolationEnabled );
+        }
+
+        bool isAsyncSimulationEnabled = pWorld->IsAsyncSimulationEnabled();
+        if ( ImGui::Checkbox( "Async Simulation", &isAsyncSimulationEnabled ) )
+        {
+            pWorld->SetAsyncSimulationEnabled( isAsyncSimulationEnabled );
+        }
+
+        auto const& stats = pWorld->GetSimulationStats();
+        ImGui::Text( "Steps: %d, Total: %.2fms, Interpolation: %.2f", stats.m_numSteps, stats.m_totalTime.ToFloat(), pWorld->GetInterpolationFactor() );
+        for ( int32_t i = 0; i < stats.m_numSteps; i++ )
+        {
+            ImGui::Text( "    Step %d: %.2fms", i, stats.m_stepTimes[i].ToFloat() );
+        }
+
+        if ( pWorld->IsAsyncSimulationEnabled() )
+        {
+            ImGui::Text( "Fetch Wait: %.2fms", stats.m_fetchWaitTime.ToFloat() );
+        }
+
+        if ( stats.m_droppedTime > 0.0f )
+        {
+            ImGui::TextColored( Colors::Red.ToFloat4(), "Dropped: %.2fms", stats.m_droppedTime.ToMilliseconds().ToFloat() );
+        }
+        ImGui::Text( "Frames With Dropped Time: %d", stats.m_numFramesWithDroppedTime );
+
         //-------------------------------------------------------------------------
         // Scene
         //-------------------------------------------------------------------------
 
-        auto pWorld = m_pPhysicsWorldSystem->GetWorld();
+        ImGui::Separator();
 
         uint32_t debugFlags = pWorld->GetDebugFlags();
         float drawDistance = pWorld->GetDebugDrawDistance();
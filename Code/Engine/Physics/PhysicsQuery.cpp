@@ -42,4 +42,77 @@ namespace EE::Physics
             break;
         }
     }
+
+    //-------------------------------------------------------------------------
+
+    QueryBatch::QueryBatch( int32_t maxQueries, int32_t maxHitsPerQuery )
+        : m_maxHitsPerQuery( maxHitsPerQuery )
+    {
+        EE_ASSERT( maxQueries > 0 && maxHitsPerQuery > 0 );
+        m_queries.reserve( maxQueries );
+        m_results.resize( maxQueries );
+        m_hits.resize( maxQueries * maxHitsPerQuery );
+    }
+
+    int32_t QueryBatch::AddQuery( QueryType type, ShapeType shape, Transform const& transform, Vector const& shapeSize, Vector const& direction, float distance, QueryRules const& rules )
+    {
+        EE_ASSERT( !IsFull() );
+        EE_ASSERT( type == QueryType::Overlap || ( direction.IsNormalized3() && distance > 0 ) );
+
+        int32_t const queryIdx = (int32_t) m_queries.size();
+        Query& query = m_queries.emplace_back();
+        query.m_transform = transform;
+        query.m_direction = direction;
+        query.m_shapeSize = shapeSize;
+        query.m_pRules = &rules;
+        query.m_distance = distance;
+        query.m_type = type;
+        query.m_shape = shape;
+        return queryIdx;
+    }
+
+    int32_t QueryBatch::AddRayCast( Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::RayCast, ShapeType::None, Transform( Quaternion::Identity, start ), Vector::Zero, unitDirection, distance, rules );
+    }
+
+    int32_t QueryBatch::AddSphereSweep( float radius, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::Sweep, ShapeType::Sphere, Transform( Quaternion::Identity, start ), Vector( radius ), unitDirection, distance, rules );
+    }
+
+    int32_t QueryBatch::AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::Sweep, ShapeType::Capsule, Transform( orientation, start ), Vector( radius, cylinderPortionHalfHeight, 0.0f ), unitDirection, distance, rules );
+    }
+
+    int32_t QueryBatch::AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::Sweep, ShapeType::Cylinder, Transform( orientation, start ), Vector( radius, cylinderPortionHalfHeight, 0.0f ), unitDirection, distance, rules );
+    }
+
+    int32_t QueryBatch::AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::Sweep, ShapeType::Box, Transform( orientation, start ), halfExtents, unitDirection, distance, rules );
+    }
+
+    int32_t QueryBatch::AddSphereOverlap( float radius, Vector const& position, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::Overlap, ShapeType::Sphere, Transform( Quaternion::Identity, position ), Vector( radius ), Vector::Zero, 0.0f, rules );
+    }
+
+    int32_t QueryBatch::AddCapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::Overlap, ShapeType::Capsule, Transform( orientation, position ), Vector( radius, cylinderPortionHalfHeight, 0.0f ), Vector::Zero, 0.0f, rules );
+    }
+
+    int32_t QueryBatch::AddCylinderOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::Overlap, ShapeType::Cylinder, Transform( orientation, position ), Vector( radius, cylinderPortionHalfHeight, 0.0f ), Vector::Zero, 0.0f, rules );
+    }
+
+    int32_t QueryBatch::AddBoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, QueryRules const& rules )
+    {
+        return AddQuery( QueryType::Overlap, ShapeType::Box, Transform( orientation, position ), halfExtents, Vector::Zero, 0.0f, rules );
+    }
 }
\ No newline at end of file
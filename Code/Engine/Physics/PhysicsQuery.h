@@ -2,7 +2,7 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Physics/PhysicsSettings.h"
 #include "Engine/Entity/EntityIDs.h"
-#include "System/Math/Vector.h"
+#include "System/Math/Transform.h"
 
 #include <PxQueryFiltering.h>
 
@@ -285,4 +285,133 @@ namespace EE::Physics
         Vector                                          m_overlapPosition = Vector::Zero;
         TInlineVector<Overlap, s_initialBufferSize>     m_overlaps;
     };
+
+    //-------------------------------------------------------------------------
+    // Query Batch
+    //-------------------------------------------------------------------------
+    // A set of ray casts, sweeps and overlaps that are executed together via 'PhysicsWorld::ExecuteQueryBatch'
+    //
+    // * All storage is allocated up front, adding queries and executing the batch never allocates
+    // * Each query gets a fixed number of hit slots, hits beyond that are dropped (the closest hits are kept for casts and sweeps)
+    // * Each query gathers at most 32 touches from PhysX, any further touches are dropped by PhysX in no particular order before the closest hits are picked
+    // * The rules are referenced not copied, so they need to outlive the batch execution
+    // * Batches are meant to be reset and refilled every frame
+
+    class EE_ENGINE_API QueryBatch
+    {
+        friend class PhysicsWorld;
+
+    public:
+
+        enum class QueryType : uint8_t
+        {
+            RayCast,
+            Sweep,
+            Overlap
+        };
+
+        enum class ShapeType : uint8_t
+        {
+            None, // Ray casts
+            Sphere,
+            Capsule,
+            Cylinder,
+            Box
+        };
+
+        struct Hit
+        {
+            physx::PxActor*     m_pActor = nullptr;
+            physx::PxShape*     m_pShape = nullptr;
+            Vector              m_shapePosition; // Sweeps only: the position of the shape at the hit
+            Vector              m_contactPoint; // Ray casts and sweeps only
+            Vector              m_normal; // Surface normal, or the depenetration normal for overlaps and initially overlapping sweeps
+            float               m_distance = 0.0f; // Distance to the hit, or the depenetration distance for overlaps and initially overlapping sweeps
+            bool                m_isInitiallyOverlapping = false;
+        };
+
+        struct Result
+        {
+            inline bool HasHits() const { return m_numHits > 0; }
+
+        public:
+
+            int32_t             m_numHits = 0;
+            float               m_actualDistance = 0.0f; // Ray casts and sweeps only: how far did we get before the first hit
+            bool                m_hasInitialOverlap = false; // Always set for overlaps with hits
+            bool                m_wasTruncated = false; // There were more hits than hit slots (PhysX might already have dropped touches, see the notes above)
+        };
+
+    private:
+
+        struct Query
+        {
+            Transform           m_transform; // The start transform for casts/sweeps, the shape transform for overlaps
+            Vector              m_direction = Vector::Zero;
+            Vector              m_shapeSize = Vector::Zero; // Sphere: radius, Capsule/Cylinder: radius and half height, Box: half extents
+            QueryRules const*   m_pRules = nullptr;
+            float               m_distance = 0.0f;
+            QueryType           m_type = QueryType::RayCast;
+            ShapeType           m_shape = ShapeType::None;
+        };
+
+    public:
+
+        QueryBatch( int32_t maxQueries, int32_t maxHitsPerQuery = 4 );
+
+        // Remove all queries, storage is kept
+        inline void Reset() { m_queries.clear(); }
+
+        inline int32_t GetNumQueries() const { return (int32_t) m_queries.size(); }
+        inline int32_t GetMaxQueries() const { return (int32_t) m_results.size(); }
+        inline bool IsFull() const { return m_queries.size() == m_results.size(); }
+
+        // Add Queries - all return the query index
+        //-------------------------------------------------------------------------
+
+        int32_t AddRayCast( Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+
+        inline int32_t AddRayCast( Vector const& start, Vector const& end, QueryRules const& rules )
+        {
+            Vector direction;
+            float distance;
+            ( end - start ).ToDirectionAndLength3( direction, distance );
+            return AddRayCast( start, direction, distance, rules );
+        }
+
+        int32_t AddSphereSweep( float radius, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+        int32_t AddCapsuleSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+        int32_t AddCylinderSweep( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+        int32_t AddBoxSweep( Vector halfExtents, Quaternion const& orientation, Vector const& start, Vector const& unitDirection, float distance, QueryRules const& rules );
+
+        int32_t AddSphereOverlap( float radius, Vector const& position, QueryRules const& rules );
+        int32_t AddCapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules );
+        int32_t AddCylinderOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules );
+        int32_t AddBoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, QueryRules const& rules );
+
+        // Results - only valid after the batch has been executed
+        //-------------------------------------------------------------------------
+
+        inline Result const& GetResult( int32_t queryIdx ) const { EE_ASSERT( queryIdx >= 0 && queryIdx < m_queries.size() ); return m_results[queryIdx]; }
+
+        // Get the hits for a query, ray cast and sweep hits are sorted by distance
+        inline Hit const* GetHits( int32_t queryIdx ) const { EE_ASSERT( queryIdx >= 0 && queryIdx < m_queries.size() ); return &m_hits[queryIdx * m_maxHitsPerQuery]; }
+
+        inline Hit const& GetHit( int32_t queryIdx, int32_t hitIdx ) const
+        {
+            EE_ASSERT( hitIdx >= 0 && hitIdx < GetResult( queryIdx ).m_numHits );
+            return m_hits[queryIdx * m_maxHitsPerQuery + hitIdx];
+        }
+
+    private:
+
+        int32_t AddQuery( QueryType type, ShapeType shape, Transform const& transform, Vector const& shapeSize, Vector const& direction, float distance, QueryRules const& rules );
+
+    private:
+
+        TVector<Query>          m_queries;
+        TVector<Result>         m_results;
+        TVector<Hit>            m_hits; // 'm_maxHitsPerQuery' slots per query
+        int32_t                 m_maxHitsPerQuery = 0;
+    };
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "PhysicsRagdoll.h"
 #include "Physics.h"
+#include "PhysicsWorld.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Math/MathHelpers.h"
@@ -1180,11 +1181,13 @@ namespace EE::Physics
         EE_ASSERT( pPose->HasGlobalTransforms() );
 
         // Copy the global bone transforms here
+        // Only the active bones have valid global transforms, the inactive bones are left in the reference pose
         //-------------------------------------------------------------------------
 
-        int32_t const numBones = pPose->GetNumBones();
-        m_globalBoneTransforms.resize( numBones );
-        m_globalBoneTransforms = pPose->GetGlobalTransforms();
+        int32_t const numActiveBones = pPose->GetNumActiveBones();
+        auto const& poseGlobalTransforms = pPose->GetGlobalTransforms();
+        m_globalBoneTransforms.resize( pPose->GetNumBones() );
+        eastl::copy( poseGlobalTransforms.begin(), poseGlobalTransforms.begin() + numActiveBones, m_globalBoneTransforms.begin() );
 
         //-------------------------------------------------------------------------
 
@@ -1203,8 +1206,14 @@ namespace EE::Physics
                     break;
                 }
 
-                // Convert from world space to character space
+                // Bodies attached to bones that are inactive for the current LOD are ignored
                 int32_t const boneIdx = m_pDefinition->m_bodyToBoneMap[bodyIdx];
+                if ( !pPose->IsBoneActive( boneIdx ) )
+                {
+                    continue;
+                }
+
+                // Convert from world space to character space
                 Transform const bodyWorldTransform = FromPx( ragdollBodyTransform );
                 Transform const boneWorldTranform = m_pDefinition->m_bodies[bodyIdx].m_inverseOffsetTransform * bodyWorldTransform;
                 m_globalBoneTransforms[boneIdx] = Transform::Delta( worldTransform, boneWorldTranform );
@@ -1219,7 +1228,7 @@ namespace EE::Physics
         // Calculate the local transforms and set back into the pose
         //-------------------------------------------------------------------------
 
-        for ( int32_t i = 0; i < numBones; i++ )
+        for ( int32_t i = 0; i < numActiveBones; i++ )
         {
             // Keep original local transforms for non-body bones
             if ( m_pDefinition->m_boneToBodyMap[i] == InvalidIndex )
@@ -1260,8 +1269,14 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    // Ragdolls consume the simulation results and most articulation calls are not allowed mid-step, so always wait for any in-flight step
     void Ragdoll::LockWriteScene()
     {
+        if ( m_pWorld != nullptr )
+        {
+            m_pWorld->WaitForSimulationResults();
+        }
+
         if ( auto pScene = m_pArticulation->getScene() )
         {
             pScene->lockWrite();
@@ -1278,6 +1293,11 @@ namespace EE::Physics
 
     void Ragdoll::LockReadScene() const
     {
+        if ( m_pWorld != nullptr )
+        {
+            m_pWorld->WaitForSimulationResults();
+        }
+
         if ( auto pScene = m_pArticulation->getScene() )
         {
             pScene->lockRead();
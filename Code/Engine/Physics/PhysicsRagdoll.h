@@ -30,6 +30,8 @@ namespace EE::Animation
 
 namespace EE::Physics
 {
+    class PhysicsWorld;
+
     //-------------------------------------------------------------------------
     // Ragdoll Settings
     //-------------------------------------------------------------------------
@@ -435,6 +437,7 @@ namespace EE::Physics
     private:
 
         physx::PxPhysics*                                       m_pPhysics = nullptr;
+        PhysicsWorld*                                           m_pWorld = nullptr;
         RagdollDefinition const*                                m_pDefinition = nullptr;
         RagdollDefinition::Profile const*                       m_pProfile = nullptr;
         physx::PxArticulationReducedCoordinate*                 m_pArticulation = nullptr;
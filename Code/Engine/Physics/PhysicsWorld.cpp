@@ -10,7 +10,10 @@
 #include "Components/Component_PhysicsCharacter.h"
 #include "Engine/Entity/EntityLog.h"
 #include "System/Profiling.h"
+#include "System/Time/Timers.h"
+#include "System/Threading/TaskSystem.h"
 #include "EASTL/sort.h"
+#include <thread>
 
 //-------------------------------------------------------------------------
 
@@ -22,10 +25,51 @@ using namespace physx;
 
 namespace EE::Physics::PX
 {
+    // Each scene has its own dispatcher so that it can defer its tasks while other scenes run theirs inline
     class TaskDispatcher final : public PxCpuDispatcher
     {
+    public:
+
+        // When deferring, submitted tasks are only queued and 'simulate' returns immediately, the queue is then drained by the simulation task
+        inline void SetDeferTasks( bool deferTasks ) { m_deferTasks = deferTasks; }
+
+        // Run all deferred tasks, including any continuations they submit, until the queue is empty
+        // The executing list is local so that no dispatcher state is touched outside the lock
+        void RunDeferredTasks()
+        {
+            TVector<PxBaseTask*> executingTasks;
+            while ( true )
+            {
+                {
+                    Threading::ScopeLock const lock( m_mutex );
+                    if ( m_deferredTasks.empty() )
+                    {
+                        break;
+                    }
+
+                    executingTasks.swap( m_deferredTasks );
+                }
+
+                for ( auto pTask : executingTasks )
+                {
+                    pTask->run();
+                    pTask->release();
+                }
+                executingTasks.clear();
+            }
+        }
+
+    private:
+
         virtual void submitTask( PxBaseTask & task ) override
         {
+            if ( m_deferTasks )
+            {
+                Threading::ScopeLock const lock( m_mutex );
+                m_deferredTasks.emplace_back( &task );
+                return;
+            }
+
             // Surprisingly it is faster to run all physics tasks on a single thread since there is a fair amount of gaps when spreading the tasks across multiple cores.
             // TODO: re-evaluate this when we have additional work. Perhaps we can interleave other tasks while physics tasks are waiting
             auto pTask = &task;
@@ -37,9 +81,69 @@ namespace EE::Physics::PX
         {
             return 1;
         }
+
+    private:
+
+        Threading::Mutex                    m_mutex;
+        TVector<PxBaseTask*>                m_deferredTasks;
+        bool                                m_deferTasks = false;
+    };
+
+    // Runs a deferred simulation step on a single worker, in keeping with the dispatcher's single thread execution
+    struct SimulationTask final : public ITaskSet
+    {
+        SimulationTask( TaskDispatcher* pDispatcher )
+            : m_pDispatcher( pDispatcher )
+        {
+            m_SetSize = 1;
+        }
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            EE_PROFILE_SCOPE_PHYSICS( "Async Simulate" );
+
+            #if EE_DEVELOPMENT_TOOLS
+            Timer<PlatformClock> timer;
+            #endif
+
+            m_pDispatcher->RunDeferredTasks();
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_executionTime = timer.GetElapsedTimeMilliseconds();
+            #endif
+        }
+
+    public:
+
+        TaskDispatcher*                     m_pDispatcher = nullptr;
+
+        #if EE_DEVELOPMENT_TOOLS
+        Milliseconds                        m_executionTime = 0;
+        #endif
     };
 
-    TaskDispatcher g_taskDispatcher;
+    // Executes a range of queries from a query batch, each range is executed under a single read lock
+    struct QueryBatchTask final : public ITaskSet
+    {
+        QueryBatchTask( PhysicsWorld* pWorld, QueryBatch* pBatch )
+            : m_pWorld( pWorld )
+            , m_pBatch( pBatch )
+        {
+            m_SetSize = pBatch->GetNumQueries();
+            m_MinRange = PhysicsWorld::s_minQueriesPerBatchTask;
+        }
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            EE_PROFILE_SCOPE_PHYSICS( "Query Batch Task" );
+            m_pWorld->ExecuteQueryBatchRange( *m_pBatch, range.start, range.end );
+        }
+
+    public:
+
+        PhysicsWorld*                       m_pWorld = nullptr;
+        QueryBatch*                         m_pBatch = nullptr;
+    };
 
     //-------------------------------------------------------------------------
 
@@ -181,6 +285,124 @@ namespace EE::Physics::PX
 
         QueryRules const& m_rules;
     };
+
+    //-------------------------------------------------------------------------
+    // Query Helpers - shared by the individual and the batched queries
+    //-------------------------------------------------------------------------
+
+    // Create the PhysX geometry for a query shape and return the shape orientation in PhysX space (capsules are aligned along a different axis)
+    static Quaternion CreateQueryGeometry( QueryBatch::ShapeType shape, Vector const& shapeSize, Quaternion const& orientation, PxGeometryHolder& outGeometry )
+    {
+        switch ( shape )
+        {
+            case QueryBatch::ShapeType::Sphere:
+            {
+                outGeometry.storeAny( PxSphereGeometry( shapeSize.GetX() ) );
+            }
+            break;
+
+            case QueryBatch::ShapeType::Capsule:
+            {
+                outGeometry.storeAny( PxCapsuleGeometry( shapeSize.GetX(), shapeSize.GetY() ) );
+                return Conversion::s_capsuleConversionToPx * orientation;
+            }
+            break;
+
+            case QueryBatch::ShapeType::Cylinder:
+            {
+                outGeometry.storeAny( PxConvexMeshGeometry( Shapes::s_pUnitCylinderMesh, PxMeshScale( PxVec3( 2.0f * shapeSize.GetX(), 2.0f * shapeSize.GetX(), 2.0f * shapeSize.GetY() ) ) ) );
+            }
+            break;
+
+            case QueryBatch::ShapeType::Box:
+            {
+                outGeometry.storeAny( PxBoxGeometry( ToPx( shapeSize ) ) );
+            }
+            break;
+
+            default:
+            EE_UNREACHABLE_CODE();
+            break;
+        }
+
+        return orientation;
+    }
+
+    // Calculate the minimum translation needed to separate the query shape from a shape it is overlapping
+    static PxSweepHit CalculateDepenetration( PxGeometry const& geo, PxTransform const& pose, PxVec3 const& unitDir, PxHitFlags hitFlags, PxRigidActor const* pHitActor, PxShape const* pHitShape )
+    {
+        PxSweepHit hitInfo;
+        PxU32 hitCount = PxGeometryQuery::sweep( unitDir, 0.0f, geo, pose, pHitShape->getGeometry(), pHitActor->getGlobalPose(), hitInfo, hitFlags | PxHitFlag::eMTD, 0.0f );
+        EE_ASSERT( hitCount == 1 );
+        return hitInfo;
+    }
+
+    template<typename HitType>
+    static void ConvertRayCastHit( PxRaycastHit const& pxHit, HitType& outHit )
+    {
+        outHit.m_pActor = pxHit.actor;
+        outHit.m_pShape = pxHit.shape;
+        outHit.m_contactPoint = FromPx( pxHit.position );
+        outHit.m_normal = FromPx( pxHit.normal );
+        outHit.m_distance = pxHit.distance;
+    }
+
+    // Initially overlapping hits report the depenetration normal and (negative) distance if requested
+    template<typename HitType>
+    static void ConvertSweepHit( PxSweepHit const& pxHit, PxGeometry const& geo, PxTransform const& startPose, Vector const& direction, bool calculateDepenetration, HitType& outHit )
+    {
+        Vector const startPosition = FromPx( startPose.p );
+
+        outHit.m_pActor = pxHit.actor;
+        outHit.m_pShape = pxHit.shape;
+
+        if ( pxHit.hadInitialOverlap() )
+        {
+            outHit.m_shapePosition = startPosition;
+            outHit.m_isInitiallyOverlapping = true;
+
+            if ( calculateDepenetration )
+            {
+                PxSweepHit const hitInfo = CalculateDepenetration( geo, startPose, ToPx( direction ), PxHitFlag::ePOSITION | PxHitFlag::eNORMAL, pxHit.actor, pxHit.shape );
+                outHit.m_contactPoint = FromPx( hitInfo.position );
+                outHit.m_normal = FromPx( hitInfo.normal );
+                outHit.m_distance = -hitInfo.distance;
+            }
+            else // Clear all the values
+            {
+                outHit.m_contactPoint = startPosition;
+                outHit.m_normal = Vector::Zero;
+                outHit.m_distance = 0;
+            }
+        }
+        else // Regular hit
+        {
+            outHit.m_shapePosition = startPosition + ( direction * pxHit.distance );
+            outHit.m_contactPoint = FromPx( pxHit.position );
+            outHit.m_normal = FromPx( pxHit.normal );
+            outHit.m_distance = pxHit.distance;
+            outHit.m_isInitiallyOverlapping = false;
+        }
+    }
+
+    template<typename HitType>
+    static void ConvertOverlapHit( PxOverlapHit const& pxHit, PxGeometry const& geo, PxTransform const& pose, bool calculateDepenetration, HitType& outHit )
+    {
+        outHit.m_pActor = pxHit.actor;
+        outHit.m_pShape = pxHit.shape;
+
+        if ( calculateDepenetration )
+        {
+            PxSweepHit const hitInfo = CalculateDepenetration( geo, pose, PxVec3( 0, 0, 1 ), PxHitFlag::eNORMAL, pxHit.actor, pxHit.shape );
+            outHit.m_normal = FromPx( hitInfo.normal );
+            outHit.m_distance = -hitInfo.distance;
+        }
+        else
+        {
+            outHit.m_normal = Vector::Zero;
+            outHit.m_distance = 0.0f;
+        }
+    }
 }
 
 //-------------------------------------------------------------------------
@@ -189,19 +411,23 @@ namespace EE::Physics::PX
 
 namespace EE::Physics
 {
-    PhysicsWorld::PhysicsWorld( MaterialRegistry const* pRegistry, bool isGameWorld )
+    PhysicsWorld::PhysicsWorld( MaterialRegistry const* pRegistry, TaskSystem* pTaskSystem, bool isGameWorld )
         : m_pMaterialRegistry( pRegistry )
+        , m_pTaskSystem( pTaskSystem )
         , m_isGameWorld( isGameWorld )
     {
         EE_ASSERT( m_pMaterialRegistry != nullptr );
 
+        m_pTaskDispatcher = EE::New<PX::TaskDispatcher>();
+        m_pSimulationTask = EE::New<PX::SimulationTask>( m_pTaskDispatcher );
+
         PxTolerancesScale tolerancesScale;
         tolerancesScale.length = Constants::s_lengthScale;
         tolerancesScale.speed = Constants::s_speedScale;
 
         PxSceneDesc sceneDesc( tolerancesScale );
         sceneDesc.gravity = ToPx( Constants::s_gravity );
-        sceneDesc.cpuDispatcher = &PX::g_taskDispatcher;
+        sceneDesc.cpuDispatcher = m_pTaskDispatcher;
         sceneDesc.filterShader = PX::SimulationFilter::Shader;
         sceneDesc.filterCallback = &PX::g_simulationFilter;
         sceneDesc.flags = PxSceneFlag::eENABLE_CCD | PxSceneFlag::eREQUIRE_RW_LOCK;
@@ -214,27 +440,179 @@ namespace EE::Physics
 
     PhysicsWorld::~PhysicsWorld()
     {
+        WaitForSimulationResults();
+
         m_pControllerManager->purgeControllers();
         m_pControllerManager->release();
         m_pControllerManager = nullptr;
 
         m_pScene->release();
         m_pScene = nullptr;
+
+        EE::Delete( m_pSimulationTask );
+        EE::Delete( m_pTaskDispatcher );
     }
 
     //-------------------------------------------------------------------------
     // Update
     //-------------------------------------------------------------------------
 
-    void PhysicsWorld::Simulate( Seconds deltaTime )
+    void PhysicsWorld::SetFixedTimeStep( Seconds timeStep )
+    {
+        EE_ASSERT( timeStep > 0.0f );
+        m_fixedTimeStep = timeStep;
+
+        // Keep the interpolation factor in range
+        m_timeAccumulator = Math::Min( m_timeAccumulator.ToFloat(), m_fixedTimeStep.ToFloat() );
+    }
+
+    int32_t PhysicsWorld::AccumulateTime( Seconds deltaTime )
+    {
+        EE_ASSERT( deltaTime >= 0.0f );
+
+        m_timeAccumulator += deltaTime;
+        int32_t numSteps = (int32_t) Math::Floor( m_timeAccumulator.ToFloat() / m_fixedTimeStep.ToFloat() );
+
+        // Spiral-of-death guard: drop the whole steps we cant afford, but keep the fractional remainder so the interpolation stays continuous
+        Seconds droppedTime = 0.0f;
+        if ( numSteps > m_maxSubsteps )
+        {
+            droppedTime = m_fixedTimeStep * float( numSteps - m_maxSubsteps );
+            m_timeAccumulator -= droppedTime;
+            numSteps = m_maxSubsteps;
+        }
+
+        m_timeAccumulator -= m_fixedTimeStep * float( numSteps );
+        m_timeAccumulator = Math::Max( m_timeAccumulator.ToFloat(), 0.0f );
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_hasUnreportedAsyncStep = false;
+        m_simulationStats.m_numSteps = numSteps;
+        m_simulationStats.m_totalTime = 0;
+        m_simulationStats.m_droppedTime = droppedTime;
+        if ( droppedTime > 0.0f )
+        {
+            m_simulationStats.m_numFramesWithDroppedTime++;
+        }
+        #endif
+
+        return numSteps;
+    }
+
+    void PhysicsWorld::SetAsyncSimulationEnabled( bool isEnabled )
+    {
+        WaitForSimulationResults();
+        m_isAsyncSimulationEnabled = isEnabled && m_pTaskSystem != nullptr;
+    }
+
+    void PhysicsWorld::WaitForSimulationResults()
+    {
+        if ( m_simulationState.load( std::memory_order_acquire ) == SimulationState::Idle )
+        {
+            return;
+        }
+
+        EE_PROFILE_FUNCTION_PHYSICS();
+
+        #if EE_DEVELOPMENT_TOOLS
+        Timer<PlatformClock> waitTimer;
+        #endif
+
+        // No locks can be held while waiting, since the task system will run other tasks on this thread (which might call this function again)
+        m_pTaskSystem->WaitForTask( m_pSimulationTask );
+
+        // Multiple consumers can race to be first, only one of them fetches and all others wait for the fetch to complete
+        SimulationState expectedState = SimulationState::InFlight;
+        if ( !m_simulationState.compare_exchange_strong( expectedState, SimulationState::Fetching, std::memory_order_acq_rel ) )
+        {
+            while ( m_simulationState.load( std::memory_order_acquire ) == SimulationState::Fetching )
+            {
+                std::this_thread::yield();
+            }
+
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        AcquireWriteLock();
+        {
+            // Anything submitted from here on should run inline again
+            m_pTaskDispatcher->SetDeferTasks( false );
+            m_pTaskDispatcher->RunDeferredTasks();
+
+            EE_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
+            m_pScene->fetchResults( true );
+        }
+        ReleaseWriteLock();
+
+        //-------------------------------------------------------------------------
+
+        // The fetch can happen on any thread, so only record the timings here. They are added to the stats by the owning world system.
+        #if EE_DEVELOPMENT_TOOLS
+        m_asyncFetchWaitTime = waitTimer.GetElapsedTimeMilliseconds();
+        m_hasUnreportedAsyncStep = true;
+        #endif
+
+        m_simulationState.store( SimulationState::Idle, std::memory_order_release );
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void PhysicsWorld::UpdateAsyncStepStats()
+    {
+        EE_ASSERT( !IsSimulationInFlight() );
+
+        if ( !m_hasUnreportedAsyncStep )
+        {
+            return;
+        }
+
+        int32_t const stepIdx = m_simulationStats.m_numSteps - 1;
+        m_simulationStats.m_stepTimes[stepIdx] += m_pSimulationTask->m_executionTime;
+        m_simulationStats.m_totalTime += m_pSimulationTask->m_executionTime;
+        m_simulationStats.m_fetchWaitTime = m_asyncFetchWaitTime;
+        m_hasUnreportedAsyncStep = false;
+    }
+    #endif
+
+    void PhysicsWorld::SimulateStep( int32_t stepIdx, bool runAsync )
     {
         EE_PROFILE_FUNCTION_PHYSICS();
+        EE_ASSERT( stepIdx >= 0 && stepIdx < s_maxSubstepsLimit );
+        EE_ASSERT( !runAsync || m_isAsyncSimulationEnabled );
+
+        // We can only have a single step in flight
+        WaitForSimulationResults();
+
+        #if EE_DEVELOPMENT_TOOLS
+        Timer<PlatformClock> stepTimer;
+        #endif
 
         AcquireWriteLock();
         {
-            // TODO: run at fixed time step
             EE_PROFILE_SCOPE_PHYSICS( "Simulate" );
-            m_pScene->simulate( deltaTime );
+            m_pTaskDispatcher->SetDeferTasks( runAsync );
+            m_pScene->simulate( m_fixedTimeStep );
+        }
+
+        // Kick off the deferred tasks and return, the scene stays readable while the step runs
+        if ( runAsync )
+        {
+            ReleaseWriteLock();
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_simulationStats.m_stepTimes[stepIdx] = stepTimer.GetElapsedTimeMilliseconds();
+            m_simulationStats.m_totalTime += m_simulationStats.m_stepTimes[stepIdx];
+            m_simulationStats.m_fetchWaitTime = 0;
+            #endif
+
+            // The task needs to be scheduled before any consumer can see the step as in flight, otherwise the wait would return immediately
+            // and the consumer would drain the deferred tasks concurrently with the simulation task
+            m_pTaskSystem->ScheduleTask( m_pSimulationTask );
+            m_simulationState.store( SimulationState::InFlight, std::memory_order_release );
+            return;
         }
 
         //-------------------------------------------------------------------------
@@ -244,6 +622,13 @@ namespace EE::Physics
             m_pScene->fetchResults( true );
         }
         ReleaseWriteLock();
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_simulationStats.m_stepTimes[stepIdx] = stepTimer.GetElapsedTimeMilliseconds();
+        m_simulationStats.m_totalTime += m_simulationStats.m_stepTimes[stepIdx];
+        #endif
     }
 
     //-------------------------------------------------------------------------
@@ -289,12 +674,7 @@ namespace EE::Physics
 
         auto ConvertHit = [&] ( PxRaycastHit const& pxHit )
         {
-            auto& hit = outResults.m_hits.emplace_back();
-            hit.m_pActor = pxHit.actor;
-            hit.m_pShape = pxHit.shape;
-            hit.m_contactPoint = FromPx( pxHit.position );
-            hit.m_distance = pxHit.distance;
-            hit.m_normal = FromPx( pxHit.normal );
+            PX::ConvertRayCastHit( pxHit, outResults.m_hits.emplace_back() );
         };
 
         // Fill Results
@@ -344,48 +724,13 @@ namespace EE::Physics
         PxSweepBufferN<50> buffer;
         buffer.maxNbTouches = rules.m_allowMultipleHits ? 50 : 0;
         PxTransform const pxStartTransform( ToPx( startTransform ) );
-        PxVec3 const pxSweepDir = ToPx( direction );
-        bool const result = m_pScene->sweep( geo, pxStartTransform, pxSweepDir, distance, buffer, rules.m_hitFlags, rules.m_queryFilterData, &filterCallback );
+        bool const result = m_pScene->sweep( geo, pxStartTransform, ToPx( direction ), distance, buffer, rules.m_hitFlags, rules.m_queryFilterData, &filterCallback );
 
         //-------------------------------------------------------------------------
 
         auto ConvertHit = [&] ( PxSweepHit const& pxHit )
         {
-            auto& hit = outResults.m_hits.emplace_back();
-            hit.m_pActor = pxHit.actor;
-            hit.m_pShape = pxHit.shape;
-
-            if ( pxHit.hadInitialOverlap() )
-            {
-                hit.m_shapePosition = outResults.m_sweepStartPosition;
-                hit.m_isInitiallyOverlapping = true;
-
-                // If we need to solve the depenetration, run a geometry query
-                if ( rules.m_calculateDepenetration )
-                {
-                    PxSweepHit hitInfo;
-                    PxHitFlags const hitFlags = PxHitFlag::ePOSITION | PxHitFlag::eNORMAL | PxHitFlag::eMTD;
-                    PxU32 hitCount = PxGeometryQuery::sweep( pxSweepDir, 0.0f, geo, pxStartTransform, pxHit.shape->getGeometry(), pxHit.actor->getGlobalPose(), hitInfo, hitFlags, 0.0f );
-                    EE_ASSERT( hitCount == 1 );
-                    hit.m_contactPoint = FromPx( hitInfo.position );
-                    hit.m_normal = FromPx( hitInfo.normal );
-                    hit.m_distance = -hitInfo.distance;
-                }
-                else // Clear all the values
-                {
-                    hit.m_contactPoint = hit.m_shapePosition;
-                    hit.m_normal = Vector::Zero;
-                    hit.m_distance = 0;
-                }
-            }
-            else // Regular hit
-            {
-                hit.m_shapePosition = outResults.m_sweepStartPosition + ( direction * pxHit.distance );
-                hit.m_contactPoint = FromPx( pxHit.position );
-                hit.m_normal = FromPx( pxHit.normal );
-                hit.m_distance = pxHit.distance;
-                hit.m_isInitiallyOverlapping = false;
-            }
+            PX::ConvertSweepHit( pxHit, geo, pxStartTransform, direction, rules.m_calculateDepenetration, outResults.m_hits.emplace_back() );
         };
 
         // Fill Results
@@ -442,26 +787,30 @@ namespace EE::Physics
 
     bool PhysicsWorld::SphereSweepInternal( float radius, Vector const& position, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults )
     {
-        PxSphereGeometry const sphereGeo( radius );
-        return SweepInternal( sphereGeo, Transform( Quaternion::Identity, position ), direction, distance, rules, outResults );
+        PxGeometryHolder geo;
+        Quaternion const orientation = PX::CreateQueryGeometry( QueryBatch::ShapeType::Sphere, Vector( radius ), Quaternion::Identity, geo );
+        return SweepInternal( geo.any(), Transform( orientation, position ), direction, distance, rules, outResults );
     }
 
     bool PhysicsWorld::CapsuleSweepInternal( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults )
     {
-        PxCapsuleGeometry const capsuleGeo( radius, cylinderPortionHalfHeight );
-        return SweepInternal( capsuleGeo, Transform( PX::Conversion::s_capsuleConversionToPx * orientation, position ), direction, distance, rules, outResults );
+        PxGeometryHolder geo;
+        Quaternion const pxOrientation = PX::CreateQueryGeometry( QueryBatch::ShapeType::Capsule, Vector( radius, cylinderPortionHalfHeight, 0.0f ), orientation, geo );
+        return SweepInternal( geo.any(), Transform( pxOrientation, position ), direction, distance, rules, outResults );
     }
 
     bool PhysicsWorld::CylinderSweepInternal( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults )
     {
-        PxConvexMeshGeometry const cylinderGeo( PX::Shapes::s_pUnitCylinderMesh, PxMeshScale( PxVec3( 2.0f * radius, 2.0f * radius, 2.0f * cylinderPortionHalfHeight ) ) );
-        return SweepInternal( cylinderGeo, Transform( orientation, position ), direction, distance, rules, outResults );
+        PxGeometryHolder geo;
+        Quaternion const pxOrientation = PX::CreateQueryGeometry( QueryBatch::ShapeType::Cylinder, Vector( radius, cylinderPortionHalfHeight, 0.0f ), orientation, geo );
+        return SweepInternal( geo.any(), Transform( pxOrientation, position ), direction, distance, rules, outResults );
     }
 
     bool PhysicsWorld::BoxSweepInternal( Vector halfExtents, Quaternion const& orientation, Vector const& position, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults )
     {
-        PxBoxGeometry const boxGeo( ToPx( halfExtents ) );
-        return SweepInternal( boxGeo, Transform( orientation, position ), direction, distance, rules, outResults );
+        PxGeometryHolder geo;
+        Quaternion const pxOrientation = PX::CreateQueryGeometry( QueryBatch::ShapeType::Box, halfExtents, orientation, geo );
+        return SweepInternal( geo.any(), Transform( pxOrientation, position ), direction, distance, rules, outResults );
     }
 
     //-------------------------------------------------------------------------
@@ -477,26 +826,9 @@ namespace EE::Physics
 
         //-------------------------------------------------------------------------
 
-        auto ConvertOverlap = [&] ( PxOverlapHit const& hit )
+        auto ConvertOverlap = [&] ( PxOverlapHit const& pxHit )
         {
-            auto& overlap = outResults.m_overlaps.emplace_back();
-            overlap.m_pActor = hit.actor;
-            overlap.m_pShape = hit.shape;
-
-            if ( rules.m_calculateDepenetration )
-            {
-                PxSweepHit hitInfo;
-                PxHitFlags const hitFlags = PxHitFlag::eNORMAL | PxHitFlag::eMTD;
-                PxU32 hitCount = PxGeometryQuery::sweep( PxVec3( 0, 0, 1 ), 0.0f, geo, pxTransform, hit.shape->getGeometry(), hit.actor->getGlobalPose(), hitInfo, hitFlags, 0.0f );
-                EE_ASSERT( hitCount == 1 );
-                overlap.m_normal = FromPx( hitInfo.normal );
-                overlap.m_distance = -hitInfo.distance;
-            }
-            else
-            {
-                overlap.m_normal = Vector::Zero;
-                overlap.m_distance = 0.0f;
-            }
+            PX::ConvertOverlapHit( pxHit, geo, pxTransform, rules.m_calculateDepenetration, outResults.m_overlaps.emplace_back() );
         };
 
         // Fill Results
@@ -526,26 +858,197 @@ namespace EE::Physics
 
     bool PhysicsWorld::SphereOverlap( float radius, Vector const& position, QueryRules const& rules, OverlapResults& outResults )
     {
-        PxSphereGeometry const sphereGeo( radius );
-        return OverlapInternal( sphereGeo, Transform( Quaternion::Identity, position ), rules, outResults );
+        PxGeometryHolder geo;
+        Quaternion const orientation = PX::CreateQueryGeometry( QueryBatch::ShapeType::Sphere, Vector( radius ), Quaternion::Identity, geo );
+        return OverlapInternal( geo.any(), Transform( orientation, position ), rules, outResults );
     }
 
     bool PhysicsWorld::CapsuleOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules, OverlapResults& outResults )
     {
-        PxCapsuleGeometry const capsuleGeo( radius, cylinderPortionHalfHeight );
-        return OverlapInternal( capsuleGeo, Transform( PX::Conversion::s_capsuleConversionToPx * orientation, position ), rules, outResults);
+        PxGeometryHolder geo;
+        Quaternion const pxOrientation = PX::CreateQueryGeometry( QueryBatch::ShapeType::Capsule, Vector( radius, cylinderPortionHalfHeight, 0.0f ), orientation, geo );
+        return OverlapInternal( geo.any(), Transform( pxOrientation, position ), rules, outResults );
     }
 
     bool PhysicsWorld::CylinderOverlap( float radius, float cylinderPortionHalfHeight, Quaternion const& orientation, Vector const& position, QueryRules const& rules, OverlapResults& outResults )
     {
-        PxConvexMeshGeometry const cylinderGeo( PX::Shapes::s_pUnitCylinderMesh, PxMeshScale( PxVec3( 2.0f * radius, 2.0f * radius, 2.0f * cylinderPortionHalfHeight ) ) );
-        return OverlapInternal( cylinderGeo, Transform( orientation, position ), rules, outResults );
+        PxGeometryHolder geo;
+        Quaternion const pxOrientation = PX::CreateQueryGeometry( QueryBatch::ShapeType::Cylinder, Vector( radius, cylinderPortionHalfHeight, 0.0f ), orientation, geo );
+        return OverlapInternal( geo.any(), Transform( pxOrientation, position ), rules, outResults );
     }
 
     bool PhysicsWorld::BoxOverlap( Vector halfExtents, Quaternion const& orientation, Vector const& position, QueryRules const& rules, OverlapResults& outResults )
     {
-        PxBoxGeometry const boxGeo( ToPx( halfExtents ) );
-        return OverlapInternal( boxGeo, Transform( orientation, position ), rules, outResults );
+        PxGeometryHolder geo;
+        Quaternion const pxOrientation = PX::CreateQueryGeometry( QueryBatch::ShapeType::Box, halfExtents, orientation, geo );
+        return OverlapInternal( geo.any(), Transform( pxOrientation, position ), rules, outResults );
+    }
+
+    //-------------------------------------------------------------------------
+    // Batched Queries
+    //-------------------------------------------------------------------------
+
+    void PhysicsWorld::ExecuteQueryBatch( QueryBatch& batch )
+    {
+        EE_PROFILE_FUNCTION_PHYSICS();
+
+        int32_t const numQueries = batch.GetNumQueries();
+        if ( numQueries == 0 )
+        {
+            return;
+        }
+
+        if ( m_pTaskSystem == nullptr || numQueries <= s_minQueriesPerBatchTask )
+        {
+            ExecuteQueryBatchRange( batch, 0, numQueries );
+        }
+        else
+        {
+            PX::QueryBatchTask queryTask( this, &batch );
+            m_pTaskSystem->ScheduleTask( &queryTask );
+            m_pTaskSystem->WaitForTask( &queryTask );
+        }
+    }
+
+    void PhysicsWorld::ExecuteQueryBatchRange( QueryBatch& batch, int32_t startIdx, int32_t endIdx )
+    {
+        EE_ASSERT( startIdx >= 0 && startIdx <= endIdx && endIdx <= batch.GetNumQueries() );
+
+        // Scene locks are per thread so each range needs its own
+        AcquireReadLock();
+        for ( int32_t i = startIdx; i < endIdx; i++ )
+        {
+            ExecuteBatchedQuery( batch, i );
+        }
+        ReleaseReadLock();
+    }
+
+    void PhysicsWorld::ExecuteBatchedQuery( QueryBatch& batch, int32_t queryIdx )
+    {
+        // Hits are gathered on the stack first, sorted and then only the closest ones are copied into the hit slots
+        // Note: PhysX stops reporting touches once the touch buffer is full and the touches are not reported in distance order,
+        // so for queries with more than 'maxTouches' touches, the kept hits are only the closest of the ones PhysX reported
+        constexpr static int32_t const maxTouches = 32;
+        QueryBatch::Hit hits[maxTouches + 1];
+        int32_t numHits = 0;
+
+        QueryBatch::Query const& query = batch.m_queries[queryIdx];
+        QueryRules const& rules = *query.m_pRules;
+        PX::QueryFilter filterCallback( rules );
+
+        // Ray Casts
+        //-------------------------------------------------------------------------
+
+        if ( query.m_type == QueryBatch::QueryType::RayCast )
+        {
+            PxRaycastHit touches[maxTouches];
+            PxRaycastBuffer buffer( touches, rules.m_allowMultipleHits ? maxTouches : 0 );
+            m_pScene->raycast( ToPx( query.m_transform.GetTranslation() ), ToPx( query.m_direction ), query.m_distance, buffer, rules.m_hitFlags, rules.m_queryFilterData, &filterCallback );
+
+            auto ConvertHit = [&] ( PxRaycastHit const& pxHit )
+            {
+                auto& hit = hits[numHits++];
+                PX::ConvertRayCastHit( pxHit, hit );
+                hit.m_shapePosition = Vector::Zero;
+            };
+
+            if ( buffer.hasBlock )
+            {
+                ConvertHit( buffer.block );
+            }
+
+            for ( uint32_t i = 0; i < buffer.nbTouches; i++ )
+            {
+                ConvertHit( buffer.getTouch( i ) );
+            }
+        }
+
+        // Shape Queries
+        //-------------------------------------------------------------------------
+
+        else
+        {
+            PxGeometryHolder geo;
+            Quaternion const orientation = PX::CreateQueryGeometry( query.m_shape, query.m_shapeSize, query.m_transform.GetRotation(), geo );
+
+            Vector const position = query.m_transform.GetTranslation();
+            PxTransform const pxTransform( ToPx( Transform( orientation, position ) ) );
+
+            // Sweeps
+            //-------------------------------------------------------------------------
+
+            if ( query.m_type == QueryBatch::QueryType::Sweep )
+            {
+                PxSweepHit touches[maxTouches];
+                PxSweepBuffer buffer( touches, rules.m_allowMultipleHits ? maxTouches : 0 );
+                m_pScene->sweep( geo.any(), pxTransform, ToPx( query.m_direction ), query.m_distance, buffer, rules.m_hitFlags, rules.m_queryFilterData, &filterCallback );
+
+                auto ConvertHit = [&] ( PxSweepHit const& pxHit )
+                {
+                    PX::ConvertSweepHit( pxHit, geo.any(), pxTransform, query.m_direction, rules.m_calculateDepenetration, hits[numHits++] );
+                };
+
+                if ( buffer.hasBlock )
+                {
+                    ConvertHit( buffer.block );
+                }
+
+                for ( uint32_t i = 0; i < buffer.nbTouches; i++ )
+                {
+                    ConvertHit( buffer.getTouch( i ) );
+                }
+            }
+
+            // Overlaps
+            //-------------------------------------------------------------------------
+
+            else
+            {
+                PxOverlapHit touches[maxTouches];
+                PxOverlapBuffer buffer( touches, maxTouches );
+                m_pScene->overlap( geo.any(), pxTransform, buffer, rules.m_queryFilterData, &filterCallback );
+
+                auto ConvertOverlap = [&] ( PxOverlapHit const& pxHit )
+                {
+                    auto& hit = hits[numHits++];
+                    PX::ConvertOverlapHit( pxHit, geo.any(), pxTransform, rules.m_calculateDepenetration, hit );
+                    hit.m_shapePosition = position;
+                    hit.m_contactPoint = Vector::Zero;
+                    hit.m_isInitiallyOverlapping = true;
+                };
+
+                if ( buffer.hasBlock )
+                {
+                    ConvertOverlap( buffer.block );
+                }
+
+                for ( uint32_t i = 0; i < buffer.nbTouches; i++ )
+                {
+                    ConvertOverlap( buffer.getTouch( i ) );
+                }
+            }
+        }
+
+        // Fill Results
+        //-------------------------------------------------------------------------
+
+        // Overlaps have no meaningful order, so they are kept in the order they were reported
+        if ( query.m_type != QueryBatch::QueryType::Overlap )
+        {
+            eastl::sort( hits, hits + numHits, [] ( QueryBatch::Hit const& a, QueryBatch::Hit const& b ) { return a.m_distance < b.m_distance; } );
+        }
+
+        QueryBatch::Result& result = batch.m_results[queryIdx];
+        result.m_numHits = Math::Min( numHits, batch.m_maxHitsPerQuery );
+        result.m_wasTruncated = numHits > result.m_numHits;
+        result.m_hasInitialOverlap = numHits > 0 && hits[0].m_isInitiallyOverlapping;
+        result.m_actualDistance = ( numHits == 0 ) ? query.m_distance : ( result.m_hasInitialOverlap ? 0.0f : hits[0].m_distance );
+
+        QueryBatch::Hit* pHitSlots = &batch.m_hits[queryIdx * batch.m_maxHitsPerQuery];
+        for ( int32_t i = 0; i < result.m_numHits; i++ )
+        {
+            pHitSlots[i] = hits[i];
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -830,7 +1333,12 @@ namespace EE::Physics
     Ragdoll* PhysicsWorld::CreateRagdoll( RagdollDefinition const* pDefinition, StringID const& profileID, uint64_t userID )
     {
         EE_ASSERT( m_pScene != nullptr && pDefinition != nullptr );
+
+        // Articulations cannot be added while a step is in flight
+        WaitForSimulationResults();
+
         auto pRagdoll = EE::New<Ragdoll>( pDefinition, profileID, userID );
+        pRagdoll->m_pWorld = this;
         pRagdoll->AddToScene( m_pScene );
         return pRagdoll;
     }
@@ -838,6 +1346,7 @@ namespace EE::Physics
     void PhysicsWorld::DestroyRagdoll( Ragdoll*& pRagdoll )
     {
         EE_ASSERT( pRagdoll );
+        WaitForSimulationResults();
         pRagdoll->RemoveFromScene();
         EE::Delete( pRagdoll );
     }
@@ -3,11 +3,16 @@
 #include "Engine/Physics/PhysicsQuery.h"
 #include "System/Time/Time.h"
 #include "System/Math/Transform.h"
+#include "System/Threading/Threading.h"
 #include <atomic>
 
 //-------------------------------------------------------------------------
 
-namespace EE { struct AABB; }
+namespace EE 
+{
+    struct AABB;
+    class TaskSystem;
+}
 
 namespace physx 
 {
@@ -30,20 +35,55 @@ namespace EE::Physics
     class Ragdoll;
     struct RagdollDefinition;
 
+    namespace PX
+    {
+        class TaskDispatcher;
+        struct SimulationTask;
+        struct QueryBatchTask;
+    }
+
     //-------------------------------------------------------------------------
 
     class EE_ENGINE_API PhysicsWorld final
     {
         friend class PhysicsWorldSystem;
+        friend struct PX::QueryBatchTask;
+
+        enum class SimulationState : uint8_t
+        {
+            Idle,
+            InFlight,
+            Fetching,
+        };
 
     public:
 
         // The distance that the shape is pushed away from a detected collision after a sweep - currently set to 5mm as that is a relatively standard value
         static constexpr float const s_sweepSeperationDistance = 0.005f;
 
+        // The simulation always steps at a fixed rate, a frame runs as many steps as the accumulated time allows up to the max substep count
+        static constexpr float const s_defaultFixedTimeStep = 1.0f / 60.0f;
+        static constexpr int32_t const s_defaultMaxSubsteps = 4;
+        static constexpr int32_t const s_maxSubstepsLimit = 8;
+
+        // Query batches smaller than this are executed on the calling thread, this is also the smallest range a worker will pick up
+        static constexpr int32_t const s_minQueriesPerBatchTask = 16;
+
+        #if EE_DEVELOPMENT_TOOLS
+        struct SimulationStats
+        {
+            Milliseconds                                        m_stepTimes[s_maxSubstepsLimit];
+            Milliseconds                                        m_totalTime = 0;
+            Milliseconds                                        m_fetchWaitTime = 0;    // Async only: how long the consumer that fetched the results was blocked waiting for the step to complete
+            Seconds                                             m_droppedTime = 0.0f;   // Time discarded by the spiral-of-death guard
+            int32_t                                             m_numSteps = 0;
+            int32_t                                             m_numFramesWithDroppedTime = 0;
+        };
+        #endif
+
     public:
 
-        PhysicsWorld( MaterialRegistry const* pRegistry, bool isGameWorld );
+        PhysicsWorld( MaterialRegistry const* pRegistry, TaskSystem* pTaskSystem, bool isGameWorld );
         ~PhysicsWorld();
 
         // Locks
@@ -54,6 +94,38 @@ namespace EE::Physics
         void AcquireWriteLock();
         void ReleaseWriteLock();
 
+        // Simulation
+        //-------------------------------------------------------------------------
+
+        inline Seconds GetFixedTimeStep() const { return m_fixedTimeStep; }
+        void SetFixedTimeStep( Seconds timeStep );
+
+        inline int32_t GetMaxSubsteps() const { return m_maxSubsteps; }
+        inline void SetMaxSubsteps( int32_t maxSubsteps ) { m_maxSubsteps = Math::Clamp( maxSubsteps, 1, s_maxSubstepsLimit ); }
+
+        // Should the component transforms be interpolated between the last two simulated states
+        inline bool IsInterpolationEnabled() const { return m_isInterpolationEnabled; }
+        inline void SetInterpolationEnabled( bool isEnabled ) { m_isInterpolationEnabled = isEnabled; }
+
+        // How far the leftover accumulated time is between the last simulated state and the next one [0, 1]
+        inline float GetInterpolationFactor() const { return m_timeAccumulator.ToFloat() / m_fixedTimeStep.ToFloat(); }
+
+        // Async Simulation
+        //-------------------------------------------------------------------------
+        // In async mode the final step of a frame is kicked off on a worker and the caller returns immediately
+        // While a step is in flight the scene is double buffered: queries and reads see the pre-step state and writes are buffered until the results are fetched
+        // Anything that consumes the step results (dynamic transforms, ragdoll poses, etc...) needs to call 'WaitForSimulationResults' first
+        // This is disabled by default, since all queries made from the post-physics stage will be one step stale (see the query notes below)
+
+        inline bool IsAsyncSimulationEnabled() const { return m_isAsyncSimulationEnabled; }
+        void SetAsyncSimulationEnabled( bool isEnabled );
+
+        inline bool IsSimulationInFlight() const { return m_simulationState.load( std::memory_order_acquire ) != SimulationState::Idle; }
+
+        // Block until the in-flight step completes and fetch its results, does nothing if there is no step in flight
+        // Do not call this while holding a scene lock!
+        void WaitForSimulationResults();
+
         // Ragdolls
         //-------------------------------------------------------------------------
 
@@ -62,6 +134,8 @@ namespace EE::Physics
 
         // Queries
         //-------------------------------------------------------------------------
+        // Queries never wait for an in-flight async step. In async mode, any query made before the results are fetched (i.e. from post-physics entity updates)
+        // will see the scene as it was before the final step of the frame. Call 'WaitForSimulationResults' first if you need the post-step scene.
 
         inline bool RayCast( Vector const& start, Vector const& end, QueryRules const& rules, RayCastResults& outResults ) 
         {
@@ -194,6 +268,14 @@ namespace EE::Physics
             return BoxOverlap( halfExtents, shapeTransform.GetRotation(), shapeTransform.GetTranslation(), rules, outResults );
         }
 
+        // Batched Queries
+        //-------------------------------------------------------------------------
+        // Executes all the queries in the batch and writes the results back into it, large batches are split across the worker threads
+        // Each worker takes a read lock for its whole range, so this must not be called while holding the write lock!
+        // Same as the individual queries, batches do not wait for an in-flight async step
+
+        void ExecuteQueryBatch( QueryBatch& batch );
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -208,6 +290,8 @@ namespace EE::Physics
 
         void SetDebugCullingBox( AABB const& cullingBox );
         physx::PxRenderBuffer const& GetRenderBuffer() const;
+
+        inline SimulationStats const& GetSimulationStats() const { return m_simulationStats; }
         #endif
 
     private:
@@ -220,7 +304,18 @@ namespace EE::Physics
         // Simulation
         //-------------------------------------------------------------------------
 
-        void Simulate( Seconds deltaTime );
+        // Add the frame delta to the accumulator and return the number of fixed steps to run this frame
+        // Any whole steps beyond the max substep count are dropped so that a slow frame cannot cause ever increasing step counts
+        int32_t AccumulateTime( Seconds deltaTime );
+
+        // Run a single fixed step, 'stepIdx' is the index of the step within the current frame
+        // Async steps return as soon as the step is kicked off, the results are fetched by the first call to 'WaitForSimulationResults'
+        void SimulateStep( int32_t stepIdx, bool runAsync = false );
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Add the timings of the last fetched async step to the simulation stats, needs to be called by the world system that owns the stats after waiting for the results
+        void UpdateAsyncStepStats();
+        #endif
 
         // Queries
         //-------------------------------------------------------------------------
@@ -233,6 +328,10 @@ namespace EE::Physics
         bool SweepInternal( physx::PxGeometry const& geo, Transform const& startTransform, Vector const& direction, float distance, QueryRules const& rules, SweepResults& outResults );
         bool OverlapInternal( physx::PxGeometry const& geo, Transform const& transform, QueryRules const& rules, OverlapResults& outResults );
 
+        // Execute the batch queries in the range [startIdx, endIdx), takes the read lock for the duration of the range
+        void ExecuteQueryBatchRange( QueryBatch& batch, int32_t startIdx, int32_t endIdx );
+        void ExecuteBatchedQuery( QueryBatch& batch, int32_t queryIdx );
+
         // Actors and Shapes
         //-------------------------------------------------------------------------
 
@@ -245,11 +344,24 @@ namespace EE::Physics
     private:
 
         MaterialRegistry const*                                 m_pMaterialRegistry = nullptr;
+        TaskSystem*                                             m_pTaskSystem = nullptr;
+        PX::TaskDispatcher*                                     m_pTaskDispatcher = nullptr;
+        PX::SimulationTask*                                     m_pSimulationTask = nullptr;
         physx::PxScene*                                         m_pScene = nullptr;
         physx::PxControllerManager*                             m_pControllerManager = nullptr;
         bool                                                    m_isGameWorld = false;
 
+        Seconds                                                 m_fixedTimeStep = s_defaultFixedTimeStep;
+        Seconds                                                 m_timeAccumulator = 0.0f;
+        int32_t                                                 m_maxSubsteps = s_defaultMaxSubsteps;
+        bool                                                    m_isInterpolationEnabled = true;
+        bool                                                    m_isAsyncSimulationEnabled = false;     // Opt-in, see the async simulation notes
+        std::atomic<SimulationState>                            m_simulationState = SimulationState::Idle;
+
         #if EE_DEVELOPMENT_TOOLS
+        SimulationStats                                         m_simulationStats;
+        Milliseconds                                            m_asyncFetchWaitTime = 0;       // Written by the thread that fetched the async step results
+        bool                                                    m_hasUnreportedAsyncStep = false;
         uint32_t                                                m_sceneDebugFlags = 0;
         float                                                   m_debugDrawDistance = 10.0f;
         
@@ -12,6 +12,9 @@ namespace EE::Physics
     PhysicsMaterialDatabaseLoader::PhysicsMaterialDatabaseLoader()
     {
         m_loadableTypes.push_back( MaterialDatabase::GetStaticResourceTypeID() );
+
+        // Loading registers the materials with the (non thread-safe) material registry
+        m_isParallelLoadingSupported = false;
     }
 
     bool PhysicsMaterialDatabaseLoader::LoadInternal( ResourceID const& resID, Resource::ResourceRecord* pResourceRecord, Serialization::BinaryInputArchive& archive ) const
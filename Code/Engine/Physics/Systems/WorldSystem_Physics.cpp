@@ -12,11 +12,24 @@
 #include "Engine/Entity/EntityLog.h"
 #include "System/Profiling.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Physics
 {
+    static Transform GetSimulatedWorldTransform( PhysicsShapeComponent const* pComponent, physx::PxTransform const& physicsPose )
+    {
+        if ( IsOfType<CapsuleComponent>( pComponent ) )
+        {
+            return FromPxCapsuleTransform( physicsPose );
+        }
+
+        return FromPx( physicsPose );
+    }
+
+    //-------------------------------------------------------------------------
+
     void PhysicsWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {
         auto OnRebuild = [this] ( PhysicsShapeComponent* pShapeComponent )
@@ -29,7 +42,7 @@ namespace EE::Physics
 
         //-------------------------------------------------------------------------
 
-        m_pWorld = EE::New<PhysicsWorld>( systemRegistry.GetSystem<MaterialRegistry>(), IsInAGameWorld() );
+        m_pWorld = EE::New<PhysicsWorld>( systemRegistry.GetSystem<MaterialRegistry>(), systemRegistry.GetSystem<TaskSystem>(), IsInAGameWorld() );
         EE_ASSERT( m_pWorld != nullptr );
     }
 
@@ -133,7 +146,8 @@ namespace EE::Physics
     void PhysicsWorldSystem::RegisterDynamicComponent( PhysicsShapeComponent* pComponent )
     {
         EE_ASSERT( pComponent != nullptr && pComponent->IsActorCreated() && pComponent->IsDynamic() );
-        m_dynamicShapeComponents.Add( pComponent );;
+        m_dynamicShapeComponents.Add( pComponent );
+        pComponent->m_previousSimulatedTransform = pComponent->GetWorldTransform();
     }
 
     void PhysicsWorldSystem::UnregisterDynamicComponent( PhysicsShapeComponent* pComponent )
@@ -181,6 +195,19 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    bool PhysicsWorldSystem::GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const
+    {
+        // The simulation step only touches the physics scene and the shape components (actor rebuilds)
+        // The post-physics stage writes back transforms and so is left to update serially
+        if ( stage == UpdateStage::Physics )
+        {
+            outAccess.WritesComponent<PhysicsShapeComponent>();
+            return true;
+        }
+
+        return false;
+    }
+
     void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         // HACK HACK
@@ -290,7 +317,9 @@ namespace EE::Physics
         }
         else
         {
-           // Do nothing for now
+            // Make sure we never leave a step in flight across a pause
+            m_pWorld->WaitForSimulationResults();
+            EE_DEVELOPMENT_TOOLS_ONLY( m_pWorld->UpdateAsyncStepStats() );
         }
     }
 
@@ -298,34 +327,60 @@ namespace EE::Physics
     {
         EE_PROFILE_FUNCTION_PHYSICS();
 
-        m_pWorld->Simulate( ctx.GetDeltaTime() );
+        int32_t const numSteps = m_pWorld->AccumulateTime( ctx.GetDeltaTime() );
+        for ( int32_t i = 0; i < numSteps; i++ )
+        {
+            bool const isFinalStep = ( i == numSteps - 1 );
+
+            // We interpolate between the last two simulated states, so only the state before the final step is needed
+            if ( isFinalStep && IsInAGameWorld() )
+            {
+                RecordPreviousSimulatedTransforms();
+            }
+
+            // Only the final step is overlapped with the rest of the frame, the results are fetched in the post-physics update at the latest
+            m_pWorld->SimulateStep( i, isFinalStep && m_pWorld->IsAsyncSimulationEnabled() );
+        }
+    }
+
+    void PhysicsWorldSystem::RecordPreviousSimulatedTransforms()
+    {
+        EE_PROFILE_FUNCTION_PHYSICS();
+
+        m_pWorld->AcquireReadLock();
+        for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
+        {
+            auto physicsPose = pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose();
+            pDynamicPhysicsComponent->m_previousSimulatedTransform = GetSimulatedWorldTransform( pDynamicPhysicsComponent, physicsPose );
+        }
+        m_pWorld->ReleaseReadLock();
     }
 
     void PhysicsWorldSystem::PostPhysicsUpdate( EntityWorldUpdateContext const& ctx )
     {
         EE_PROFILE_FUNCTION_PHYSICS();
 
-        // Transfer physics poses back to dynamic components
+        // The post-physics entity updates have already run by now, so this is the latest we can fetch the results
+        m_pWorld->WaitForSimulationResults();
+        EE_DEVELOPMENT_TOOLS_ONLY( m_pWorld->UpdateAsyncStepStats() );
+
+        // Transfer physics poses back to dynamic components, interpolated by the leftover accumulated time
         //-------------------------------------------------------------------------
 
         if ( IsInAGameWorld() )
         {
+            float const interpolationFactor = m_pWorld->IsInterpolationEnabled() ? m_pWorld->GetInterpolationFactor() : 1.0f;
+
             m_pWorld->AcquireWriteLock();
 
             for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
             {
                 EE_ASSERT( pDynamicPhysicsComponent->IsActorCreated() && pDynamicPhysicsComponent->IsDynamic() );
 
-                if ( auto pCapsuleComponent = TryCast<CapsuleComponent>( pDynamicPhysicsComponent ) )
-                {
-                    auto physicsPose = pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose();
-                    pCapsuleComponent->SetWorldTransformDirectly( FromPxCapsuleTransform( physicsPose ), false );
-                }
-                else // Doesnt need a conversion
-                {
-                    auto physicsPose = pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose();
-                    pDynamicPhysicsComponent->SetWorldTransformDirectly( FromPx( physicsPose ), false );
-                }
+                auto physicsPose = pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose();
+                Transform const simulatedTransform = GetSimulatedWorldTransform( pDynamicPhysicsComponent, physicsPose );
+                Transform const interpolatedTransform = Transform::Lerp( pDynamicPhysicsComponent->m_previousSimulatedTransform, simulatedTransform, interpolationFactor );
+                pDynamicPhysicsComponent->SetWorldTransformDirectly( interpolatedTransform, false );
             }
 
             m_pWorld->ReleaseWriteLock();
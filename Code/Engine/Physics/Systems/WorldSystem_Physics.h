@@ -57,12 +57,16 @@ namespace EE::Physics
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
+        virtual bool GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const override;
 
         void RegisterDynamicComponent( PhysicsShapeComponent* pComponent );
         void UnregisterDynamicComponent( PhysicsShapeComponent* pComponent );
 
         void ProcessActorRebuildRequests( EntityWorldUpdateContext const& ctx );
 
+        // Record the current simulated transforms of all dynamic components as the interpolation start point
+        void RecordPreviousSimulatedTransforms();
+
         void PhysicsUpdate( EntityWorldUpdateContext const& ctx );
         void PostPhysicsUpdate( EntityWorldUpdateContext const& ctx );
 
@@ -134,14 +134,38 @@ namespace EE::Render
         EE_ASSERT( !m_animToMeshBoneMap.empty() );
         EE_ASSERT( pPose != nullptr && pPose->HasGlobalTransforms() );
 
-        int32_t const numAnimBones = pPose->GetNumBones();
-        for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
+        auto const& globalTransforms = pPose->GetGlobalTransforms();
+        int32_t const numActiveBones = pPose->GetNumActiveBones();
+        for ( auto animBoneIdx = 0; animBoneIdx < numActiveBones; animBoneIdx++ )
         {
             int32_t const meshBoneIdx = m_animToMeshBoneMap[animBoneIdx];
             if ( meshBoneIdx != InvalidIndex )
             {
-                Transform const boneTransform = pPose->GetGlobalTransform( animBoneIdx );
-                m_boneTransforms[meshBoneIdx] = boneTransform;
+                m_boneTransforms[meshBoneIdx] = globalTransforms[animBoneIdx];
+            }
+        }
+
+        // Bones excluded by the skeleton LOD are left in their reference pose, so they rigidly follow their closest active ancestor
+        // Bones are sorted parents first, so a single pass is enough to propagate the transforms
+        int32_t const numAnimBones = pPose->GetNumBones();
+        int32_t const numInactiveBones = numAnimBones - numActiveBones;
+        if ( numInactiveBones > 0 )
+        {
+            auto inactiveGlobalTransforms = EE_STACK_ARRAY_ALLOC( Transform, numInactiveBones );
+            for ( auto animBoneIdx = numActiveBones; animBoneIdx < numAnimBones; animBoneIdx++ )
+            {
+                int32_t const parentIdx = m_skeleton->GetParentBoneIndex( animBoneIdx );
+                EE_ASSERT( parentIdx != InvalidIndex && parentIdx < animBoneIdx );
+                Transform const& parentGlobalTransform = ( parentIdx < numActiveBones ) ? globalTransforms[parentIdx] : inactiveGlobalTransforms[parentIdx - numActiveBones];
+
+                Transform& boneGlobalTransform = inactiveGlobalTransforms[animBoneIdx - numActiveBones];
+                boneGlobalTransform = pPose->GetTransform( animBoneIdx ) * parentGlobalTransform;
+
+                int32_t const meshBoneIdx = m_animToMeshBoneMap[animBoneIdx];
+                if ( meshBoneIdx != InvalidIndex )
+                {
+                    m_boneTransforms[meshBoneIdx] = boneGlobalTransform;
+                }
             }
         }
     }
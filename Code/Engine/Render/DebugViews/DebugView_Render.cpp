@@ -56,6 +56,23 @@ namespace EE::Render
 
         DrawRenderVisualizationModesMenu( m_pWorld );
 
+        ImGuiX::TextSeparator( "Culling" );
+
+        int32_t cullingStructure = (int32_t) m_pWorldRendererSystem->GetStaticMeshCullingStructure();
+        bool cullingStructureUpdated = false;
+        cullingStructureUpdated |= ImGui::RadioButton( "Static Mesh Flat BVH", &cullingStructure, (int32_t) RendererWorldSystem::StaticMeshCullingStructure::FlatBVH );
+        cullingStructureUpdated |= ImGui::RadioButton( "Static Mesh Quad Tree", &cullingStructure, (int32_t) RendererWorldSystem::StaticMeshCullingStructure::QuadTree );
+        if ( cullingStructureUpdated )
+        {
+            m_pWorldRendererSystem->SetStaticMeshCullingStructure( (RendererWorldSystem::StaticMeshCullingStructure) cullingStructure );
+        }
+
+        auto const& cullingStats = m_pWorldRendererSystem->m_cullingStats;
+        ImGui::Text( "Cull Time: %.3fms", cullingStats.m_cullTime );
+        ImGui::Text( "Static Meshes: %u / %u (%u bounds tests)", cullingStats.m_numVisibleStaticMeshes, cullingStats.m_numStaticMeshes, cullingStats.m_numStaticMeshTests );
+        ImGui::Text( "Dynamic Meshes: %u / %u", cullingStats.m_numVisibleDynamicMeshes, cullingStats.m_numDynamicMeshes );
+        ImGui::Text( "Skeletal Meshes: %u / %u", cullingStats.m_numVisibleSkeletalMeshes, cullingStats.m_numSkeletalMeshes );
+
         ImGuiX::TextSeparator( "Static Meshes" );
 
         ImGui::Checkbox( "Show Static Mesh Bounds", &m_pWorldRendererSystem->m_showStaticMeshBounds );
@@ -0,0 +1,151 @@
+#include "CullingBVH.h"
+#include "System/Profiling.h"
+#include <EASTL/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    void CullingBVH::Build( TVector<AABB> const& itemBounds, TVector<uint64_t> const& itemUserData )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+        EE_ASSERT( itemBounds.size() == itemUserData.size() );
+
+        Clear();
+
+        uint32_t const numItems = (uint32_t) itemBounds.size();
+        if ( numItems == 0 )
+        {
+            return;
+        }
+
+        m_nodes.reserve( ( 2 * numItems ) / s_maxItemsPerLeaf + 1 );
+        m_itemBounds.reserve( numItems );
+        m_items.reserve( numItems );
+
+        m_buildOrder.resize( numItems );
+        for ( uint32_t i = 0; i < numItems; i++ )
+        {
+            m_buildOrder[i] = i;
+        }
+
+        BuildSubtree( itemBounds, itemUserData, 0, numItems );
+        EE_ASSERT( m_items.size() == numItems );
+    }
+
+    void CullingBVH::Clear()
+    {
+        m_nodes.clear();
+        m_itemBounds.clear();
+        m_items.clear();
+    }
+
+    void CullingBVH::BuildSubtree( TVector<AABB> const& itemBounds, TVector<uint64_t> const& itemUserData, uint32_t begin, uint32_t end )
+    {
+        EE_ASSERT( end > begin );
+
+        // Calculate the bounds of the items and of their centers
+        //-------------------------------------------------------------------------
+
+        Vector boundsMin = itemBounds[m_buildOrder[begin]].GetMin();
+        Vector boundsMax = itemBounds[m_buildOrder[begin]].GetMax();
+        Vector centersMin = itemBounds[m_buildOrder[begin]].GetCenter();
+        Vector centersMax = centersMin;
+
+        for ( uint32_t i = begin + 1; i < end; i++ )
+        {
+            AABB const& bounds = itemBounds[m_buildOrder[i]];
+            boundsMin = Vector::Min( boundsMin, bounds.GetMin() );
+            boundsMax = Vector::Max( boundsMax, bounds.GetMax() );
+            centersMin = Vector::Min( centersMin, bounds.GetCenter() );
+            centersMax = Vector::Max( centersMax, bounds.GetCenter() );
+        }
+
+        uint32_t const nodeIdx = (uint32_t) m_nodes.size();
+        Node& node = m_nodes.emplace_back();
+        node.m_center = ( boundsMin + boundsMax ) * Vector::Half;
+        node.m_extents = ( boundsMax - boundsMin ) * Vector::Half;
+        node.m_firstItemIdx = (uint32_t) m_items.size();
+
+        // Leaf
+        //-------------------------------------------------------------------------
+
+        uint32_t const numItems = end - begin;
+        if ( numItems <= s_maxItemsPerLeaf )
+        {
+            for ( uint32_t i = begin; i < end; i++ )
+            {
+                m_itemBounds.emplace_back( itemBounds[m_buildOrder[i]] );
+                m_items.emplace_back( itemUserData[m_buildOrder[i]] );
+            }
+            return;
+        }
+
+        // Split at the median item along the longest axis of the item centers
+        //-------------------------------------------------------------------------
+
+        Float3 const centerRange = centersMax - centersMin;
+        int32_t splitAxis = ( centerRange.m_x > centerRange.m_y ) ? 0 : 1;
+        splitAxis = ( centerRange.m_z > centerRange[splitAxis] ) ? 2 : splitAxis;
+
+        uint32_t const mid = begin + ( numItems / 2 );
+        eastl::nth_element( m_buildOrder.begin() + begin, m_buildOrder.begin() + mid, m_buildOrder.begin() + end, [&itemBounds, splitAxis] ( uint32_t a, uint32_t b )
+        {
+            return itemBounds[a].GetCenter()[splitAxis] < itemBounds[b].GetCenter()[splitAxis];
+        } );
+
+        BuildSubtree( itemBounds, itemUserData, begin, mid );
+        BuildSubtree( itemBounds, itemUserData, mid, end );
+
+        // The node reference is invalidated by the recursion
+        m_nodes[nodeIdx].m_subtreeSize = (uint32_t) m_nodes.size() - nodeIdx;
+    }
+
+    //-------------------------------------------------------------------------
+
+    uint32_t CullingBVH::FindVisible( Math::ViewVolume::CullingPlanes const& planes, TVector<uint64_t>& outResults ) const
+    {
+        uint32_t numTests = 0;
+
+        uint32_t const numNodes = (uint32_t) m_nodes.size();
+        uint32_t nodeIdx = 0;
+        while ( nodeIdx < numNodes )
+        {
+            Node const& node = m_nodes[nodeIdx];
+            uint32_t const nextSubtreeIdx = nodeIdx + node.m_subtreeSize;
+
+            numTests++;
+            auto const result = planes.Intersect( AABB( Vector( node.m_center ), Vector( node.m_extents ) ) );
+            if ( result == Math::ViewVolume::IntersectionResult::FullyOutside )
+            {
+                nodeIdx = nextSubtreeIdx;
+            }
+            else if ( result == Math::ViewVolume::IntersectionResult::FullyInside )
+            {
+                // The items of the next subtree (in depth-first order) follow directly on from the items of this subtree
+                uint32_t const endItemIdx = ( nextSubtreeIdx < numNodes ) ? m_nodes[nextSubtreeIdx].m_firstItemIdx : (uint32_t) m_items.size();
+                outResults.insert( outResults.end(), m_items.begin() + node.m_firstItemIdx, m_items.begin() + endItemIdx );
+                nodeIdx = nextSubtreeIdx;
+            }
+            else if ( node.m_subtreeSize == 1 )
+            {
+                uint32_t const endItemIdx = ( nextSubtreeIdx < numNodes ) ? m_nodes[nextSubtreeIdx].m_firstItemIdx : (uint32_t) m_items.size();
+                for ( uint32_t i = node.m_firstItemIdx; i < endItemIdx; i++ )
+                {
+                    numTests++;
+                    if ( planes.Intersect( m_itemBounds[i] ) != Math::ViewVolume::IntersectionResult::FullyOutside )
+                    {
+                        outResults.emplace_back( m_items[i] );
+                    }
+                }
+                nodeIdx = nextSubtreeIdx;
+            }
+            else
+            {
+                nodeIdx++;
+            }
+        }
+
+        return numTests;
+    }
+}
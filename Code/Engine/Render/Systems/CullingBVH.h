@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Math/ViewVolume.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Culling BVH
+//-------------------------------------------------------------------------
+// A compact, flattened bounding volume hierarchy used to view cull a set of boxes that rarely change
+//
+// * Nodes are stored depth-first in a single array, so a node's first child immediately follows it
+// * Each node stores the size of its subtree, so traversal can skip over it without needing a stack
+// * Items are stored in leaf order so the items of any subtree are a contiguous range, this lets us accept fully visible subtrees without visiting them
+//
+// There is no incremental insertion/removal, the tree is rebuilt whenever its contents change
+
+namespace EE::Render
+{
+    class EE_ENGINE_API CullingBVH
+    {
+        constexpr static uint32_t const s_maxItemsPerLeaf = 4;
+
+        struct Node
+        {
+            Float3          m_center;
+            uint32_t        m_firstItemIdx = 0;         // The first item in this subtree
+            Float3          m_extents;
+            uint32_t        m_subtreeSize = 1;          // The number of nodes in this subtree (including this node), leaf nodes have a size of 1
+        };
+
+        static_assert( sizeof( Node ) == 32, "Nodes should be kept compact, two nodes per cache line" );
+
+    public:
+
+        inline bool IsEmpty() const { return m_items.empty(); }
+        inline uint32_t GetNumItems() const { return (uint32_t) m_items.size(); }
+        inline uint32_t GetNumNodes() const { return (uint32_t) m_nodes.size(); }
+
+        // Rebuild the tree from the supplied item bounds and user data
+        void Build( TVector<AABB> const& itemBounds, TVector<uint64_t> const& itemUserData );
+        void Clear();
+
+        // Adds the user data for all items that are not fully outside the planes, returns the number of bounding volume tests performed
+        uint32_t FindVisible( Math::ViewVolume::CullingPlanes const& planes, TVector<uint64_t>& outResults ) const;
+
+        template<typename T>
+        uint32_t FindVisible( Math::ViewVolume::CullingPlanes const& planes, TVector<T*>& outResults ) const
+        {
+            return FindVisible( planes, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
+    private:
+
+        void BuildSubtree( TVector<AABB> const& itemBounds, TVector<uint64_t> const& itemUserData, uint32_t begin, uint32_t end );
+
+    private:
+
+        TVector<Node>                   m_nodes;
+        TVector<AABB>                   m_itemBounds;           // Stored in leaf order
+        TVector<uint64_t>               m_items;                // Stored in leaf order
+        TVector<uint32_t>               m_buildOrder;           // Scratch memory for the build
+    };
+}
@@ -10,6 +10,8 @@
 #include "System/Render/RenderCoreResources.h"
 #include "System/Render/RenderViewport.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Time.h"
 #include "System/Profiling.h"
 #include "System/Log.h"
 
@@ -19,6 +21,9 @@ namespace EE::Render
 {
     void RendererWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
     {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
         m_staticMeshMobilityChangedEventBinding = StaticMeshComponent::OnMobilityChanged().Bind( [this] ( StaticMeshComponent* pMeshComponent ) { OnStaticMeshMobilityUpdated( pMeshComponent ); } );
         m_staticMeshStaticTransformUpdatedEventBinding = StaticMeshComponent::OnStaticMobilityTransformUpdated().Bind( [this] ( StaticMeshComponent* pMeshComponent ) { OnStaticMobilityComponentTransformUpdated( pMeshComponent ); } );
     }
@@ -28,6 +33,9 @@ namespace EE::Render
         // Unbind mobility change handler and remove from various lists
         StaticMeshComponent::OnStaticMobilityTransformUpdated().Unbind( m_staticMeshStaticTransformUpdatedEventBinding );
         StaticMeshComponent::OnMobilityChanged().Unbind( m_staticMeshMobilityChangedEventBinding );
+        m_staticMeshBVH.Clear();
+        m_staticMeshQuadTree.Clear();
+        m_pTaskSystem = nullptr;
 
         EE_ASSERT( m_registeredStaticMeshComponents.empty() );
         EE_ASSERT( m_registeredSkeletalMeshComponents.empty() );
@@ -149,7 +157,7 @@ namespace EE::Render
             else
             {
                 m_staticStaticMeshComponents.Add( pMeshComponent );
-                m_staticMobilityTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
+                AddStaticMeshToCullingStructure( pMeshComponent );
             }
         }
     }
@@ -186,7 +194,7 @@ namespace EE::Render
             else
             {
                 m_staticStaticMeshComponents.Remove( pMeshComponent->GetID() );
-                m_staticMobilityTree.RemoveBox( pMeshComponent );
+                RemoveStaticMeshFromCullingStructure( pMeshComponent );
             }
         }
 
@@ -260,7 +268,7 @@ namespace EE::Render
             // Convert from static to dynamic
             if ( mobility == Mobility::Dynamic )
             {
-                m_staticMobilityTree.RemoveBox( pMeshComponent );
+                RemoveStaticMeshFromCullingStructure( pMeshComponent );
                 m_staticStaticMeshComponents.Remove( pMeshComponent->GetID() );
                 m_dynamicStaticMeshComponents.Add( pMeshComponent );
             }
@@ -268,7 +276,7 @@ namespace EE::Render
             {
                 m_dynamicStaticMeshComponents.Remove( pMeshComponent->GetID() );
                 m_staticStaticMeshComponents.Add( pMeshComponent );
-                m_staticMobilityTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
+                AddStaticMeshToCullingStructure( pMeshComponent );
             }
         }
 
@@ -283,8 +291,7 @@ namespace EE::Render
                 EE_LOG_ENTITY_ERROR( pMeshComponent, "Render", "Someone moved a mesh with static mobility: %s with entity ID %u. This should not be done!", pMeshComponent->GetNameID().c_str(), pMeshComponent->GetEntityID().m_value );
             }
 
-            m_staticMobilityTree.RemoveBox( pMeshComponent );
-            m_staticMobilityTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
+            UpdateStaticMeshInCullingStructure( pMeshComponent );
         }
 
         m_staticMobilityTransformUpdateList.clear();
@@ -293,48 +300,12 @@ namespace EE::Render
         // Culling
         //-------------------------------------------------------------------------
 
-        AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
-
-        m_visibleStaticMeshComponents.clear();
-        {
-            EE_PROFILE_SCOPE_RENDER( "Static Mesh AABB Cull" );
-            m_staticMobilityTree.FindOverlaps( viewBounds, m_visibleStaticMeshComponents );
-
-            for ( int32_t i = int32_t( m_visibleStaticMeshComponents.size() ) - 1; i >= 0 ; i-- )
-            {
-                if ( !m_visibleStaticMeshComponents[i]->IsVisible() )
-                {
-                    m_visibleStaticMeshComponents.erase_unsorted( m_visibleStaticMeshComponents.begin() + i );
-                }
-            }
-        }
-
-        for ( auto pMeshComponent : m_dynamicStaticMeshComponents )
+        if ( m_isStaticMeshCullingStructureDirty )
         {
-            EE_PROFILE_SCOPE_RENDER( "Static Mesh Dynamic Cull" );
-
-            if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
-            {
-                m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
-            }
+            RebuildStaticMeshCullingStructure();
         }
 
-        //-------------------------------------------------------------------------
-
-        m_visibleSkeletalMeshComponents.clear();
-
-        for ( auto const& meshGroup : m_skeletalMeshGroups )
-        {
-            EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Dynamic Cull" );
-
-            for ( auto pMeshComponent : meshGroup.m_components )
-            {
-                if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
-                {
-                    m_visibleSkeletalMeshComponents.emplace_back( pMeshComponent );
-                }
-            }
-        }
+        CullMeshes( ctx.GetViewport()->GetViewVolume() );
 
         //-------------------------------------------------------------------------
         // Debug
@@ -391,6 +362,252 @@ namespace EE::Render
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        // Writes a visibility flag for each mesh in the supplied range
+        template<typename T>
+        struct MeshCullingTask final : public ITaskSet
+        {
+            MeshCullingTask( Math::ViewVolume::CullingPlanes const& planes, T* const* pMeshComponents, uint8_t* pResults, uint32_t numMeshes )
+                : m_planes( planes )
+                , m_pMeshComponents( pMeshComponents )
+                , m_pResults( pResults )
+            {
+                m_SetSize = numMeshes;
+                m_MinRange = 64;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_RENDER( "Mesh Culling Task" );
+
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    T const* pMeshComponent = m_pMeshComponents[i];
+                    m_pResults[i] = pMeshComponent->IsVisible() && m_planes.Intersect( pMeshComponent->GetWorldBounds() ) != Math::ViewVolume::IntersectionResult::FullyOutside;
+                }
+            }
+
+        public:
+
+            Math::ViewVolume::CullingPlanes const&  m_planes;
+            T* const*                               m_pMeshComponents = nullptr;
+            uint8_t*                                m_pResults = nullptr;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+
+    void RendererWorldSystem::SetStaticMeshCullingStructure( StaticMeshCullingStructure structure )
+    {
+        if ( structure == m_staticMeshCullingStructure )
+        {
+            return;
+        }
+
+        m_staticMeshCullingStructure = structure;
+        m_staticMeshBVH.Clear();
+        m_staticMeshQuadTree.Clear();
+        m_isStaticMeshCullingStructureDirty = true;
+    }
+
+    void RendererWorldSystem::AddStaticMeshToCullingStructure( StaticMeshComponent* pMeshComponent )
+    {
+        if ( m_staticMeshCullingStructure == StaticMeshCullingStructure::FlatBVH || m_isStaticMeshCullingStructureDirty )
+        {
+            m_isStaticMeshCullingStructureDirty = true;
+            return;
+        }
+
+        m_staticMeshQuadTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
+    }
+
+    void RendererWorldSystem::RemoveStaticMeshFromCullingStructure( StaticMeshComponent* pMeshComponent )
+    {
+        if ( m_staticMeshCullingStructure == StaticMeshCullingStructure::FlatBVH || m_isStaticMeshCullingStructureDirty )
+        {
+            m_isStaticMeshCullingStructureDirty = true;
+            return;
+        }
+
+        m_staticMeshQuadTree.RemoveBox( pMeshComponent );
+    }
+
+    void RendererWorldSystem::UpdateStaticMeshInCullingStructure( StaticMeshComponent* pMeshComponent )
+    {
+        if ( m_staticMeshCullingStructure == StaticMeshCullingStructure::FlatBVH || m_isStaticMeshCullingStructureDirty )
+        {
+            m_isStaticMeshCullingStructureDirty = true;
+            return;
+        }
+
+        m_staticMeshQuadTree.UpdateBox( pMeshComponent, pMeshComponent->GetWorldBounds().GetAABB() );
+    }
+
+    void RendererWorldSystem::RebuildStaticMeshCullingStructure()
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        m_staticMeshCullingBuildBounds.clear();
+        m_staticMeshCullingBuildItems.clear();
+
+        for ( auto pMeshComponent : m_staticStaticMeshComponents )
+        {
+            m_staticMeshCullingBuildBounds.emplace_back( pMeshComponent->GetWorldBounds().GetAABB() );
+            m_staticMeshCullingBuildItems.emplace_back( reinterpret_cast<uint64_t>( pMeshComponent ) );
+        }
+
+        if ( m_staticMeshCullingStructure == StaticMeshCullingStructure::FlatBVH )
+        {
+            m_staticMeshBVH.Build( m_staticMeshCullingBuildBounds, m_staticMeshCullingBuildItems );
+        }
+        else
+        {
+            m_staticMeshQuadTree.Build( m_staticMeshCullingBuildBounds, m_staticMeshCullingBuildItems );
+        }
+
+        m_isStaticMeshCullingStructureDirty = false;
+    }
+
+    void RendererWorldSystem::CullMeshes( Math::ViewVolume const& viewVolume )
+    {
+        EE_PROFILE_FUNCTION_RENDER();
+
+        #if EE_DEVELOPMENT_TOOLS
+        Nanoseconds const cullStartTime = PlatformClock::GetTime();
+        #endif
+
+        Math::ViewVolume::CullingPlanes const cullingPlanes = viewVolume.GetCullingPlanes();
+
+        // Kick off the dynamic mesh culling, large lists are culled on the task system while we traverse the static mesh structure
+        //-------------------------------------------------------------------------
+
+        TVector<StaticMeshComponent*> const& dynamicMeshes = m_dynamicStaticMeshComponents.GetVector();
+        uint32_t const numDynamicMeshes = (uint32_t) dynamicMeshes.size();
+        m_dynamicMeshCullingResults.resize( numDynamicMeshes );
+        MeshCullingTask<StaticMeshComponent> dynamicMeshCullingTask( cullingPlanes, dynamicMeshes.data(), m_dynamicMeshCullingResults.data(), numDynamicMeshes );
+        bool const cullDynamicMeshesInParallel = numDynamicMeshes >= s_minMeshesForParallelCulling;
+        if ( cullDynamicMeshesInParallel )
+        {
+            m_pTaskSystem->ScheduleTask( &dynamicMeshCullingTask );
+        }
+
+        // Skeletal meshes are flattened in mesh group order, so that the visible list remains sorted by mesh
+        m_skeletalMeshCullingList.clear();
+        for ( auto const& meshGroup : m_skeletalMeshGroups )
+        {
+            m_skeletalMeshCullingList.insert( m_skeletalMeshCullingList.end(), meshGroup.m_components.begin(), meshGroup.m_components.end() );
+        }
+
+        uint32_t const numSkeletalMeshes = (uint32_t) m_skeletalMeshCullingList.size();
+        m_skeletalMeshCullingResults.resize( numSkeletalMeshes );
+        MeshCullingTask<SkeletalMeshComponent> skeletalMeshCullingTask( cullingPlanes, m_skeletalMeshCullingList.data(), m_skeletalMeshCullingResults.data(), numSkeletalMeshes );
+        bool const cullSkeletalMeshesInParallel = numSkeletalMeshes >= s_minMeshesForParallelCulling;
+        if ( cullSkeletalMeshesInParallel )
+        {
+            m_pTaskSystem->ScheduleTask( &skeletalMeshCullingTask );
+        }
+
+        // Static Meshes
+        //-------------------------------------------------------------------------
+
+        m_visibleStaticMeshComponents.clear();
+        {
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh Cull" );
+
+            uint32_t numTests = 0;
+            if ( m_staticMeshCullingStructure == StaticMeshCullingStructure::FlatBVH )
+            {
+                numTests = m_staticMeshBVH.FindVisible( cullingPlanes, m_visibleStaticMeshComponents );
+            }
+            else
+            {
+                numTests = m_staticMeshQuadTree.FindVisible( cullingPlanes, m_visibleStaticMeshComponents );
+            }
+
+            for ( int32_t i = int32_t( m_visibleStaticMeshComponents.size() ) - 1; i >= 0 ; i-- )
+            {
+                if ( !m_visibleStaticMeshComponents[i]->IsVisible() )
+                {
+                    m_visibleStaticMeshComponents.erase_unsorted( m_visibleStaticMeshComponents.begin() + i );
+                }
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_cullingStats.m_numStaticMeshes = (uint32_t) m_staticStaticMeshComponents.size();
+            m_cullingStats.m_numStaticMeshTests = numTests;
+            m_cullingStats.m_numVisibleStaticMeshes = (uint32_t) m_visibleStaticMeshComponents.size();
+            #endif
+        }
+
+        // Dynamic Meshes
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh Dynamic Cull" );
+
+            if ( cullDynamicMeshesInParallel )
+            {
+                m_pTaskSystem->WaitForTask( &dynamicMeshCullingTask );
+            }
+            else
+            {
+                dynamicMeshCullingTask.ExecuteRange( { 0, numDynamicMeshes }, 0 );
+            }
+
+            for ( uint32_t i = 0; i < numDynamicMeshes; i++ )
+            {
+                if ( m_dynamicMeshCullingResults[i] )
+                {
+                    m_visibleStaticMeshComponents.emplace_back( dynamicMeshes[i] );
+                }
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_cullingStats.m_numDynamicMeshes = numDynamicMeshes;
+            m_cullingStats.m_numVisibleDynamicMeshes = (uint32_t) m_visibleStaticMeshComponents.size() - m_cullingStats.m_numVisibleStaticMeshes;
+            #endif
+        }
+
+        // Skeletal Meshes
+        //-------------------------------------------------------------------------
+
+        m_visibleSkeletalMeshComponents.clear();
+        {
+            EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Dynamic Cull" );
+
+            if ( cullSkeletalMeshesInParallel )
+            {
+                m_pTaskSystem->WaitForTask( &skeletalMeshCullingTask );
+            }
+            else
+            {
+                skeletalMeshCullingTask.ExecuteRange( { 0, numSkeletalMeshes }, 0 );
+            }
+
+            for ( uint32_t i = 0; i < numSkeletalMeshes; i++ )
+            {
+                if ( m_skeletalMeshCullingResults[i] )
+                {
+                    m_visibleSkeletalMeshComponents.emplace_back( m_skeletalMeshCullingList[i] );
+                }
+            }
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_cullingStats.m_numSkeletalMeshes = numSkeletalMeshes;
+            m_cullingStats.m_numVisibleSkeletalMeshes = (uint32_t) m_visibleSkeletalMeshComponents.size();
+            #endif
+        }
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_cullingStats.m_cullTime = Milliseconds( PlatformClock::GetTime() - cullStartTime ).ToFloat();
+        #endif
+    }
+
+    //-------------------------------------------------------------------------
+
     void RendererWorldSystem::OnStaticMeshMobilityUpdated( StaticMeshComponent* pComponent )
     {
         EE_ASSERT( pComponent != nullptr && pComponent->IsInitialized() );
@@ -5,13 +5,18 @@
 #include "Engine/Render/Components/Component_StaticMesh.h"
 #include "Engine/Render/Mesh/SkeletalMesh.h"
 #include "System/Render/RenderDevice.h"
-#include "System/Math/AABBTree.h"
+#include "CullingBVH.h"
+#include "System/Math/QuadAABBTree.h"
 #include "System/Types/Event.h"
 #include "System/Systems.h"
 #include "System/Types/IDVector.h"
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Render
 {
     class SkeletalMeshComponent;
@@ -32,6 +37,13 @@ namespace EE::Render
 
         EE_ENTITY_WORLD_SYSTEM( RendererWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ), RequiresUpdate( UpdateStage::Paused ) );
 
+        // The spatial structure used to cull static mobility meshes
+        enum class StaticMeshCullingStructure : uint8_t
+        {
+            FlatBVH,        // Fully rebuilt whenever a static mesh changes, fastest to query
+            QuadTree,       // Incrementally updated, better suited to worlds where static meshes are frequently added or removed
+        };
+
         #if EE_DEVELOPMENT_TOOLS
         enum class VisualizationMode : int8_t
         {
@@ -46,8 +58,25 @@ namespace EE::Render
         };
         #endif
 
+        #if EE_DEVELOPMENT_TOOLS
+        struct CullingStats
+        {
+            uint32_t                                            m_numStaticMeshes = 0;
+            uint32_t                                            m_numStaticMeshTests = 0;
+            uint32_t                                            m_numVisibleStaticMeshes = 0;
+            uint32_t                                            m_numDynamicMeshes = 0;
+            uint32_t                                            m_numVisibleDynamicMeshes = 0;
+            uint32_t                                            m_numSkeletalMeshes = 0;
+            uint32_t                                            m_numVisibleSkeletalMeshes = 0;
+            float                                               m_cullTime = 0.0f;  // Milliseconds
+        };
+        #endif
+
     private:
 
+        // Meshes lists larger than this are culled in parallel
+        constexpr static uint32_t const s_minMeshesForParallelCulling = 256;
+
         // Track all instances of a given mesh together - to limit the number of vertex buffer changes
         struct SkeletalMeshGroup
         {
@@ -63,6 +92,12 @@ namespace EE::Render
 
     public:
 
+        // Culling
+        //-------------------------------------------------------------------------
+
+        void SetStaticMeshCullingStructure( StaticMeshCullingStructure structure );
+        inline StaticMeshCullingStructure GetStaticMeshCullingStructure() const { return m_staticMeshCullingStructure; }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -96,6 +131,15 @@ namespace EE::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // Culling
+        //-------------------------------------------------------------------------
+
+        void AddStaticMeshToCullingStructure( StaticMeshComponent* pMeshComponent );
+        void RemoveStaticMeshFromCullingStructure( StaticMeshComponent* pMeshComponent );
+        void UpdateStaticMeshInCullingStructure( StaticMeshComponent* pMeshComponent );
+        void RebuildStaticMeshCullingStructure();
+        void CullMeshes( Math::ViewVolume const& viewVolume );
+
     private:
 
         // Static meshes
@@ -108,12 +152,20 @@ namespace EE::Render
         Threading::Mutex                                                m_mobilityUpdateListLock;               // Mobility switches can occur on any thread so the list needs to be threadsafe. We use a simple lock for now since we dont expect too many switches
         TVector<StaticMeshComponent*>                                   m_mobilityUpdateList;                   // A list of all components that switched mobility during this frame, will results in an update of the various spatial data structures next frame
         TVector<StaticMeshComponent*>                                   m_staticMobilityTransformUpdateList;    // A list of all static mobility components that have moved during this frame, will results in an update of the various spatial data structures next frame
-        Math::AABBTree                                                  m_staticMobilityTree;
+        StaticMeshCullingStructure                                      m_staticMeshCullingStructure = StaticMeshCullingStructure::FlatBVH;
+        CullingBVH                                                      m_staticMeshBVH;
+        Math::QuadAABBTree                                              m_staticMeshQuadTree;
+        TVector<AABB>                                                   m_staticMeshCullingBuildBounds;
+        TVector<uint64_t>                                               m_staticMeshCullingBuildItems;
+        bool                                                            m_isStaticMeshCullingStructureDirty = false;   // Any pending rebuild will pick up all changes, so incremental updates are skipped while dirty
+        TVector<uint8_t>                                                m_dynamicMeshCullingResults;
 
         // Skeletal meshes
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
+        TVector<SkeletalMeshComponent*>                                 m_skeletalMeshCullingList;              // All skeletal meshes in mesh group order
+        TVector<uint8_t>                                                m_skeletalMeshCullingResults;
 
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
@@ -122,7 +174,10 @@ namespace EE::Render
         TIDVector<ComponentID, LocalEnvironmentMapComponent*>           m_registeredLocalEnvironmentMaps;
         TIDVector<ComponentID, GlobalEnvironmentMapComponent*>          m_registeredGlobalEnvironmentMaps;
 
+        TaskSystem*                                                     m_pTaskSystem = nullptr;
+
         #if EE_DEVELOPMENT_TOOLS
+        CullingStats                                                    m_cullingStats;
         VisualizationMode                                               m_visualizationMode = VisualizationMode::Lighting;
         bool                                                            m_showStaticMeshBounds = false;
         bool                                                            m_showSkeletalMeshBounds = false;
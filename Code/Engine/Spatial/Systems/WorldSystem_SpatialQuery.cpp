@@ -0,0 +1,497 @@
+#include "WorldSystem_SpatialQuery.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Math/Math.h"
+#include "System/Profiling.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    namespace
+    {
+        constexpr static int32_t const s_minQueriesPerTask = 16;
+
+        EE_FORCE_INLINE int32_t GetCellCoordinate( float value, float cellSize )
+        {
+            return (int32_t) Math::Floor( value / cellSize );
+        }
+
+        // Packs 21 bits per axis, which allows for over a million cells per axis
+        EE_FORCE_INLINE uint64_t GetCellKey( int32_t x, int32_t y, int32_t z )
+        {
+            return ( (uint64_t) ( x & 0x1FFFFF ) << 42 ) | ( (uint64_t) ( y & 0x1FFFFF ) << 21 ) | (uint64_t) ( z & 0x1FFFFF );
+        }
+
+        EE_FORCE_INLINE uint64_t GetCellKey( Vector const& position, float cellSize )
+        {
+            Float3 const p = position.ToFloat3();
+            return GetCellKey( GetCellCoordinate( p.m_x, cellSize ), GetCellCoordinate( p.m_y, cellSize ), GetCellCoordinate( p.m_z, cellSize ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct QueryTask final : public ITaskSet
+        {
+            QueryTask( SpatialQueryWorldSystem const* pSystem, TVector<SpatialQueryWorldSystem::Query>& queries )
+                : m_pSystem( pSystem )
+                , m_queries( queries )
+            {
+                m_SetSize = (uint32_t) queries.size();
+                m_MinRange = s_minQueriesPerTask;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ENTITY( "Spatial Query Task" );
+
+                for ( uint32_t i = range.start; i < range.end; ++i )
+                {
+                    m_pSystem->ExecuteQuery( m_queries[i] );
+                }
+            }
+
+        public:
+
+            SpatialQueryWorldSystem const*              m_pSystem = nullptr;
+            TVector<SpatialQueryWorldSystem::Query>&    m_queries;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+
+    SpatialQueryWorldSystem::Query SpatialQueryWorldSystem::Query::Radius( StringID category, Vector const& center, float radius )
+    {
+        EE_ASSERT( radius >= 0.0f );
+
+        Query query;
+        query.m_category = category;
+        query.m_type = QueryType::Radius;
+        query.m_center = center;
+        query.m_radius = radius;
+        return query;
+    }
+
+    SpatialQueryWorldSystem::Query SpatialQueryWorldSystem::Query::Box( StringID category, AABB const& box )
+    {
+        EE_ASSERT( box.IsValid() );
+
+        Query query;
+        query.m_category = category;
+        query.m_type = QueryType::Box;
+        query.m_center = box.GetCenter();
+        query.m_halfExtents = box.GetExtents();
+        return query;
+    }
+
+    SpatialQueryWorldSystem::Query SpatialQueryWorldSystem::Query::Nearest( StringID category, Vector const& position, int32_t maxResults, float maxRadius )
+    {
+        EE_ASSERT( maxResults > 0 && maxRadius >= 0.0f );
+
+        Query query;
+        query.m_category = category;
+        query.m_type = QueryType::Nearest;
+        query.m_center = position;
+        query.m_radius = maxRadius;
+        query.m_maxResults = maxResults;
+        return query;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SpatialQueryWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+    }
+
+    void SpatialQueryWorldSystem::ShutdownSystem()
+    {
+        #if EE_DEVELOPMENT_TOOLS
+        for ( auto const& category : m_categories )
+        {
+            EE_ASSERT( category.m_proxies.empty() );
+        }
+        #endif
+
+        EE_ASSERT( m_movedComponentQueue.size_approx() == 0 );
+        m_movedComponents.clear();
+        m_categories.clear();
+        m_pTaskSystem = nullptr;
+    }
+
+    void SpatialQueryWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent );
+        if ( pSpatialComponent == nullptr )
+        {
+            return;
+        }
+
+        StringID const categoryID = pSpatialComponent->GetSpatialQueryCategory();
+        if ( !categoryID.IsValid() )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        int32_t categoryIdx = FindCategoryIndex( categoryID );
+        if ( categoryIdx == InvalidIndex )
+        {
+            categoryIdx = (int32_t) m_categories.size();
+            m_categories.emplace_back( categoryID );
+        }
+
+        Category& category = m_categories[categoryIdx];
+        EE_ASSERT( category.m_proxyIndices.find( pSpatialComponent->GetID() ) == category.m_proxyIndices.end() );
+
+        int32_t const proxyIdx = (int32_t) category.m_proxies.size();
+        Proxy& proxy = category.m_proxies.emplace_back();
+        proxy.m_pComponent = pSpatialComponent;
+        proxy.m_position = pSpatialComponent->GetPosition();
+        proxy.m_radius = pSpatialComponent->GetWorldBounds().m_extents.GetLength3();
+        proxy.m_cellKey = GetCellKey( proxy.m_position, s_cellSize );
+
+        category.m_proxyIndices.insert( TPair<ComponentID, int32_t>( pSpatialComponent->GetID(), proxyIdx ) );
+        category.m_maxProxyRadius = Math::Max( category.m_maxProxyRadius, proxy.m_radius );
+        AddProxyToCell( category, proxyIdx );
+
+        pSpatialComponent->SetWorldTransformChangeQueue( &m_movedComponentQueue );
+    }
+
+    void SpatialQueryWorldSystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
+    {
+        auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent );
+        if ( pSpatialComponent == nullptr )
+        {
+            return;
+        }
+
+        StringID const categoryID = pSpatialComponent->GetSpatialQueryCategory();
+        if ( !categoryID.IsValid() )
+        {
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        // Remove any queued transform change, since the component might be destroyed before our next update
+        if ( pSpatialComponent->IsQueuedForWorldTransformChange() )
+        {
+            DequeueMovedComponents();
+            m_movedComponents.erase_first_unsorted( pSpatialComponent );
+        }
+
+        pSpatialComponent->SetWorldTransformChangeQueue( nullptr );
+
+        //-------------------------------------------------------------------------
+
+        int32_t const categoryIdx = FindCategoryIndex( categoryID );
+        EE_ASSERT( categoryIdx != InvalidIndex );
+        Category& category = m_categories[categoryIdx];
+
+        auto foundIter = category.m_proxyIndices.find( pSpatialComponent->GetID() );
+        EE_ASSERT( foundIter != category.m_proxyIndices.end() );
+        int32_t const proxyIdx = foundIter->second;
+        category.m_proxyIndices.erase( foundIter );
+        RemoveProxyFromCell( category, proxyIdx );
+
+        // Move the last proxy into the free slot
+        int32_t const lastProxyIdx = (int32_t) category.m_proxies.size() - 1;
+        if ( proxyIdx != lastProxyIdx )
+        {
+            RemoveProxyFromCell( category, lastProxyIdx );
+            category.m_proxies[proxyIdx] = category.m_proxies[lastProxyIdx];
+            category.m_proxyIndices[category.m_proxies[proxyIdx].m_pComponent->GetID()] = proxyIdx;
+            AddProxyToCell( category, proxyIdx );
+        }
+
+        category.m_proxies.pop_back();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SpatialQueryWorldSystem::AddProxyToCell( Category& category, int32_t proxyIdx )
+    {
+        category.m_cells[category.m_proxies[proxyIdx].m_cellKey].emplace_back( proxyIdx );
+    }
+
+    void SpatialQueryWorldSystem::RemoveProxyFromCell( Category& category, int32_t proxyIdx )
+    {
+        auto cellIter = category.m_cells.find( category.m_proxies[proxyIdx].m_cellKey );
+        EE_ASSERT( cellIter != category.m_cells.end() );
+
+        cellIter->second.erase_first_unsorted( proxyIdx );
+        if ( cellIter->second.empty() )
+        {
+            category.m_cells.erase( cellIter );
+        }
+    }
+
+    int32_t SpatialQueryWorldSystem::FindCategoryIndex( StringID categoryID ) const
+    {
+        return VectorFindIndex( m_categories, categoryID, [] ( Category const& category, StringID const& ID ) { return category.m_ID == ID; } );
+    }
+
+    SpatialQueryWorldSystem::Category const* SpatialQueryWorldSystem::FindCategory( StringID categoryID ) const
+    {
+        int32_t const categoryIdx = FindCategoryIndex( categoryID );
+        return ( categoryIdx != InvalidIndex ) ? &m_categories[categoryIdx] : nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool SpatialQueryWorldSystem::GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const
+    {
+        outAccess.ReadsComponent<SpatialEntityComponent>();
+        return true;
+    }
+
+    void SpatialQueryWorldSystem::DequeueMovedComponents()
+    {
+        size_t const numQueued = m_movedComponentQueue.size_approx();
+        if ( numQueued == 0 )
+        {
+            return;
+        }
+
+        size_t const numExisting = m_movedComponents.size();
+        m_movedComponents.resize( numExisting + numQueued );
+        size_t const numDequeued = m_movedComponentQueue.try_dequeue_bulk( m_movedComponents.data() + numExisting, numQueued );
+        m_movedComponents.resize( numExisting + numDequeued );
+    }
+
+    void SpatialQueryWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Spatial Query Update" );
+
+        // Only components whose world transform changed since the last update are queued
+        DequeueMovedComponents();
+
+        for ( auto pComponent : m_movedComponents )
+        {
+            pComponent->ClearQueuedForWorldTransformChange();
+
+            int32_t const categoryIdx = FindCategoryIndex( pComponent->GetSpatialQueryCategory() );
+            EE_ASSERT( categoryIdx != InvalidIndex );
+            Category& category = m_categories[categoryIdx];
+
+            auto foundIter = category.m_proxyIndices.find( pComponent->GetID() );
+            EE_ASSERT( foundIter != category.m_proxyIndices.end() );
+            int32_t const proxyIdx = foundIter->second;
+
+            Proxy& proxy = category.m_proxies[proxyIdx];
+            proxy.m_position = pComponent->GetPosition();
+            proxy.m_radius = pComponent->GetWorldBounds().m_extents.GetLength3();
+            category.m_maxProxyRadius = Math::Max( category.m_maxProxyRadius, proxy.m_radius );
+
+            // Only rehash if we changed cells
+            uint64_t const newCellKey = GetCellKey( proxy.m_position, s_cellSize );
+            if ( newCellKey != proxy.m_cellKey )
+            {
+                RemoveProxyFromCell( category, proxyIdx );
+                proxy.m_cellKey = newCellKey;
+                AddProxyToCell( category, proxyIdx );
+            }
+        }
+
+        m_movedComponents.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    template<typename Function>
+    void SpatialQueryWorldSystem::ForEachProxyInBox( Category const& category, Vector const& boxMin, Vector const& boxMax, Function&& function ) const
+    {
+        Vector const looseExtents( category.m_maxProxyRadius );
+        Float3 const min = ( boxMin - looseExtents ).ToFloat3();
+        Float3 const max = ( boxMax + looseExtents ).ToFloat3();
+
+        int32_t const minX = GetCellCoordinate( min.m_x, s_cellSize ), maxX = GetCellCoordinate( max.m_x, s_cellSize );
+        int32_t const minY = GetCellCoordinate( min.m_y, s_cellSize ), maxY = GetCellCoordinate( max.m_y, s_cellSize );
+        int32_t const minZ = GetCellCoordinate( min.m_z, s_cellSize ), maxZ = GetCellCoordinate( max.m_z, s_cellSize );
+
+        // For very large queries, it is cheaper to just visit all occupied cells
+        uint64_t const numCellsInBox = uint64_t( maxX - minX + 1 ) * uint64_t( maxY - minY + 1 ) * uint64_t( maxZ - minZ + 1 );
+        if ( numCellsInBox > category.m_cells.size() )
+        {
+            for ( auto const& cell : category.m_cells )
+            {
+                for ( auto proxyIdx : cell.second )
+                {
+                    function( category.m_proxies[proxyIdx] );
+                }
+            }
+
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( int32_t x = minX; x <= maxX; x++ )
+        {
+            for ( int32_t y = minY; y <= maxY; y++ )
+            {
+                for ( int32_t z = minZ; z <= maxZ; z++ )
+                {
+                    auto cellIter = category.m_cells.find( GetCellKey( x, y, z ) );
+                    if ( cellIter == category.m_cells.end() )
+                    {
+                        continue;
+                    }
+
+                    for ( auto proxyIdx : cellIter->second )
+                    {
+                        function( category.m_proxies[proxyIdx] );
+                    }
+                }
+            }
+        }
+    }
+
+    void SpatialQueryWorldSystem::FindInRadius( StringID categoryID, Vector const& center, float radius, Results& outResults ) const
+    {
+        outResults.clear();
+
+        Category const* pCategory = FindCategory( categoryID );
+        if ( pCategory == nullptr )
+        {
+            return;
+        }
+
+        Vector const queryExtents( radius );
+        ForEachProxyInBox( *pCategory, center - queryExtents, center + queryExtents, [&] ( Proxy const& proxy )
+        {
+            float const overlapDistance = radius + proxy.m_radius;
+            if ( proxy.m_position.GetDistanceSquared3( center ) <= ( overlapDistance * overlapDistance ) )
+            {
+                outResults.emplace_back( proxy.m_pComponent );
+            }
+        } );
+    }
+
+    void SpatialQueryWorldSystem::FindInBox( StringID categoryID, AABB const& box, Results& outResults ) const
+    {
+        outResults.clear();
+
+        Category const* pCategory = FindCategory( categoryID );
+        if ( pCategory == nullptr )
+        {
+            return;
+        }
+
+        Vector const boxMin = box.GetMin();
+        Vector const boxMax = box.GetMax();
+        ForEachProxyInBox( *pCategory, boxMin, boxMax, [&] ( Proxy const& proxy )
+        {
+            Vector const closestPoint = Vector::Min( Vector::Max( proxy.m_position, boxMin ), boxMax );
+            if ( closestPoint.GetDistanceSquared3( proxy.m_position ) <= ( proxy.m_radius * proxy.m_radius ) )
+            {
+                outResults.emplace_back( proxy.m_pComponent );
+            }
+        } );
+    }
+
+    void SpatialQueryWorldSystem::FindNearest( StringID categoryID, Vector const& position, int32_t maxResults, float maxRadius, Results& outResults ) const
+    {
+        EE_ASSERT( maxResults > 0 );
+        outResults.clear();
+
+        Category const* pCategory = FindCategory( categoryID );
+        if ( pCategory == nullptr )
+        {
+            return;
+        }
+
+        // Grow the search radius until we have enough candidates, once we have N candidates within a radius the N closest are guaranteed to be among them
+        struct Candidate
+        {
+            inline bool operator<( Candidate const& rhs ) const { return m_distanceSquared < rhs.m_distanceSquared; }
+
+            float                       m_distanceSquared;
+            SpatialEntityComponent*     m_pComponent;
+        };
+
+        TInlineVector<Candidate, 16> candidates;
+        float searchRadius = Math::Min( s_cellSize, maxRadius );
+        while ( true )
+        {
+            candidates.clear();
+
+            float const searchRadiusSquared = searchRadius * searchRadius;
+            Vector const searchExtents( searchRadius );
+            ForEachProxyInBox( *pCategory, position - searchExtents, position + searchExtents, [&] ( Proxy const& proxy )
+            {
+                float const distanceSquared = proxy.m_position.GetDistanceSquared3( position );
+                if ( distanceSquared <= searchRadiusSquared )
+                {
+                    candidates.push_back( { distanceSquared, proxy.m_pComponent } );
+                }
+            } );
+
+            if ( candidates.size() >= maxResults || searchRadius >= maxRadius )
+            {
+                break;
+            }
+
+            searchRadius = Math::Min( searchRadius * 2, maxRadius );
+        }
+
+        //-------------------------------------------------------------------------
+
+        eastl::sort( candidates.begin(), candidates.end() );
+
+        int32_t const numResults = Math::Min( maxResults, (int32_t) candidates.size() );
+        for ( int32_t i = 0; i < numResults; i++ )
+        {
+            outResults.emplace_back( candidates[i].m_pComponent );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void SpatialQueryWorldSystem::ExecuteQuery( Query& query ) const
+    {
+        switch ( query.m_type )
+        {
+            case QueryType::Radius:
+            {
+                FindInRadius( query.m_category, query.m_center, query.m_radius, query.m_results );
+            }
+            break;
+
+            case QueryType::Box:
+            {
+                FindInBox( query.m_category, AABB( query.m_center, query.m_halfExtents ), query.m_results );
+            }
+            break;
+
+            case QueryType::Nearest:
+            {
+                FindNearest( query.m_category, query.m_center, query.m_maxResults, query.m_radius, query.m_results );
+            }
+            break;
+        }
+    }
+
+    void SpatialQueryWorldSystem::ExecuteQueries( TVector<Query>& queries ) const
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Spatial Queries" );
+
+        if ( queries.size() <= s_minQueriesPerTask )
+        {
+            for ( auto& query : queries )
+            {
+                ExecuteQuery( query );
+            }
+        }
+        else
+        {
+            QueryTask queryTask( this, queries );
+            m_pTaskSystem->ScheduleTask( &queryTask );
+            m_pTaskSystem->WaitForTask( &queryTask );
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Entity/EntitySpatialComponent.h"
+#include "System/Math/BoundingVolumes.h"
+#include "System/Types/HashMap.h"
+#include "System/Types/StringID.h"
+
+//-------------------------------------------------------------------------
+// Spatial Query World System
+//-------------------------------------------------------------------------
+// Tracks all spatial components that return a valid spatial query category in a loose spatial hash (one per category)
+//
+// * Each component is stored as a bounding sphere in the cell containing its center
+// * Queries expand the searched cells by the largest registered radius in the category, so large components are always found
+// * Components add themselves to a queue whenever their world transform changes, only those proxies are updated (no polling of all proxies)
+// * Proxies are only rehashed when the component moved to a different cell
+//
+// This allows game systems (interactions, cover, perception, etc...) to find nearby components without scanning all of them
+
+namespace EE
+{
+    class TaskSystem;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API SpatialQueryWorldSystem final : public IEntityWorldSystem
+    {
+        constexpr static float const s_cellSize = 4.0f;
+
+    public:
+
+        using Results = TInlineVector<SpatialEntityComponent*, 8>;
+
+        enum class QueryType : uint8_t
+        {
+            Radius,
+            Box,
+            Nearest,
+        };
+
+        // A single query for batched execution, the results are filled in by 'ExecuteQueries'
+        struct Query
+        {
+            static Query Radius( StringID category, Vector const& center, float radius );
+            static Query Box( StringID category, AABB const& box );
+            static Query Nearest( StringID category, Vector const& position, int32_t maxResults, float maxRadius );
+
+        public:
+
+            StringID                                    m_category;
+            Vector                                      m_center = Vector::Zero;
+            Vector                                      m_halfExtents = Vector::Zero;   // Box queries only
+            float                                       m_radius = 0.0f;                // Search radius for radius and nearest queries
+            int32_t                                     m_maxResults = 0;               // Nearest queries only
+            QueryType                                   m_type = QueryType::Radius;
+            Results                                     m_results;
+        };
+
+    private:
+
+        struct Proxy
+        {
+            SpatialEntityComponent*                     m_pComponent = nullptr;
+            Vector                                      m_position = Vector::Zero;
+            float                                       m_radius = 0.0f;
+            uint64_t                                    m_cellKey = 0;
+        };
+
+        struct Category
+        {
+            Category( StringID ID ) : m_ID( ID ) {}
+
+        public:
+
+            StringID                                    m_ID;
+            TVector<Proxy>                              m_proxies;
+            THashMap<ComponentID, int32_t>              m_proxyIndices;
+            THashMap<uint64_t, TInlineVector<int32_t, 4>> m_cells;
+            float                                       m_maxProxyRadius = 0.0f;       // Only ever grows, used to expand the searched cells
+        };
+
+    public:
+
+        EE_ENTITY_WORLD_SYSTEM( SpatialQueryWorldSystem, RequiresUpdate( UpdateStage::PrePhysics, UpdatePriority::Highest ), RequiresUpdate( UpdateStage::PostPhysics, UpdatePriority::Highest ) );
+
+        // Find all components in the category overlapping the specified sphere
+        void FindInRadius( StringID category, Vector const& center, float radius, Results& outResults ) const;
+
+        // Find all components in the category overlapping the specified box
+        void FindInBox( StringID category, AABB const& box, Results& outResults ) const;
+
+        // Find the closest N components (by center) within the max radius, results are sorted by distance
+        void FindNearest( StringID category, Vector const& position, int32_t maxResults, float maxRadius, Results& outResults ) const;
+
+        // Execute a set of queries in parallel, this needs to be called from a system update or the main thread
+        void ExecuteQueries( TVector<Query>& queries ) const;
+
+        // Execute a single query
+        void ExecuteQuery( Query& query ) const;
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline int32_t GetNumCategories() const { return (int32_t) m_categories.size(); }
+        #endif
+
+    private:
+
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
+        virtual void ShutdownSystem() override final;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const override;
+
+        int32_t FindCategoryIndex( StringID categoryID ) const;
+        Category const* FindCategory( StringID categoryID ) const;
+
+        // Drain the transform change queue into the moved component list
+        void DequeueMovedComponents();
+
+        void AddProxyToCell( Category& category, int32_t proxyIdx );
+        void RemoveProxyFromCell( Category& category, int32_t proxyIdx );
+
+        // Call the function for each proxy in all cells touched by the box, the box is expanded by the category's max proxy radius
+        template<typename Function>
+        void ForEachProxyInBox( Category const& category, Vector const& boxMin, Vector const& boxMax, Function&& function ) const;
+
+    private:
+
+        TaskSystem*                                     m_pTaskSystem = nullptr;
+        TInlineVector<Category, 4>                      m_categories;
+        SpatialEntityComponent::WorldTransformChangeQueue m_movedComponentQueue;
+        TVector<SpatialEntityComponent*>                m_movedComponents;
+    };
+}
@@ -2,6 +2,7 @@
 #include "Engine/Entity/EntityLog.h"
 #include "Engine/Navmesh/NavPower.h"
 #include "Engine/Physics/Physics.h"
+#include "System/Resource/ResourceProviders/ArchiveResourceProvider.h"
 #include "System/Resource/ResourceProviders/NetworkResourceProvider.h"
 #include "System/Resource/ResourceProviders/PackagedResourceProvider.h"
 #include "System/Network/NetworkSystem.h"
@@ -112,7 +113,15 @@ namespace EE
         }
         #else
         {
-            m_pResourceProvider = EE::New<Resource::PackagedResourceProvider>( settings );
+            // Prefer the packed archive if one was built, otherwise fall back to the loose compiled resource files
+            if ( FileSystem::Exists( Resource::ArchiveResourceProvider::GetArchivePath( settings ) ) )
+            {
+                m_pResourceProvider = EE::New<Resource::ArchiveResourceProvider>( settings );
+            }
+            else
+            {
+                m_pResourceProvider = EE::New<Resource::PackagedResourceProvider>( settings );
+            }
         }
         #endif
 
@@ -97,6 +97,9 @@ namespace EE::Animation
             return Error( "Failed to read skeleton file: %s", skeletonFilePath.ToString().c_str() );
         }
 
+        // Match the skeleton's LOD bone order so that the tracks line up with the compiled skeleton bones
+        pRawSkeleton->ApplyLODs( skeletonResourceDescriptor.GetExcludedBonesPerLOD() );
+
         // Read animation data
         //-------------------------------------------------------------------------
 
@@ -149,7 +152,7 @@ namespace EE::Animation
         AnimationClip animData;
         animData.m_skeleton = resourceDescriptor.m_skeleton;
 
-        TransferAndCompressAnimationData( *pRawAnimation, animData, resourceDescriptor.m_limitFrameRange );
+        TransferAndCompressAnimationData( *pRawAnimation, animData, resourceDescriptor );
 
         // Handle events
         //-------------------------------------------------------------------------
@@ -264,8 +267,9 @@ namespace EE::Animation
         return true;
     }
 
-    void AnimationClipCompiler::TransferAndCompressAnimationData( RawAssets::RawAnimation const& rawAnimData, AnimationClip& animClip, IntRange const& limitRange ) const
+    void AnimationClipCompiler::TransferAndCompressAnimationData( RawAssets::RawAnimation const& rawAnimData, AnimationClip& animClip, AnimationClipResourceDescriptor const& resourceDescriptor ) const
     {
+        IntRange const& limitRange = resourceDescriptor.m_limitFrameRange;
         auto const& rawTrackData = rawAnimData.GetTrackData();
         uint32_t const numBones = rawAnimData.GetNumBones();
         int32_t const numOriginalFrames = rawAnimData.GetNumFrames();
@@ -337,6 +341,16 @@ namespace EE::Animation
         // Compress raw data
         //-------------------------------------------------------------------------
 
+        if ( resourceDescriptor.m_compression == AnimationClipCompression::KeyReduced )
+        {
+            if ( CompressKeyReducedAnimationData( rawAnimData, animClip, frameIdxStart, frameIdxEnd, resourceDescriptor.m_compressionErrorTolerance ) )
+            {
+                return;
+            }
+        }
+
+        animClip.m_compressionFormat = AnimationClip::CompressionFormat::Uniform;
+
         static constexpr float const defaultQuantizationRangeLength = 0.1f;
 
         for ( uint32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
@@ -468,6 +482,577 @@ namespace EE::Animation
         }
     }
 
+    //-------------------------------------------------------------------------
+    // Key Reduction
+    //-------------------------------------------------------------------------
+
+    namespace KeyReduction
+    {
+        // The distance from a bone to its virtual vertices, approximates the distance to the skinned vertices
+        static constexpr float const g_virtualVertexDistance = 0.03f;
+        static constexpr uint32_t const g_minBitRate = 6;
+        static constexpr uint32_t const g_maxBitRate = 16;
+        static constexpr int32_t const g_maxValidationIterations = 8;
+
+        // Quantized values are stored as [largest component index][a][b][c] for rotations, [x][y][z] for translations and [s] for scale
+        struct QuantizedValue
+        {
+            uint32_t m_values[4] = { 0, 0, 0, 0 };
+        };
+
+        struct ComponentData
+        {
+            TVector<uint16_t>           m_keyFrames;
+            TVector<QuantizedValue>     m_keyValues;
+            uint32_t                    m_numBits = g_maxBitRate;
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Must match 'AnimationClip::DequantizeFloat'
+        static uint32_t QuantizeFloat( float value, uint32_t numBits, float rangeStart, float rangeLength )
+        {
+            uint32_t const maxValue = ( 1u << numBits ) - 1;
+            float const normalizedValue = Math::Clamp( ( value - rangeStart ) / rangeLength, 0.0f, 1.0f );
+            return (uint32_t) Math::Min( (uint32_t) Math::Round( normalizedValue * maxValue ), maxValue );
+        }
+
+        static float DequantizeFloat( uint32_t quantizedValue, uint32_t numBits, float rangeStart, float rangeLength )
+        {
+            return rangeStart + ( float( quantizedValue ) * ( rangeLength / float( ( 1u << numBits ) - 1 ) ) );
+        }
+
+        // Quantize a value range, ranges are always set to a valid length so static values have a valid encoding
+        static QuantizationRange CreateQuantizationRange( FloatRange const& valueRange )
+        {
+            static constexpr float const defaultQuantizationRangeLength = 0.1f;
+            float const rangeLength = valueRange.GetLength();
+            return { valueRange.m_begin, Math::IsNearZero( rangeLength ) ? defaultQuantizationRangeLength : rangeLength };
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct RotationCodec
+        {
+            using ValueType = Quaternion;
+            constexpr static uint32_t const s_minBitRate = 8;
+
+            QuantizedValue Encode( Quaternion const& rotation, uint32_t numBits ) const
+            {
+                Float4 const rotationValues = rotation.ToFloat4();
+                float const components[4] = { rotationValues.m_x, rotationValues.m_y, rotationValues.m_z, rotationValues.m_w };
+
+                uint32_t largestComponentIdx = 0;
+                for ( uint32_t i = 1; i < 4; i++ )
+                {
+                    if ( Math::Abs( components[i] ) > Math::Abs( components[largestComponentIdx] ) )
+                    {
+                        largestComponentIdx = i;
+                    }
+                }
+
+                // q and -q are the same rotation, so ensure the reconstructed component is always positive
+                float const sign = components[largestComponentIdx] < 0.0f ? -1.0f : 1.0f;
+
+                QuantizedValue encoded;
+                encoded.m_values[0] = largestComponentIdx;
+                for ( uint32_t i = 0, valueIdx = 1; i < 4; i++ )
+                {
+                    if ( i != largestComponentIdx )
+                    {
+                        encoded.m_values[valueIdx++] = QuantizeFloat( components[i] * sign, numBits, AnimationClip::s_keyReducedRotationRangeStart, AnimationClip::s_keyReducedRotationRangeLength );
+                    }
+                }
+                return encoded;
+            }
+
+            Quaternion Decode( QuantizedValue const& encoded, uint32_t numBits ) const
+            {
+                float const a = DequantizeFloat( encoded.m_values[1], numBits, AnimationClip::s_keyReducedRotationRangeStart, AnimationClip::s_keyReducedRotationRangeLength );
+                float const b = DequantizeFloat( encoded.m_values[2], numBits, AnimationClip::s_keyReducedRotationRangeStart, AnimationClip::s_keyReducedRotationRangeLength );
+                float const c = DequantizeFloat( encoded.m_values[3], numBits, AnimationClip::s_keyReducedRotationRangeStart, AnimationClip::s_keyReducedRotationRangeLength );
+                float const d = Math::Sqrt( Math::Max( 1.0f - ( a * a ) - ( b * b ) - ( c * c ), 0.0f ) );
+
+                switch ( encoded.m_values[0] )
+                {
+                    case 0: return Quaternion( d, a, b, c );
+                    case 1: return Quaternion( a, d, b, c );
+                    case 2: return Quaternion( a, b, d, c );
+                    default: return Quaternion( a, b, c, d );
+                }
+            }
+
+            Quaternion Interpolate( Quaternion const& from, Quaternion const& to, float t ) const { return Quaternion::NLerp( from, to, t ); }
+
+            // Angle between the two rotations (in radians)
+            float GetError( Quaternion const& a, Quaternion const& b ) const
+            {
+                float const dot = Math::Min( Math::Abs( Quaternion::Dot( a, b ).GetX() ), 1.0f );
+                return 2.0f * Math::ACos( dot );
+            }
+        };
+
+        struct TranslationCodec
+        {
+            using ValueType = Vector;
+            constexpr static uint32_t const s_minBitRate = g_minBitRate;
+
+            KeyReducedTrackSettings const& m_settings;
+
+            QuantizedValue Encode( Vector const& translation, uint32_t numBits ) const
+            {
+                QuantizedValue encoded;
+                encoded.m_values[0] = QuantizeFloat( translation.GetX(), numBits, m_settings.m_translationRangeX.m_rangeStart, m_settings.m_translationRangeX.m_rangeLength );
+                encoded.m_values[1] = QuantizeFloat( translation.GetY(), numBits, m_settings.m_translationRangeY.m_rangeStart, m_settings.m_translationRangeY.m_rangeLength );
+                encoded.m_values[2] = QuantizeFloat( translation.GetZ(), numBits, m_settings.m_translationRangeZ.m_rangeStart, m_settings.m_translationRangeZ.m_rangeLength );
+                return encoded;
+            }
+
+            Vector Decode( QuantizedValue const& encoded, uint32_t numBits ) const
+            {
+                float const x = DequantizeFloat( encoded.m_values[0], numBits, m_settings.m_translationRangeX.m_rangeStart, m_settings.m_translationRangeX.m_rangeLength );
+                float const y = DequantizeFloat( encoded.m_values[1], numBits, m_settings.m_translationRangeY.m_rangeStart, m_settings.m_translationRangeY.m_rangeLength );
+                float const z = DequantizeFloat( encoded.m_values[2], numBits, m_settings.m_translationRangeZ.m_rangeStart, m_settings.m_translationRangeZ.m_rangeLength );
+                return Vector( x, y, z );
+            }
+
+            Vector Interpolate( Vector const& from, Vector const& to, float t ) const { return Vector::Lerp( from, to, t ); }
+
+            float GetError( Vector const& a, Vector const& b ) const { return a.GetDistance3( b ); }
+        };
+
+        struct ScaleCodec
+        {
+            using ValueType = float;
+            constexpr static uint32_t const s_minBitRate = g_minBitRate;
+
+            KeyReducedTrackSettings const& m_settings;
+
+            QuantizedValue Encode( float scale, uint32_t numBits ) const
+            {
+                QuantizedValue encoded;
+                encoded.m_values[0] = QuantizeFloat( scale, numBits, m_settings.m_scaleRange.m_rangeStart, m_settings.m_scaleRange.m_rangeLength );
+                return encoded;
+            }
+
+            float Decode( QuantizedValue const& encoded, uint32_t numBits ) const
+            {
+                return DequantizeFloat( encoded.m_values[0], numBits, m_settings.m_scaleRange.m_rangeStart, m_settings.m_scaleRange.m_rangeLength );
+            }
+
+            float Interpolate( float from, float to, float t ) const { return Math::Lerp( from, to, t ); }
+
+            float GetError( float a, float b ) const { return Math::Abs( a - b ); }
+        };
+
+        //-------------------------------------------------------------------------
+
+        // Find the lowest bit rate whose quantization error leaves at least half of the tolerance for the key reduction
+        template<typename Codec>
+        static uint32_t SelectBitRate( Codec const& codec, TVector<typename Codec::ValueType> const& rawValues, float tolerance )
+        {
+            for ( uint32_t numBits = Codec::s_minBitRate; numBits < g_maxBitRate; numBits++ )
+            {
+                float maxError = 0.0f;
+                for ( auto const& rawValue : rawValues )
+                {
+                    maxError = Math::Max( maxError, codec.GetError( codec.Decode( codec.Encode( rawValue, numBits ), numBits ), rawValue ) );
+                }
+
+                if ( maxError <= tolerance * 0.5f )
+                {
+                    return numBits;
+                }
+            }
+
+            return g_maxBitRate;
+        }
+
+        // Remove all key-frames that can be reconstructed within the tolerance by interpolating the quantized surrounding keys
+        // This is a top-down reduction: we start with the first and last frames and keep splitting at the worst frame until the error is within the tolerance
+        template<typename Codec>
+        static void CompressComponent( Codec const& codec, TVector<typename Codec::ValueType> const& rawValues, float tolerance, ComponentData& outData )
+        {
+            int32_t const numFrames = (int32_t) rawValues.size();
+            EE_ASSERT( numFrames > 0 );
+
+            outData.m_keyFrames.clear();
+            outData.m_keyValues.clear();
+            outData.m_numBits = SelectBitRate( codec, rawValues, tolerance );
+
+            TVector<QuantizedValue> encodedValues;
+            TVector<typename Codec::ValueType> decodedValues;
+            encodedValues.reserve( numFrames );
+            decodedValues.reserve( numFrames );
+            for ( auto const& rawValue : rawValues )
+            {
+                encodedValues.emplace_back( codec.Encode( rawValue, outData.m_numBits ) );
+                decodedValues.emplace_back( codec.Decode( encodedValues.back(), outData.m_numBits ) );
+            }
+
+            // Check if the component is static
+            //-------------------------------------------------------------------------
+
+            bool isStatic = true;
+            for ( int32_t frameIdx = 1; frameIdx < numFrames; frameIdx++ )
+            {
+                if ( codec.GetError( decodedValues[0], rawValues[frameIdx] ) > tolerance )
+                {
+                    isStatic = false;
+                    break;
+                }
+            }
+
+            if ( isStatic )
+            {
+                outData.m_keyFrames.emplace_back( uint16_t( 0 ) );
+                outData.m_keyValues.emplace_back( encodedValues[0] );
+                return;
+            }
+
+            // Split segments until all frames are within the tolerance
+            //-------------------------------------------------------------------------
+
+            TVector<bool> isKeyFrame;
+            isKeyFrame.resize( numFrames, false );
+            isKeyFrame[0] = isKeyFrame[numFrames - 1] = true;
+
+            TInlineVector<IntRange, 32> segmentsToProcess;
+            segmentsToProcess.emplace_back( IntRange( 0, numFrames - 1 ) );
+            while ( !segmentsToProcess.empty() )
+            {
+                IntRange const segment = segmentsToProcess.back();
+                segmentsToProcess.pop_back();
+
+                float const segmentLength = float( segment.m_end - segment.m_begin );
+                float worstError = tolerance;
+                int32_t worstFrameIdx = InvalidIndex;
+                for ( int32_t frameIdx = segment.m_begin + 1; frameIdx < segment.m_end; frameIdx++ )
+                {
+                    float const t = float( frameIdx - segment.m_begin ) / segmentLength;
+                    float const error = codec.GetError( codec.Interpolate( decodedValues[segment.m_begin], decodedValues[segment.m_end], t ), rawValues[frameIdx] );
+                    if ( error > worstError )
+                    {
+                        worstError = error;
+                        worstFrameIdx = frameIdx;
+                    }
+                }
+
+                if ( worstFrameIdx != InvalidIndex )
+                {
+                    isKeyFrame[worstFrameIdx] = true;
+                    segmentsToProcess.emplace_back( IntRange( segment.m_begin, worstFrameIdx ) );
+                    segmentsToProcess.emplace_back( IntRange( worstFrameIdx, segment.m_end ) );
+                }
+            }
+
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                if ( isKeyFrame[frameIdx] )
+                {
+                    outData.m_keyFrames.emplace_back( uint16_t( frameIdx ) );
+                    outData.m_keyValues.emplace_back( encodedValues[frameIdx] );
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        static void WriteBits( TVector<uint32_t>& data, uint32_t& bitOffset, uint32_t value, uint32_t numBits )
+        {
+            EE_ASSERT( numBits > 0 && numBits <= 32 && ( numBits == 32 || value < ( 1u << numBits ) ) );
+
+            // Data is always padded with an extra word, see 'AnimationClip::ReadBits'
+            uint32_t const requiredWords = ( ( bitOffset + numBits + 31 ) >> 5 ) + 1;
+            if ( data.size() < requiredWords )
+            {
+                data.resize( requiredWords, 0 );
+            }
+
+            uint32_t const wordIdx = bitOffset >> 5;
+            uint64_t const shiftedValue = uint64_t( value ) << ( bitOffset & 31 );
+            data[wordIdx] |= uint32_t( shiftedValue );
+            data[wordIdx + 1] |= uint32_t( shiftedValue >> 32 );
+            bitOffset += numBits;
+        }
+
+        static void WriteComponent( ComponentData const& componentData, uint32_t numValuesPerKey, bool hasComponentIndex, TVector<uint16_t>& keyFrameTimes, TVector<uint32_t>& data, uint32_t& bitOffset, KeyReducedComponentSettings& outSettings )
+        {
+            outSettings.m_firstKeyIdx = (uint32_t) keyFrameTimes.size();
+            outSettings.m_dataBitOffset = bitOffset;
+            outSettings.m_numKeys = (uint16_t) componentData.m_keyFrames.size();
+            outSettings.m_numBits = (uint8_t) componentData.m_numBits;
+
+            keyFrameTimes.insert( keyFrameTimes.end(), componentData.m_keyFrames.begin(), componentData.m_keyFrames.end() );
+
+            for ( QuantizedValue const& keyValue : componentData.m_keyValues )
+            {
+                uint32_t valueIdx = 0;
+                if ( hasComponentIndex )
+                {
+                    WriteBits( data, bitOffset, keyValue.m_values[valueIdx++], 2 );
+                }
+
+                for ( uint32_t i = 0; i < numValuesPerKey; i++ )
+                {
+                    WriteBits( data, bitOffset, keyValue.m_values[valueIdx++], componentData.m_numBits );
+                }
+            }
+        }
+
+        // Get the max error of any virtual vertex between two model space bone transforms
+        static float GetObjectSpaceError( Transform const& reference, Transform const& actual )
+        {
+            static Vector const virtualVertices[4] = { Vector::Zero, Vector( g_virtualVertexDistance, 0, 0 ), Vector( 0, g_virtualVertexDistance, 0 ), Vector( 0, 0, g_virtualVertexDistance ) };
+
+            float maxError = 0.0f;
+            for ( Vector const& virtualVertex : virtualVertices )
+            {
+                maxError = Math::Max( maxError, reference.TransformPoint( virtualVertex ).GetDistance3( actual.TransformPoint( virtualVertex ) ) );
+            }
+            return maxError;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool AnimationClipCompiler::CompressKeyReducedAnimationData( RawAssets::RawAnimation const& rawAnimData, AnimationClip& animClip, int32_t frameIdxStart, int32_t frameIdxEnd, float errorTolerance ) const
+    {
+        using namespace KeyReduction;
+
+        auto const& rawTrackData = rawAnimData.GetTrackData();
+        RawAssets::RawSkeleton const& rawSkeleton = rawAnimData.GetSkeleton();
+        int32_t const numBones = (int32_t) rawAnimData.GetNumBones();
+        int32_t const numFrames = frameIdxEnd - frameIdxStart;
+
+        if ( numFrames > UINT16_MAX )
+        {
+            Warning( "Animation has too many frames for key reduced compression, falling back to uniform compression!" );
+            return false;
+        }
+
+        if ( errorTolerance <= 0.0f )
+        {
+            Warning( "Invalid compression error tolerance (%f), falling back to uniform compression!", errorTolerance );
+            return false;
+        }
+
+        // Calculate reference model space transforms
+        //-------------------------------------------------------------------------
+        // Bones are always sorted so that parents come before their children
+
+        auto CalculateModelSpaceTransforms = [&] ( TVector<Transform> const& localTransforms, TVector<Transform>& outModelSpaceTransforms )
+        {
+            outModelSpaceTransforms.resize( numFrames * numBones );
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                int32_t const frameOffset = frameIdx * numBones;
+                for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+                {
+                    int32_t const parentBoneIdx = rawSkeleton.GetParentBoneIndex( boneIdx );
+                    Transform const& localTransform = localTransforms[frameOffset + boneIdx];
+                    outModelSpaceTransforms[frameOffset + boneIdx] = ( parentBoneIdx == InvalidIndex ) ? localTransform : localTransform * outModelSpaceTransforms[frameOffset + parentBoneIdx];
+                }
+            }
+        };
+
+        TVector<Transform> rawLocalTransforms;
+        rawLocalTransforms.resize( numFrames * numBones );
+        for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+        {
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                rawLocalTransforms[frameIdx * numBones + boneIdx] = rawTrackData[boneIdx].m_localTransforms[frameIdxStart + frameIdx];
+            }
+        }
+
+        TVector<Transform> rawModelSpaceTransforms;
+        CalculateModelSpaceTransforms( rawLocalTransforms, rawModelSpaceTransforms );
+
+        // Calculate how far each bone's error reaches, i.e. the max distance to any of its descendants' virtual vertices
+        //-------------------------------------------------------------------------
+        // A rotation error of 'a' radians on a bone moves a vertex at distance 'd' by roughly 'a * d'
+
+        TVector<float> boneReach;
+        boneReach.resize( numBones, g_virtualVertexDistance );
+        for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+        {
+            int32_t const frameOffset = frameIdx * numBones;
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                Vector const bonePosition = rawModelSpaceTransforms[frameOffset + boneIdx].GetTranslation();
+                int32_t ancestorIdx = rawSkeleton.GetParentBoneIndex( boneIdx );
+                while ( ancestorIdx != InvalidIndex )
+                {
+                    float const distance = bonePosition.GetDistance3( rawModelSpaceTransforms[frameOffset + ancestorIdx].GetTranslation() ) + g_virtualVertexDistance;
+                    boneReach[ancestorIdx] = Math::Max( boneReach[ancestorIdx], distance );
+                    ancestorIdx = rawSkeleton.GetParentBoneIndex( ancestorIdx );
+                }
+            }
+        }
+
+        // Set up the per-track quantization ranges
+        //-------------------------------------------------------------------------
+
+        TVector<KeyReducedTrackSettings> trackSettings;
+        trackSettings.resize( numBones );
+
+        TVector<TVector<Quaternion>> rawRotations;
+        TVector<TVector<Vector>> rawTranslations;
+        TVector<TVector<float>> rawScales;
+        rawRotations.resize( numBones );
+        rawTranslations.resize( numBones );
+        rawScales.resize( numBones );
+
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            FloatRange translationRangeX, translationRangeY, translationRangeZ, scaleRange;
+            for ( int32_t frameIdx = frameIdxStart; frameIdx < frameIdxEnd; frameIdx++ )
+            {
+                Transform const& rawBoneTransform = rawTrackData[boneIdx].m_localTransforms[frameIdx];
+                Vector const translation = rawBoneTransform.GetTranslation();
+                rawRotations[boneIdx].emplace_back( rawBoneTransform.GetRotation() );
+                rawTranslations[boneIdx].emplace_back( translation );
+                rawScales[boneIdx].emplace_back( rawBoneTransform.GetScale() );
+
+                translationRangeX.GrowRange( translation.GetX() );
+                translationRangeY.GrowRange( translation.GetY() );
+                translationRangeZ.GrowRange( translation.GetZ() );
+                scaleRange.GrowRange( rawBoneTransform.GetScale() );
+            }
+
+            trackSettings[boneIdx].m_translationRangeX = CreateQuantizationRange( translationRangeX );
+            trackSettings[boneIdx].m_translationRangeY = CreateQuantizationRange( translationRangeY );
+            trackSettings[boneIdx].m_translationRangeZ = CreateQuantizationRange( translationRangeZ );
+            trackSettings[boneIdx].m_scaleRange = CreateQuantizationRange( scaleRange );
+        }
+
+        // Compress and validate
+        //-------------------------------------------------------------------------
+        // Errors accumulate down the hierarchy so we start each bone with half the tolerance and tighten the bones that exceed it until the whole pose is within the tolerance
+
+        TVector<float> boneTolerances;
+        boneTolerances.resize( numBones, errorTolerance * 0.5f );
+
+        TVector<ComponentData> rotationData, translationData, scaleData;
+        rotationData.resize( numBones );
+        translationData.resize( numBones );
+        scaleData.resize( numBones );
+
+        TVector<bool> needsRecompression;
+        needsRecompression.resize( numBones, true );
+
+        TVector<Transform> decodedLocalTransforms;
+        TVector<Transform> decodedModelSpaceTransforms;
+        TVector<float> boneErrors;
+        decodedLocalTransforms.resize( numFrames * numBones );
+        boneErrors.resize( numBones );
+
+        float maxError = 0.0f;
+        for ( int32_t iteration = 0; iteration < g_maxValidationIterations; iteration++ )
+        {
+            // Compress all tracks that need it
+            //-------------------------------------------------------------------------
+
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                if ( !needsRecompression[boneIdx] )
+                {
+                    continue;
+                }
+
+                float const boneTolerance = boneTolerances[boneIdx];
+                CompressComponent( RotationCodec(), rawRotations[boneIdx], boneTolerance / boneReach[boneIdx], rotationData[boneIdx] );
+                CompressComponent( TranslationCodec{ trackSettings[boneIdx] }, rawTranslations[boneIdx], boneTolerance, translationData[boneIdx] );
+                CompressComponent( ScaleCodec{ trackSettings[boneIdx] }, rawScales[boneIdx], boneTolerance / boneReach[boneIdx], scaleData[boneIdx] );
+                needsRecompression[boneIdx] = false;
+            }
+
+            // Pack the data
+            //-------------------------------------------------------------------------
+
+            animClip.m_keyReducedData.clear();
+            animClip.m_keyFrameTimes.clear();
+
+            uint32_t bitOffset = 0;
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                WriteComponent( rotationData[boneIdx], 3, true, animClip.m_keyFrameTimes, animClip.m_keyReducedData, bitOffset, trackSettings[boneIdx].m_rotation );
+                WriteComponent( translationData[boneIdx], 3, false, animClip.m_keyFrameTimes, animClip.m_keyReducedData, bitOffset, trackSettings[boneIdx].m_translation );
+                WriteComponent( scaleData[boneIdx], 1, false, animClip.m_keyFrameTimes, animClip.m_keyReducedData, bitOffset, trackSettings[boneIdx].m_scale );
+            }
+
+            animClip.m_keyReducedTrackSettings = trackSettings;
+
+            // Validate the object space error using the runtime decoder
+            //-------------------------------------------------------------------------
+
+            KeyReducedTrackData const trackData = { animClip.m_keyReducedData.data(), animClip.m_keyFrameTimes.data(), animClip.m_keyReducedTrackSettings.data(), numBones, (uint32_t) numFrames };
+            for ( int32_t frameIdx = 0; frameIdx < numFrames; frameIdx++ )
+            {
+                AnimationClip::DecodeKeyReducedPose( trackData, FrameTime( frameIdx ), &decodedLocalTransforms[frameIdx * numBones] );
+            }
+
+            CalculateModelSpaceTransforms( decodedLocalTransforms, decodedModelSpaceTransforms );
+
+            eastl::fill( boneErrors.begin(), boneErrors.end(), 0.0f );
+            for ( int32_t i = 0; i < numFrames * numBones; i++ )
+            {
+                int32_t const boneIdx = i % numBones;
+                boneErrors[boneIdx] = Math::Max( boneErrors[boneIdx], GetObjectSpaceError( rawModelSpaceTransforms[i], decodedModelSpaceTransforms[i] ) );
+            }
+
+            // Tighten the tolerances of all bones in the chains that exceed the tolerance
+            //-------------------------------------------------------------------------
+
+            maxError = 0.0f;
+            bool isWithinTolerance = true;
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                maxError = Math::Max( maxError, boneErrors[boneIdx] );
+                if ( boneErrors[boneIdx] <= errorTolerance )
+                {
+                    continue;
+                }
+
+                isWithinTolerance = false;
+                int32_t chainBoneIdx = boneIdx;
+                while ( chainBoneIdx != InvalidIndex )
+                {
+                    needsRecompression[chainBoneIdx] = true;
+                    chainBoneIdx = rawSkeleton.GetParentBoneIndex( chainBoneIdx );
+                }
+            }
+
+            if ( isWithinTolerance )
+            {
+                break;
+            }
+
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                if ( needsRecompression[boneIdx] )
+                {
+                    boneTolerances[boneIdx] *= 0.5f;
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( maxError > errorTolerance )
+        {
+            Warning( "Key reduced compression could not reach the error tolerance (%.3fmm), max error: %.3fmm", errorTolerance * 1000, maxError * 1000 );
+        }
+
+        // Compare against the size of the uniform format: an encoded rotation and 4 quantized floats (translation and scale) per bone per frame
+        size_t const uniformKeySize = sizeof( Quantization::EncodedQuaternion ) + ( 4 * sizeof( Quantization::EncodeFloat( 0.0f, 0.0f, 1.0f ) ) );
+        size_t const uniformDataSize = size_t( numBones ) * numFrames * uniformKeySize;
+        animClip.m_compressionFormat = AnimationClip::CompressionFormat::KeyReduced;
+        Message( "Key reduced compression: %zu bytes (%.1f%% of uniform), max error: %.3fmm", animClip.GetCompressedPoseDataSize(), 100.0f * animClip.GetCompressedPoseDataSize() / uniformDataSize, maxError * 1000 );
+        return true;
+    }
+
     //-------------------------------------------------------------------------
 
     bool AnimationClipCompiler::ReadEventsData( Resource::CompileContext const& ctx, rapidjson::Document const& document, RawAssets::RawAnimation const& rawAnimData, AnimationClipEventData& outEventData ) const
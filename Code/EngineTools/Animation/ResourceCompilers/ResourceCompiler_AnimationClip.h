@@ -20,7 +20,7 @@ namespace EE::Animation
     class AnimationClipCompiler : public Resource::Compiler
     {
         EE_REFLECT_TYPE( AnimationClipCompiler );
-        static const int32_t s_version = 35;
+        static const int32_t s_version = 37;
 
     public:
 
@@ -32,7 +32,10 @@ namespace EE::Animation
 
         virtual bool GetInstallDependencies( ResourceID const& resourceID, TVector<ResourceID>& outReferencedResources ) const override;
 
-        void TransferAndCompressAnimationData( RawAssets::RawAnimation const& rawAnimData, AnimationClip& animClip, IntRange const& limitRange ) const;
+        void TransferAndCompressAnimationData( RawAssets::RawAnimation const& rawAnimData, AnimationClip& animClip, AnimationClipResourceDescriptor const& resourceDescriptor ) const;
+
+        // Returns false if the clip cannot be key reduced, in which case the uniform compression should be used
+        bool CompressKeyReducedAnimationData( RawAssets::RawAnimation const& rawAnimData, AnimationClip& animClip, int32_t frameIdxStart, int32_t frameIdxEnd, float errorTolerance ) const;
 
         bool ReadEventsData( Resource::CompileContext const& ctx, rapidjson::Document const& document, RawAssets::RawAnimation const& rawAnimData, AnimationClipEventData& outEventData ) const;
 
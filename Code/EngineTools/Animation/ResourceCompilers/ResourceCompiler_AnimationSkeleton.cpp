@@ -3,6 +3,7 @@
 #include "EngineTools/RawAssets/RawSkeleton.h"
 #include "EngineTools/RawAssets/RawAssetReader.h"
 #include "Engine/Animation/AnimationSkeleton.h"
+#include "Engine/Animation/AnimationSoA.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/Serialization/BinarySerialization.h"
 
@@ -40,6 +41,16 @@ namespace EE::Animation
             return Error( "Failed to read skeleton from source file" );
         }
 
+        // Sort the bones so that each LOD is a prefix of the bone list
+        //-------------------------------------------------------------------------
+
+        TVector<StringID> unknownBoneIDs;
+        TVector<int32_t> const numBonesPerLOD = pRawSkeleton->ApplyLODs( resourceDescriptor.GetExcludedBonesPerLOD(), &unknownBoneIDs );
+        for ( StringID const& unknownBoneID : unknownBoneIDs )
+        {
+            Warning( "LOD definition references an unknown bone: %s", unknownBoneID.c_str() );
+        }
+
         // Reflect raw data into runtime format
         //-------------------------------------------------------------------------
 
@@ -54,6 +65,12 @@ namespace EE::Animation
             skeleton.m_localReferencePose.push_back( Transform( boneData.m_localTransform.GetRotation(), boneData.m_localTransform.GetTranslation(), boneData.m_localTransform.GetScale() ) );
         }
 
+        // Pad the LOD bone counts to the SoA lane width so that pose lanes never straddle the active bone range
+        for ( int32_t const numLODBones : numBonesPerLOD )
+        {
+            skeleton.m_numBonesPerLOD.emplace_back( Math::Min( SoATransformBuffer::GetPaddedCount( numLODBones ), numBones ) );
+        }
+
         // Serialize skeleton
         //-------------------------------------------------------------------------
 
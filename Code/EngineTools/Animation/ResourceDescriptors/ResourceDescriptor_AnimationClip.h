@@ -9,6 +9,16 @@
 
 namespace EE::Animation
 {
+    enum class AnimationClipCompression : uint8_t
+    {
+        EE_REFLECT_ENUM
+
+        Uniform,        // Every frame is stored at a fixed 16bit quantization, fastest to decode
+        KeyReduced,     // Only the key-frames needed to stay within the error tolerance are stored, with the minimum bit rate per track
+    };
+
+    //-------------------------------------------------------------------------
+
     struct EE_ENGINETOOLS_API AnimationClipResourceDescriptor final : public Resource::ResourceDescriptor
     {
         EE_REFLECT_TYPE( AnimationClipResourceDescriptor );
@@ -41,5 +51,7 @@ namespace EE::Animation
         EE_REFLECT() EulerAngles                 m_rootMotionGenerationPreRotation;
         EE_REFLECT() bool                        m_generateTestAdditive = false; // This is to generate an additive pose (based on the reference pose) so that we can test the rest of the code (remove once we have a proper additive import pipeline)
         EE_REFLECT() IntRange                    m_limitFrameRange;
+        EE_REFLECT() AnimationClipCompression    m_compression = AnimationClipCompression::Uniform;
+        EE_REFLECT() float                       m_compressionErrorTolerance = 0.0001f; // Key reduced compression only: the max allowed object space error (in meters) for any bone
     };
 }
\ No newline at end of file
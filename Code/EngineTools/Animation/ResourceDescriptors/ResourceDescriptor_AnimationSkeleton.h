@@ -9,6 +9,19 @@
 
 namespace EE::Animation
 {
+    // Defines the bones removed for a skeleton LOD level, removing a bone will also remove all its children
+    struct EE_ENGINETOOLS_API SkeletonLODDefinition final : public IReflectedType
+    {
+        EE_REFLECT_TYPE( SkeletonLODDefinition );
+
+    public:
+
+        EE_REFLECT();
+        TVector<StringID>                           m_excludedBones;
+    };
+
+    //-------------------------------------------------------------------------
+
     struct EE_ENGINETOOLS_API SkeletonResourceDescriptor final : public Resource::ResourceDescriptor
     {
         EE_REFLECT_TYPE( SkeletonResourceDescriptor );
@@ -40,5 +53,22 @@ namespace EE::Animation
 
         EE_REFLECT();
         TVector<BoneMaskDefinition>                 m_boneMaskDefinitions;
+
+        // Each definition creates an additional skeleton LOD (LOD 0 always has all bones), bones removed from a LOD are also removed from all subsequent LODs
+        EE_REFLECT();
+        TVector<SkeletonLODDefinition>              m_lodDefinitions;
+
+    public:
+
+        // Get the list of excluded bones for each additional LOD
+        TVector<TVector<StringID>> GetExcludedBonesPerLOD() const
+        {
+            TVector<TVector<StringID>> excludedBonesPerLOD;
+            for ( auto const& lodDefinition : m_lodDefinitions )
+            {
+                excludedBonesPerLOD.emplace_back( lodDefinition.m_excludedBones );
+            }
+            return excludedBonesPerLOD;
+        }
     };
 }
\ No newline at end of file
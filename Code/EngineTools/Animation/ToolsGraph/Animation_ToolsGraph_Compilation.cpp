@@ -2,6 +2,10 @@
 #include "Animation_ToolsGraph_Definition.h"
 #include "Nodes/Animation_ToolsGraphNode_Parameters.h"
 #include "Nodes/Animation_ToolsGraphNode_Result.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Bools.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_ConstValues.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_Floats.h"
+#include "Engine/Animation/Graph/Nodes/Animation_RuntimeGraphNode_ValuePrograms.h"
 
 //-------------------------------------------------------------------------
 
@@ -53,6 +57,425 @@ namespace EE::Animation
         }
     }
 
+    //-------------------------------------------------------------------------
+    // Value Program Compilation
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        // Generates a value program from a network of compiled runtime value node settings
+        // Registers are allocated as a stack, each node writes its result into the register supplied by its parent
+        class ValueProgramBuilder
+        {
+        public:
+
+            ValueProgramBuilder( TVector<GraphNode::Settings*> const& nodeSettings )
+                : m_nodeSettings( nodeSettings )
+            {}
+
+            // Can this node's result be calculated inside a value program
+            bool IsLowerable( int16_t nodeIdx ) const
+            {
+                return IsLowerableFloatNode( nodeIdx ) || IsLowerableBoolNode( nodeIdx );
+            }
+
+            bool IsLowerableFloatNode( int16_t nodeIdx ) const
+            {
+                GraphNode::Settings const* pSettings = m_nodeSettings[nodeIdx];
+                return IsOfType<ConstFloatNode::Settings>( pSettings ) || IsOfType<FloatRemapNode::Settings>( pSettings ) || IsOfType<FloatClampNode::Settings>( pSettings ) ||
+                       IsOfType<FloatAbsNode::Settings>( pSettings ) || IsOfType<FloatMathNode::Settings>( pSettings ) || IsOfType<FloatSwitchNode::Settings>( pSettings ) ||
+                       IsOfType<FloatAngleMathNode::Settings>( pSettings );
+            }
+
+            bool IsLowerableBoolNode( int16_t nodeIdx ) const
+            {
+                GraphNode::Settings const* pSettings = m_nodeSettings[nodeIdx];
+                return IsOfType<ConstBoolNode::Settings>( pSettings ) || IsOfType<FloatComparisonNode::Settings>( pSettings ) || IsOfType<FloatRangeComparisonNode::Settings>( pSettings ) ||
+                       IsOfType<AndNode::Settings>( pSettings ) || IsOfType<OrNode::Settings>( pSettings ) || IsOfType<NotNode::Settings>( pSettings );
+            }
+
+            // Get the indices of all the value nodes referenced by a lowerable node
+            void GetInputNodeIndices( int16_t nodeIdx, TInlineVector<int16_t, 4>& outIndices ) const
+            {
+                outIndices.clear();
+
+                GraphNode::Settings const* pSettings = m_nodeSettings[nodeIdx];
+                if ( auto pRemap = TryCast<FloatRemapNode::Settings>( pSettings ) ) { outIndices.emplace_back( pRemap->m_inputValueNodeIdx ); }
+                else if ( auto pClamp = TryCast<FloatClampNode::Settings>( pSettings ) ) { outIndices.emplace_back( pClamp->m_inputValueNodeIdx ); }
+                else if ( auto pAbs = TryCast<FloatAbsNode::Settings>( pSettings ) ) { outIndices.emplace_back( pAbs->m_inputValueNodeIdx ); }
+                else if ( auto pMath = TryCast<FloatMathNode::Settings>( pSettings ) ) { outIndices.emplace_back( pMath->m_inputValueNodeIdxA ); outIndices.emplace_back( pMath->m_inputValueNodeIdxB ); }
+                else if ( auto pSwitch = TryCast<FloatSwitchNode::Settings>( pSettings ) ) { outIndices.emplace_back( pSwitch->m_switchValueNodeIdx ); outIndices.emplace_back( pSwitch->m_trueValueNodeIdx ); outIndices.emplace_back( pSwitch->m_falseValueNodeIdx ); }
+                else if ( auto pAngleMath = TryCast<FloatAngleMathNode::Settings>( pSettings ) ) { outIndices.emplace_back( pAngleMath->m_inputValueNodeIdx ); }
+                else if ( auto pComparison = TryCast<FloatComparisonNode::Settings>( pSettings ) ) { outIndices.emplace_back( pComparison->m_inputValueNodeIdx ); outIndices.emplace_back( pComparison->m_comparandValueNodeIdx ); }
+                else if ( auto pRangeComparison = TryCast<FloatRangeComparisonNode::Settings>( pSettings ) ) { outIndices.emplace_back( pRangeComparison->m_inputValueNodeIdx ); }
+                else if ( auto pAnd = TryCast<AndNode::Settings>( pSettings ) ) { outIndices.insert( outIndices.end(), pAnd->m_conditionNodeIndices.begin(), pAnd->m_conditionNodeIndices.end() ); }
+                else if ( auto pOr = TryCast<OrNode::Settings>( pSettings ) ) { outIndices.insert( outIndices.end(), pOr->m_conditionNodeIndices.begin(), pOr->m_conditionNodeIndices.end() ); }
+                else if ( auto pNot = TryCast<NotNode::Settings>( pSettings ) ) { outIndices.emplace_back( pNot->m_inputValueNodeIdx ); }
+
+                // Remove unset optional inputs
+                for ( int32_t i = (int32_t) outIndices.size() - 1; i >= 0; i-- )
+                {
+                    if ( outIndices[i] == InvalidIndex )
+                    {
+                        outIndices.erase( outIndices.begin() + i );
+                    }
+                }
+            }
+
+            // Build the program for the network rooted at the specified node, fails if the network exceeds the program limits
+            bool Build( int16_t rootNodeIdx, ValueProgram& outProgram, TInlineVector<int16_t, 4>& outInputNodeIndices )
+            {
+                EE_ASSERT( IsLowerable( rootNodeIdx ) );
+
+                m_pProgram = &outProgram;
+                m_pInputNodeIndices = &outInputNodeIndices;
+                m_numUsedRegisters = 0;
+                m_failed = false;
+
+                uint8_t const resultRegister = AllocateRegister();
+                if ( IsLowerableFloatNode( rootNodeIdx ) )
+                {
+                    EmitFloat( rootNodeIdx, resultRegister );
+                }
+                else
+                {
+                    EmitBool( rootNodeIdx, resultRegister );
+                }
+                ReleaseRegister();
+
+                m_pProgram->m_resultRegister = resultRegister;
+                m_pProgram = nullptr;
+                m_pInputNodeIndices = nullptr;
+
+                return !m_failed && outProgram.IsValid();
+            }
+
+        private:
+
+            template<typename T>
+            static bool IsOfType( GraphNode::Settings const* pSettings ) { return TryCast<T>( pSettings ) != nullptr; }
+
+            void EmitFloat( int16_t nodeIdx, uint8_t resultRegister )
+            {
+                GraphNode::Settings const* pSettings = m_nodeSettings[nodeIdx];
+
+                if ( auto pConst = TryCast<ConstFloatNode::Settings>( pSettings ) )
+                {
+                    Emit( ValueProgram::OpCode::LoadFloatConstant, resultRegister, AddConstants( { pConst->m_value } ) );
+                }
+                else if ( auto pRemap = TryCast<FloatRemapNode::Settings>( pSettings ) )
+                {
+                    EmitFloat( pRemap->m_inputValueNodeIdx, resultRegister );
+                    uint16_t const constantsIdx = AddConstants( { pRemap->m_inputRange.m_begin, pRemap->m_inputRange.m_end, pRemap->m_outputRange.m_begin, pRemap->m_outputRange.m_end } );
+                    Emit( ValueProgram::OpCode::Remap, resultRegister, resultRegister, constantsIdx );
+                }
+                else if ( auto pClamp = TryCast<FloatClampNode::Settings>( pSettings ) )
+                {
+                    EmitFloat( pClamp->m_inputValueNodeIdx, resultRegister );
+                    Emit( ValueProgram::OpCode::Clamp, resultRegister, resultRegister, AddConstants( { pClamp->m_clampRange.m_begin, pClamp->m_clampRange.m_end } ) );
+                }
+                else if ( auto pAbs = TryCast<FloatAbsNode::Settings>( pSettings ) )
+                {
+                    EmitFloat( pAbs->m_inputValueNodeIdx, resultRegister );
+                    Emit( ValueProgram::OpCode::Abs, resultRegister, resultRegister );
+                }
+                else if ( auto pMath = TryCast<FloatMathNode::Settings>( pSettings ) )
+                {
+                    EmitFloat( pMath->m_inputValueNodeIdxA, resultRegister );
+
+                    uint8_t const registerB = AllocateRegister();
+                    if ( pMath->m_inputValueNodeIdxB != InvalidIndex )
+                    {
+                        EmitFloat( pMath->m_inputValueNodeIdxB, registerB );
+                    }
+                    else
+                    {
+                        Emit( ValueProgram::OpCode::LoadFloatConstant, registerB, AddConstants( { pMath->m_valueB } ) );
+                    }
+
+                    switch ( pMath->m_operator )
+                    {
+                        case FloatMathNode::Operator::Add: Emit( ValueProgram::OpCode::Add, resultRegister, resultRegister, registerB ); break;
+                        case FloatMathNode::Operator::Sub: Emit( ValueProgram::OpCode::Sub, resultRegister, resultRegister, registerB ); break;
+                        case FloatMathNode::Operator::Mul: Emit( ValueProgram::OpCode::Mul, resultRegister, resultRegister, registerB ); break;
+                        case FloatMathNode::Operator::Div: Emit( ValueProgram::OpCode::Div, resultRegister, resultRegister, registerB ); break;
+                    }
+                    ReleaseRegister();
+
+                    if ( pMath->m_returnAbsoluteResult )
+                    {
+                        Emit( ValueProgram::OpCode::Abs, resultRegister, resultRegister );
+                    }
+                }
+                else if ( auto pSwitch = TryCast<FloatSwitchNode::Settings>( pSettings ) )
+                {
+                    EmitBool( pSwitch->m_switchValueNodeIdx, resultRegister );
+                    int32_t const jumpToFalseIdx = Emit( ValueProgram::OpCode::JumpIfFalse, 0, resultRegister );
+                    EmitFloat( pSwitch->m_trueValueNodeIdx, resultRegister );
+                    int32_t const jumpToEndIdx = Emit( ValueProgram::OpCode::Jump, 0 );
+                    SetJumpTarget( jumpToFalseIdx );
+                    EmitFloat( pSwitch->m_falseValueNodeIdx, resultRegister );
+                    SetJumpTarget( jumpToEndIdx );
+                }
+                else if ( auto pAngleMath = TryCast<FloatAngleMathNode::Settings>( pSettings ) )
+                {
+                    EmitFloat( pAngleMath->m_inputValueNodeIdx, resultRegister );
+
+                    switch ( pAngleMath->m_operation )
+                    {
+                        case FloatAngleMathNode::Operation::ClampTo180: Emit( ValueProgram::OpCode::AngleClampTo180, resultRegister, resultRegister ); break;
+                        case FloatAngleMathNode::Operation::ClampTo360: Emit( ValueProgram::OpCode::AngleClampTo360, resultRegister, resultRegister ); break;
+                        case FloatAngleMathNode::Operation::FlipHemisphere: Emit( ValueProgram::OpCode::AngleFlipHemisphere, resultRegister, resultRegister ); break;
+                        case FloatAngleMathNode::Operation::FlipHemisphereNegate: Emit( ValueProgram::OpCode::AngleFlipHemisphereNegate, resultRegister, resultRegister ); break;
+                    }
+                }
+                else
+                {
+                    Emit( ValueProgram::OpCode::LoadFloatInput, resultRegister, AddInput( nodeIdx ) );
+                }
+            }
+
+            void EmitBool( int16_t nodeIdx, uint8_t resultRegister )
+            {
+                GraphNode::Settings const* pSettings = m_nodeSettings[nodeIdx];
+
+                if ( auto pConst = TryCast<ConstBoolNode::Settings>( pSettings ) )
+                {
+                    Emit( ValueProgram::OpCode::LoadBoolConstant, resultRegister, pConst->m_value ? 1 : 0 );
+                }
+                else if ( auto pComparison = TryCast<FloatComparisonNode::Settings>( pSettings ) )
+                {
+                    EmitFloat( pComparison->m_inputValueNodeIdx, resultRegister );
+
+                    uint8_t const comparandRegister = AllocateRegister();
+                    if ( pComparison->m_comparandValueNodeIdx != InvalidIndex )
+                    {
+                        EmitFloat( pComparison->m_comparandValueNodeIdx, comparandRegister );
+                    }
+                    else
+                    {
+                        Emit( ValueProgram::OpCode::LoadFloatConstant, comparandRegister, AddConstants( { pComparison->m_comparisonValue } ) );
+                    }
+
+                    switch ( pComparison->m_comparison )
+                    {
+                        case FloatComparisonNode::Comparison::GreaterThanEqual: Emit( ValueProgram::OpCode::GreaterThanEqual, resultRegister, resultRegister, comparandRegister ); break;
+                        case FloatComparisonNode::Comparison::LessThanEqual: Emit( ValueProgram::OpCode::LessThanEqual, resultRegister, resultRegister, comparandRegister ); break;
+                        case FloatComparisonNode::Comparison::NearEqual: Emit( ValueProgram::OpCode::NearEqual, resultRegister, resultRegister, comparandRegister, AddConstants( { pComparison->m_epsilon } ) ); break;
+                        case FloatComparisonNode::Comparison::GreaterThan: Emit( ValueProgram::OpCode::GreaterThan, resultRegister, resultRegister, comparandRegister ); break;
+                        case FloatComparisonNode::Comparison::LessThan: Emit( ValueProgram::OpCode::LessThan, resultRegister, resultRegister, comparandRegister ); break;
+                    }
+                    ReleaseRegister();
+                }
+                else if ( auto pRangeComparison = TryCast<FloatRangeComparisonNode::Settings>( pSettings ) )
+                {
+                    EmitFloat( pRangeComparison->m_inputValueNodeIdx, resultRegister );
+                    uint16_t const constantsIdx = AddConstants( { pRangeComparison->m_range.m_begin, pRangeComparison->m_range.m_end } );
+                    Emit( pRangeComparison->m_isInclusiveCheck ? ValueProgram::OpCode::InRangeInclusive : ValueProgram::OpCode::InRangeExclusive, resultRegister, resultRegister, constantsIdx );
+                }
+                else if ( auto pAnd = TryCast<AndNode::Settings>( pSettings ) )
+                {
+                    EmitShortCircuit( pAnd->m_conditionNodeIndices, ValueProgram::OpCode::JumpIfFalse, resultRegister );
+                }
+                else if ( auto pOr = TryCast<OrNode::Settings>( pSettings ) )
+                {
+                    EmitShortCircuit( pOr->m_conditionNodeIndices, ValueProgram::OpCode::JumpIfTrue, resultRegister );
+                }
+                else if ( auto pNot = TryCast<NotNode::Settings>( pSettings ) )
+                {
+                    EmitBool( pNot->m_inputValueNodeIdx, resultRegister );
+                    Emit( ValueProgram::OpCode::Not, resultRegister, resultRegister );
+                }
+                else
+                {
+                    Emit( ValueProgram::OpCode::LoadBoolInput, resultRegister, AddInput( nodeIdx ) );
+                }
+            }
+
+            // And/Or: evaluate conditions in order and skip the remaining ones as soon as the result is known
+            void EmitShortCircuit( TInlineVector<int16_t, 4> const& conditionNodeIndices, ValueProgram::OpCode jumpOpCode, uint8_t resultRegister )
+            {
+                if ( conditionNodeIndices.empty() )
+                {
+                    Emit( ValueProgram::OpCode::LoadBoolConstant, resultRegister, ( jumpOpCode == ValueProgram::OpCode::JumpIfFalse ) ? 1 : 0 );
+                    return;
+                }
+
+                TInlineVector<int32_t, 4> jumpToEndIndices;
+                int32_t const numConditions = (int32_t) conditionNodeIndices.size();
+                for ( int32_t i = 0; i < numConditions; i++ )
+                {
+                    EmitBool( conditionNodeIndices[i], resultRegister );
+                    if ( i < numConditions - 1 )
+                    {
+                        jumpToEndIndices.emplace_back( Emit( jumpOpCode, 0, resultRegister ) );
+                    }
+                }
+
+                for ( auto jumpIdx : jumpToEndIndices )
+                {
+                    SetJumpTarget( jumpIdx );
+                }
+            }
+
+            //-------------------------------------------------------------------------
+
+            int32_t Emit( ValueProgram::OpCode opCode, uint8_t resultRegister, uint16_t a = 0, uint16_t b = 0, uint16_t c = 0 )
+            {
+                m_pProgram->m_instructions.emplace_back( opCode, resultRegister, a, b, c );
+                if ( m_pProgram->m_instructions.size() >= 0xFFFF )
+                {
+                    m_failed = true;
+                }
+                return (int32_t) m_pProgram->m_instructions.size() - 1;
+            }
+
+            // Set the target of a previously emitted jump to the next instruction
+            void SetJumpTarget( int32_t jumpInstructionIdx )
+            {
+                auto& instruction = m_pProgram->m_instructions[jumpInstructionIdx];
+                uint16_t const target = (uint16_t) m_pProgram->m_instructions.size();
+                if ( instruction.m_opCode == ValueProgram::OpCode::Jump )
+                {
+                    instruction.m_operandA = target;
+                }
+                else
+                {
+                    EE_ASSERT( instruction.m_opCode == ValueProgram::OpCode::JumpIfFalse || instruction.m_opCode == ValueProgram::OpCode::JumpIfTrue );
+                    instruction.m_operandB = target;
+                }
+            }
+
+            uint16_t AddConstants( std::initializer_list<float> constants )
+            {
+                uint16_t const constantsIdx = (uint16_t) m_pProgram->m_constants.size();
+                m_pProgram->m_constants.insert( m_pProgram->m_constants.end(), constants.begin(), constants.end() );
+                if ( m_pProgram->m_constants.size() >= 0xFFFF )
+                {
+                    m_failed = true;
+                }
+                return constantsIdx;
+            }
+
+            uint16_t AddInput( int16_t nodeIdx )
+            {
+                EE_ASSERT( nodeIdx != InvalidIndex );
+                int32_t const numInputs = (int32_t) m_pInputNodeIndices->size();
+                for ( int32_t i = 0; i < numInputs; i++ )
+                {
+                    if ( ( *m_pInputNodeIndices )[i] == nodeIdx )
+                    {
+                        return (uint16_t) i;
+                    }
+                }
+
+                m_pInputNodeIndices->emplace_back( nodeIdx );
+                return (uint16_t) ( m_pInputNodeIndices->size() - 1 );
+            }
+
+            uint8_t AllocateRegister()
+            {
+                if ( m_numUsedRegisters >= ValueProgram::s_maxRegisters )
+                {
+                    m_failed = true;
+                    return 0;
+                }
+
+                uint8_t const allocatedRegister = (uint8_t) m_numUsedRegisters++;
+                m_pProgram->m_numRegisters = Math::Max( m_pProgram->m_numRegisters, (uint8_t) m_numUsedRegisters );
+                return allocatedRegister;
+            }
+
+            void ReleaseRegister()
+            {
+                if ( m_numUsedRegisters > 0 && !m_failed )
+                {
+                    m_numUsedRegisters--;
+                }
+            }
+
+        private:
+
+            TVector<GraphNode::Settings*> const&        m_nodeSettings;
+            ValueProgram*                               m_pProgram = nullptr;
+            TInlineVector<int16_t, 4>*                  m_pInputNodeIndices = nullptr;
+            int32_t                                     m_numUsedRegisters = 0;
+            bool                                        m_failed = false;
+        };
+    }
+
+    void GraphDefinitionCompiler::CompileValuePrograms()
+    {
+        ValueProgramBuilder builder( m_context.m_nodeSettings );
+        int16_t const numNodes = (int16_t) m_context.m_nodeSettings.size();
+
+        // Any lowerable node referenced by another lowerable node will be inlined into that node's program
+        //-------------------------------------------------------------------------
+
+        TVector<bool> isReferencedByLowerableNode( numNodes, false );
+        TVector<bool> hasLowerableInputs( numNodes, false );
+        TInlineVector<int16_t, 4> inputNodeIndices;
+
+        for ( int16_t nodeIdx = 0; nodeIdx < numNodes; nodeIdx++ )
+        {
+            if ( !builder.IsLowerable( nodeIdx ) )
+            {
+                continue;
+            }
+
+            builder.GetInputNodeIndices( nodeIdx, inputNodeIndices );
+            for ( int16_t inputNodeIdx : inputNodeIndices )
+            {
+                if ( builder.IsLowerable( inputNodeIdx ) )
+                {
+                    isReferencedByLowerableNode[inputNodeIdx] = true;
+                    hasLowerableInputs[nodeIdx] = true;
+                }
+            }
+        }
+
+        // Replace the roots of all lowerable networks with program nodes
+        //-------------------------------------------------------------------------
+        // Networks consisting of a single node gain nothing from being lowered, so are left as is.
+        // Inlined nodes remain in the graph, so any non-lowerable node that references them will still use the regular node path.
+        // The original network is also evaluated by development builds, to keep the inlined nodes debuggable and to validate the program.
+
+        for ( int16_t nodeIdx = 0; nodeIdx < numNodes; nodeIdx++ )
+        {
+            if ( !builder.IsLowerable( nodeIdx ) || isReferencedByLowerableNode[nodeIdx] || !hasLowerableInputs[nodeIdx] )
+            {
+                continue;
+            }
+
+            ValueProgram program;
+            TInlineVector<int16_t, 4> programInputNodeIndices;
+            if ( !builder.Build( nodeIdx, program, programInputNodeIndices ) )
+            {
+                continue;
+            }
+
+            // The original root is moved to the end of the node list, keep a reference to it so development builds can evaluate it
+            int16_t const originalNodeIdx = (int16_t) m_context.m_nodeSettings.size();
+
+            if ( builder.IsLowerableFloatNode( nodeIdx ) )
+            {
+                auto pSettings = m_context.ReplaceNodeSettings<FloatProgramNode>( nodeIdx );
+                pSettings->m_program = eastl::move( program );
+                pSettings->m_inputValueNodeIndices = programInputNodeIndices;
+                pSettings->m_originalNodeIdx = originalNodeIdx;
+            }
+            else
+            {
+                auto pSettings = m_context.ReplaceNodeSettings<BoolProgramNode>( nodeIdx );
+                pSettings->m_program = eastl::move( program );
+                pSettings->m_inputValueNodeIndices = programInputNodeIndices;
+                pSettings->m_originalNodeIdx = originalNodeIdx;
+            }
+
+            EE_ASSERT( m_context.m_nodeSettings[originalNodeIdx]->m_nodeIdx == originalNodeIdx );
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     bool GraphDefinitionCompiler::CompileGraph( ToolsGraphDefinition const& toolsGraph )
@@ -115,6 +538,12 @@ namespace EE::Animation
         EE_ASSERT( resultNodes.size() == 1 );
         int16_t const rootNodeIdx = resultNodes[0]->Compile( m_context );
 
+        // Lower pure value node networks into value programs, this needs to happen once all nodes are compiled
+        if ( rootNodeIdx != InvalidIndex )
+        {
+            CompileValuePrograms();
+        }
+
         // Fill runtime definition
         //-------------------------------------------------------------------------
 
@@ -197,6 +197,42 @@ namespace EE::Animation
             return m_transitionDuration;
         }
 
+        // Node Replacement
+        //-------------------------------------------------------------------------
+
+        // Replace the settings of an already compiled node with a new node type. The original node is kept and moved to the end of
+        // the node list so that any nodes it references remain valid, all existing references to the node index will now use the new node.
+        template<typename T>
+        typename T::Settings* ReplaceNodeSettings( int16_t nodeIdx )
+        {
+            EE_ASSERT( nodeIdx >= 0 && nodeIdx < m_nodeSettings.size() );
+            EE_ASSERT( m_nodeSettings.size() < 0x7FFF );
+
+            // Move original node to the end of the list, it keeps its instance memory
+            GraphNode::Settings* pOriginalSettings = m_nodeSettings[nodeIdx];
+            pOriginalSettings->m_nodeIdx = int16_t( m_nodeSettings.size() );
+            m_nodeSettings.emplace_back( pOriginalSettings );
+
+            String const nodePath = m_compiledNodePaths[nodeIdx];
+            m_compiledNodePaths.emplace_back( nodePath );
+
+            uint32_t const originalNodeMemoryOffset = m_nodeMemoryOffsets[nodeIdx];
+            m_nodeMemoryOffsets.emplace_back( originalNodeMemoryOffset );
+
+            // Create the new node settings in the original slot
+            auto pNewSettings = EE::New<typename T::Settings>();
+            pNewSettings->m_nodeIdx = nodeIdx;
+            m_nodeSettings[nodeIdx] = pNewSettings;
+
+            // Allocate instance memory for the new node
+            m_graphInstanceRequiredAlignment = Math::Max( m_graphInstanceRequiredAlignment, (uint32_t) alignof( T ) );
+            uint32_t const requiredNodePadding = (uint32_t) Memory::CalculatePaddingForAlignment( m_currentNodeMemoryOffset, alignof( T ) );
+            m_nodeMemoryOffsets[nodeIdx] = m_currentNodeMemoryOffset + requiredNodePadding;
+            m_currentNodeMemoryOffset += uint32_t( sizeof( T ) + requiredNodePadding );
+
+            return pNewSettings;
+        }
+
     private:
 
         void TryAddPersistentNode( VisualGraph::BaseNode const* pNode, GraphNode::Settings* pSettings );
@@ -244,6 +280,11 @@ namespace EE::Animation
         inline THashMap<UUID, int16_t> const& GetUUIDToRuntimeIndexMap() const { return m_context.m_nodeIDToIndexMap; }
         inline THashMap<int16_t, UUID> const& GetRuntimeIndexToUUIDMap() const { return m_context.m_nodeIndexToIDMap; }
 
+    private:
+
+        // Lower networks of pure value nodes into value programs
+        void CompileValuePrograms();
+
     private:
 
         GraphDefinition             m_runtimeGraph;
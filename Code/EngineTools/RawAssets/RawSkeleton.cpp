@@ -27,6 +27,101 @@ namespace EE::RawAssets
         return InvalidIndex;
     }
 
+    TVector<int32_t> RawSkeleton::ApplyLODs( TVector<TVector<StringID>> const& excludedBonesPerLOD, TVector<StringID>* pOutUnknownBoneIDs )
+    {
+        EE_ASSERT( !m_bones.empty() );
+
+        int32_t const numBones = GetNumBones();
+        int32_t const numLODs = (int32_t) excludedBonesPerLOD.size() + 1;
+
+        // Calculate the last LOD each bone is present in
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> lastLODForBone( numBones, numLODs - 1 );
+        for ( int32_t lod = 1; lod < numLODs; lod++ )
+        {
+            for ( StringID const& boneID : excludedBonesPerLOD[lod - 1] )
+            {
+                int32_t const boneIdx = GetBoneIndex( boneID );
+                if ( boneIdx == InvalidIndex )
+                {
+                    if ( pOutUnknownBoneIDs != nullptr )
+                    {
+                        pOutUnknownBoneIDs->emplace_back( boneID );
+                    }
+                    continue;
+                }
+
+                // The root bone can never be removed
+                if ( boneIdx == 0 )
+                {
+                    continue;
+                }
+
+                lastLODForBone[boneIdx] = Math::Min( lastLODForBone[boneIdx], lod - 1 );
+            }
+        }
+
+        // Children cannot be present in more LODs than their parents, bones are always sorted parents first
+        for ( int32_t boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = m_bones[boneIdx].m_parentBoneIdx;
+            EE_ASSERT( parentIdx != InvalidIndex && parentIdx < boneIdx );
+            lastLODForBone[boneIdx] = Math::Min( lastLODForBone[boneIdx], lastLODForBone[parentIdx] );
+        }
+
+        // Order bones by descending LOD presence while keeping the original relative order, this guarantees that parents are still ordered before their children
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> newToOldBoneIndices;
+        newToOldBoneIndices.reserve( numBones );
+        for ( int32_t lod = numLODs - 1; lod >= 0; lod-- )
+        {
+            for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+            {
+                if ( lastLODForBone[boneIdx] == lod )
+                {
+                    newToOldBoneIndices.emplace_back( boneIdx );
+                }
+            }
+        }
+
+        TVector<int32_t> oldToNewBoneIndices( numBones );
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            oldToNewBoneIndices[newToOldBoneIndices[boneIdx]] = boneIdx;
+        }
+
+        TVector<BoneData> sortedBones;
+        sortedBones.reserve( numBones );
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            BoneData& boneData = sortedBones.emplace_back( m_bones[newToOldBoneIndices[boneIdx]] );
+            if ( boneData.m_parentBoneIdx != InvalidIndex )
+            {
+                boneData.m_parentBoneIdx = oldToNewBoneIndices[boneData.m_parentBoneIdx];
+                EE_ASSERT( boneData.m_parentBoneIdx < boneIdx );
+            }
+        }
+
+        m_bones.swap( sortedBones );
+
+        // Count the bones per LOD
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> numBonesPerLOD( numLODs, 0 );
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            for ( int32_t lod = 0; lod <= lastLODForBone[newToOldBoneIndices[boneIdx]]; lod++ )
+            {
+                numBonesPerLOD[lod]++;
+            }
+        }
+
+        EE_ASSERT( numBonesPerLOD[0] == numBones );
+        return numBonesPerLOD;
+    }
+
     void RawSkeleton::CalculateLocalTransforms()
     {
         EE_ASSERT( !m_bones.empty() );
@@ -47,6 +47,11 @@ namespace EE::RawAssets
         inline Transform const& GetLocalTransform( int32_t boneIdx ) const { EE_ASSERT( boneIdx >= 0 && boneIdx < m_bones.size() ); return m_bones[boneIdx].m_localTransform; }
         inline Transform const& GetGlobalTransform( int32_t boneIdx ) const { EE_ASSERT( boneIdx >= 0 && boneIdx < m_bones.size() ); return m_bones[boneIdx].m_globalTransform; }
 
+        // Reorder the bones so that the bones for each LOD are a prefix of the bone list. LOD 0 always contains all the bones, and each
+        // entry in the supplied list defines the bones removed for the next LOD. Removing a bone also removes all its children, and bones
+        // removed from a LOD are also removed from all subsequent LODs. Returns the number of bones in each LOD (starting with LOD 0).
+        TVector<int32_t> ApplyLODs( TVector<TVector<StringID>> const& excludedBonesPerLOD, TVector<StringID>* pOutUnknownBoneIDs = nullptr );
+
     protected:
 
         void CalculateLocalTransforms();
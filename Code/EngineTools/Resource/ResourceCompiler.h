@@ -18,6 +18,24 @@ namespace EE::Resource
         SuccessWithWarnings = 2,
     };
 
+    //-------------------------------------------------------------------------
+    // Compiler Worker Protocol
+    //-------------------------------------------------------------------------
+    // Persistent compiler processes (started with '-worker <session token>') read compile requests from stdin, one per line: "<force 0|1> <package 0|1> <resource path>"
+    // The compilation log is streamed back on stdout followed by a result message containing the compilation result
+    //
+    // Stdout is shared with anything the compilers and third party libraries print, so protocol messages are framed as a line of their own: "<prefix><session token>:<message>"
+    // The session token is generated by the server for each worker process, so no log output can ever be mistaken for a protocol message
+
+    namespace CompilerWorker
+    {
+        constexpr static char const* const s_messagePrefix = "#EE_WORKER:";
+        constexpr static char const* const s_readyMessage = "READY";
+        constexpr static char const* const s_resultMessage = "RESULT:";
+        constexpr static char const* const s_exitCommand = "#EE_WORKER_EXIT";
+        constexpr static int32_t const s_maxLineLength = 1024;
+    }
+
     //-------------------------------------------------------------------------
 
     struct EE_ENGINETOOLS_API CompileContext
@@ -5,6 +5,10 @@
 
 namespace EE
 {
+    StringID const CoverVolumeComponent::s_spatialQueryCategory( "Cover" );
+
+    //-------------------------------------------------------------------------
+
     #if EE_DEVELOPMENT_TOOLS
     void CoverVolumeComponent::Draw( Drawing::DrawContext& drawingCtx ) const
     {
@@ -27,11 +27,18 @@ namespace EE
     {
         EE_ENTITY_COMPONENT( CoverVolumeComponent );
 
+    public:
+
+        // All cover volumes are tracked by the spatial query system under this category
+        static StringID const s_spatialQueryCategory;
+
     public:
 
         inline CoverVolumeComponent() = default;
         inline CoverVolumeComponent( StringID name ) : BoxVolumeComponent( name ) {}
 
+        virtual StringID GetSpatialQueryCategory() const override { return s_spatialQueryCategory; }
+
         #if EE_DEVELOPMENT_TOOLS
         virtual Color GetVolumeColor() const override { return Colors::GreenYellow; }
         virtual void Draw( Drawing::DrawContext& drawingCtx ) const override;
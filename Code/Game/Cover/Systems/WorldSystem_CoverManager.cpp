@@ -31,6 +31,12 @@ namespace EE
 
     //-------------------------------------------------------------------------
 
+    bool CoverManager::GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const
+    {
+        outAccess.ReadsComponent<CoverVolumeComponent>();
+        return true;
+    }
+
     void CoverManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
     }
@@ -4,5 +4,5 @@
 
 namespace EE::Player
 {
-
+    StringID const PlayerInteractibleComponent::s_spatialQueryCategory( "PlayerInteractible" );
 }
\ No newline at end of file
@@ -13,10 +13,17 @@ namespace EE::Player
     {
         EE_ENTITY_COMPONENT( PlayerInteractibleComponent );
 
+    public:
+
+        // All interactibles are tracked by the spatial query system under this category
+        static StringID const s_spatialQueryCategory;
+
     public:
 
         Animation::GraphVariation const* GetGraph() const { return m_pGraph.GetPtr(); }
 
+        virtual StringID GetSpatialQueryCategory() const override { return s_spatialQueryCategory; }
+
     private:
 
         EE_REFLECT() TResourcePtr<Animation::GraphVariation> m_pGraph;
@@ -15,7 +15,7 @@ namespace EE::Player
 
     void PlayerInteractionSystem::ShutdownSystem()
     {
-        EE_ASSERT( m_interactibles.empty() );
+        EE_ASSERT( m_players.empty() );
     }
 
     //-------------------------------------------------------------------------
@@ -27,11 +27,6 @@ namespace EE::Player
             RegisteredPlayer player = { pEntity, pPlayerComponent };
             m_players.emplace_back( player );
         }
-
-        if ( auto pInteractibleComponent = TryCast<PlayerInteractibleComponent>( pComponent ) )
-        {
-            m_interactibles.emplace_back( pInteractibleComponent );
-        }
     }
 
     void PlayerInteractionSystem::UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -41,16 +36,16 @@ namespace EE::Player
             RegisteredPlayer player = { pEntity, pPlayerComponent };
             m_players.erase_first( player );
         }
-
-        // TODO: handle removing a component that is in use!!!
-        if ( auto pInteractibleComponent = TryCast<PlayerInteractibleComponent>( pComponent ) )
-        {
-            m_interactibles.erase_first( pInteractibleComponent );
-        }
     }
 
     //-------------------------------------------------------------------------
 
+    bool PlayerInteractionSystem::GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const
+    {
+        outAccess.ReadsComponent<SpatialEntityComponent>().WritesComponent<MainPlayerComponent>().ReadsWorldSystem<SpatialQueryWorldSystem>();
+        return true;
+    }
+
     void PlayerInteractionSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
         if ( !ctx.IsGameWorld() )
@@ -58,20 +53,19 @@ namespace EE::Player
             return;
         }
 
+        auto pSpatialQuerySystem = ctx.GetWorldSystem<SpatialQueryWorldSystem>();
+
         // HACK!!! just to test the external graphs feature!!
         for ( auto const& player : m_players )
         {
             Vector const playerPosition = player.m_pEntity->GetWorldTransform().GetTranslation();
             player.m_pPlayerComp->m_pAvailableInteraction = nullptr;
 
-            for ( auto pInteractible : m_interactibles )
+            pSpatialQuerySystem->FindNearest( PlayerInteractibleComponent::s_spatialQueryCategory, playerPosition, 1, 2.0f, m_nearbyInteractibles );
+            if ( !m_nearbyInteractibles.empty() )
             {
-                Vector const interactiblePosition = pInteractible->GetPosition();
-
-                if ( interactiblePosition.GetDistance2( playerPosition ) < 2.0f )
-                {
-                    player.m_pPlayerComp->m_pAvailableInteraction = pInteractible->GetGraph();
-                }
+                auto pInteractible = static_cast<PlayerInteractibleComponent const*>( m_nearbyInteractibles[0] );
+                player.m_pPlayerComp->m_pAvailableInteraction = pInteractible->GetGraph();
             }
         }
     }
@@ -2,6 +2,7 @@
 
 #include "Game/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Spatial/Systems/WorldSystem_SpatialQuery.h"
 
 //-------------------------------------------------------------------------
 
@@ -35,10 +36,11 @@ namespace EE::Player
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+        virtual bool GetUpdateAccess( UpdateStage stage, WorldSystemAccess& outAccess ) const override;
 
     private:
 
         TVector<RegisteredPlayer>                   m_players;
-        TVector<PlayerInteractibleComponent*>       m_interactibles;
+        SpatialQueryWorldSystem::Results            m_nearbyInteractibles;
     };
 }
\ No newline at end of file
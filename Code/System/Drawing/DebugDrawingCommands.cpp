@@ -5,58 +5,96 @@
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
-    void CommandBuffer::Reset( Seconds deltaTime )
+    namespace
     {
-        // NAIVE delete version - profile this
-
-        for ( int32_t i = (int32_t) m_pointCommands.size() - 1; i >= 0; i-- )
+        // Update the TTL for all commands and move the surviving ones down, this keeps the command order stable and never reallocates
+        template<typename T>
+        static void CompactCommands( TVector<T>& commands, Seconds deltaTime )
         {
-            m_pointCommands[i].m_TTL -= deltaTime;
-            if ( m_pointCommands[i].m_TTL <= 0.0f )
+            int32_t const numCommands = (int32_t) commands.size();
+            int32_t numKept = 0;
+            for ( int32_t i = 0; i < numCommands; i++ )
             {
-                m_pointCommands.erase_unsorted( m_pointCommands.begin() + i );
+                commands[i].m_TTL -= deltaTime;
+                if ( commands[i].m_TTL > 0.0f )
+                {
+                    if ( numKept != i )
+                    {
+                        commands[numKept] = eastl::move( commands[i] );
+                    }
+                    numKept++;
+                }
             }
+
+            commands.erase( commands.begin() + numKept, commands.end() );
         }
 
-        for ( int32_t i = (int32_t) m_lineCommands.size() - 1; i >= 0; i-- )
+        template<typename T>
+        static void MergeCommands( TVector<T>& outCommands, ChunkedCommandBuffer const* const* pBuffers, int32_t numBuffers, TCommandChunkList<T> ChunkedCommandBuffer::* pCommandList )
         {
-            m_lineCommands[i].m_TTL -= deltaTime;
-            if ( m_lineCommands[i].m_TTL <= 0.0f )
+            size_t numCommandsToAdd = 0;
+            for ( int32_t i = 0; i < numBuffers; i++ )
             {
-                m_lineCommands.erase_unsorted( m_lineCommands.begin() + i );
+                numCommandsToAdd += ( pBuffers[i]->*pCommandList ).GetNumCommands();
             }
-        }
 
-        for ( int32_t i = (int32_t) m_triangleCommands.size() - 1; i >= 0; i-- )
-        {
-            m_triangleCommands[i].m_TTL -= deltaTime;
-            if ( m_triangleCommands[i].m_TTL <= 0.0f )
+            if ( numCommandsToAdd == 0 )
             {
-                m_triangleCommands.erase_unsorted( m_triangleCommands.begin() + i );
+                return;
             }
-        }
 
-        for ( int32_t i = (int32_t) m_textCommands.size() - 1; i >= 0; i-- )
-        {
-            m_textCommands[i].m_TTL -= deltaTime;
-            if ( m_textCommands[i].m_TTL <= 0.0f )
+            outCommands.reserve( outCommands.size() + numCommandsToAdd );
+            for ( int32_t i = 0; i < numBuffers; i++ )
             {
-                m_textCommands.erase_unsorted( m_textCommands.begin() + i );
+                ( pBuffers[i]->*pCommandList ).AppendTo( outCommands );
             }
         }
     }
 
-    void FrameCommandBuffer::AddThreadCommands( ThreadCommandBuffer const& threadCommands )
+    //-------------------------------------------------------------------------
+
+    void CommandBuffer::Merge( ChunkedCommandBuffer const* const* pBuffers, int32_t numBuffers )
+    {
+        MergeCommands( m_pointCommands, pBuffers, numBuffers, &ChunkedCommandBuffer::m_pointCommands );
+        MergeCommands( m_lineCommands, pBuffers, numBuffers, &ChunkedCommandBuffer::m_lineCommands );
+        MergeCommands( m_triangleCommands, pBuffers, numBuffers, &ChunkedCommandBuffer::m_triangleCommands );
+        MergeCommands( m_textCommands, pBuffers, numBuffers, &ChunkedCommandBuffer::m_textCommands );
+    }
+
+    void CommandBuffer::Reset( Seconds deltaTime )
+    {
+        CompactCommands( m_pointCommands, deltaTime );
+        CompactCommands( m_lineCommands, deltaTime );
+        CompactCommands( m_triangleCommands, deltaTime );
+        CompactCommands( m_textCommands, deltaTime );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void FrameCommandBuffer::AddThreadCommands( ThreadCommandBuffer const* const* pThreadBuffers, int32_t numThreadBuffers )
     {
         // TODO:
         // Broad-phase culling
         // Sort transparent and depth test off primitives by distance to camera
         // Sort text by font
 
-        m_opaqueDepthOn.Append( threadCommands.GetOpaqueDepthTestEnabledBuffer() );
-        m_opaqueDepthOff.Append( threadCommands.GetOpaqueDepthTestDisabledBuffer() );
-        m_transparentDepthOn.Append( threadCommands.GetTransparentDepthTestEnabledBuffer() );
-        m_transparentDepthOff.Append( threadCommands.GetTransparentDepthTestDisabledBuffer() );
+        TInlineVector<ChunkedCommandBuffer const*, 16> opaqueDepthOnBuffers;
+        TInlineVector<ChunkedCommandBuffer const*, 16> opaqueDepthOffBuffers;
+        TInlineVector<ChunkedCommandBuffer const*, 16> transparentDepthOnBuffers;
+        TInlineVector<ChunkedCommandBuffer const*, 16> transparentDepthOffBuffers;
+
+        for ( int32_t i = 0; i < numThreadBuffers; i++ )
+        {
+            opaqueDepthOnBuffers.emplace_back( &pThreadBuffers[i]->GetOpaqueDepthTestEnabledBuffer() );
+            opaqueDepthOffBuffers.emplace_back( &pThreadBuffers[i]->GetOpaqueDepthTestDisabledBuffer() );
+            transparentDepthOnBuffers.emplace_back( &pThreadBuffers[i]->GetTransparentDepthTestEnabledBuffer() );
+            transparentDepthOffBuffers.emplace_back( &pThreadBuffers[i]->GetTransparentDepthTestDisabledBuffer() );
+        }
+
+        m_opaqueDepthOn.Merge( opaqueDepthOnBuffers.data(), numThreadBuffers );
+        m_opaqueDepthOff.Merge( opaqueDepthOffBuffers.data(), numThreadBuffers );
+        m_transparentDepthOn.Merge( transparentDepthOnBuffers.data(), numThreadBuffers );
+        m_transparentDepthOff.Merge( transparentDepthOffBuffers.data(), numThreadBuffers );
     }
 }
-#endif
\ No newline at end of file
+#endif
@@ -191,24 +191,97 @@ namespace EE::Drawing
     };
 
     //-------------------------------------------------------------------------
+    // Chunked command list
+    //-------------------------------------------------------------------------
+    // Commands are recorded into fixed capacity chunks that are kept around between frames
+    // Recording never reallocates or moves already recorded commands, and once warmed up no allocations happen at all
 
-    struct CommandBuffer
+    template<typename T>
+    class TCommandChunkList
     {
-        inline void Append( CommandBuffer const& buffer )
+        constexpr static int32_t const s_chunkSize = 256;
+
+    public:
+
+        inline int32_t GetNumCommands() const { return m_numCommands; }
+
+        EE_FORCE_INLINE void Add( T&& cmd )
         {
-            m_pointCommands.reserve( m_pointCommands.size() + buffer.m_pointCommands.size() );
-            m_pointCommands.insert( m_pointCommands.end(), buffer.m_pointCommands.begin(), buffer.m_pointCommands.end() );
+            if ( m_currentChunkIdx == InvalidIndex || m_chunks[m_currentChunkIdx].size() == s_chunkSize )
+            {
+                StartNewChunk();
+            }
 
-            m_lineCommands.reserve( m_lineCommands.size() + buffer.m_lineCommands.size() );
-            m_lineCommands.insert( m_lineCommands.end(), buffer.m_lineCommands.begin(), buffer.m_lineCommands.end() );
+            m_chunks[m_currentChunkIdx].emplace_back( eastl::move( cmd ) );
+            m_numCommands++;
+        }
 
-            m_triangleCommands.reserve( m_triangleCommands.size() + buffer.m_triangleCommands.size() );
-            m_triangleCommands.insert( m_triangleCommands.end(), buffer.m_triangleCommands.begin(), buffer.m_triangleCommands.end() );
+        // Append all recorded commands in recording order, the destination is expected to already have the required capacity reserved
+        inline void AppendTo( TVector<T>& outCommands ) const
+        {
+            for ( int32_t i = 0; i <= m_currentChunkIdx; i++ )
+            {
+                outCommands.insert( outCommands.end(), m_chunks[i].begin(), m_chunks[i].end() );
+            }
+        }
 
-            m_textCommands.reserve( m_textCommands.size() + buffer.m_textCommands.size() );
-            m_textCommands.insert( m_textCommands.end(), buffer.m_textCommands.begin(), buffer.m_textCommands.end() );
+        // Empty all used chunks, the chunk memory is kept for the next frame
+        inline void Clear()
+        {
+            for ( int32_t i = 0; i <= m_currentChunkIdx; i++ )
+            {
+                m_chunks[i].clear();
+            }
+
+            m_currentChunkIdx = InvalidIndex;
+            m_numCommands = 0;
+        }
+
+    private:
+
+        inline void StartNewChunk()
+        {
+            m_currentChunkIdx++;
+            if ( m_currentChunkIdx == (int32_t) m_chunks.size() )
+            {
+                m_chunks.emplace_back().reserve( s_chunkSize );
+            }
         }
 
+    private:
+
+        TVector<TVector<T>>         m_chunks;
+        int32_t                     m_currentChunkIdx = InvalidIndex;
+        int32_t                     m_numCommands = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct ChunkedCommandBuffer
+    {
+        inline void Clear()
+        {
+            m_pointCommands.Clear();
+            m_lineCommands.Clear();
+            m_triangleCommands.Clear();
+            m_textCommands.Clear();
+        }
+
+    public:
+
+        TCommandChunkList<PointCommand>         m_pointCommands;
+        TCommandChunkList<LineCommand>          m_lineCommands;
+        TCommandChunkList<TriangleCommand>      m_triangleCommands;
+        TCommandChunkList<TextCommand>          m_textCommands;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct CommandBuffer
+    {
+        // Append the commands from a set of chunked buffers, each command list only grows once
+        void Merge( ChunkedCommandBuffer const* const* pBuffers, int32_t numBuffers );
+
         inline void Clear()
         {
             m_pointCommands.clear();
@@ -217,6 +290,7 @@ namespace EE::Drawing
             m_textCommands.clear();
         }
 
+        // Updates the TTL for all commands and compacts the surviving commands in place, this never reallocates
         void Reset( Seconds deltaTime );
 
     public:
@@ -231,6 +305,7 @@ namespace EE::Drawing
     // Per-Thread command buffer
     //-------------------------------------------------------------------------
     // These are fully cleared each frame
+    // Each buffer is only ever written to by its owning thread, so recording requires no synchronization
 
     class ThreadCommandBuffer
     {
@@ -245,26 +320,26 @@ namespace EE::Drawing
 
         EE_FORCE_INLINE void AddCommand( PointCommand&& cmd, DepthTestState depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
-            pBuffer->m_pointCommands.emplace_back( eastl::move( cmd ) );
+            ChunkedCommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            pBuffer->m_pointCommands.Add( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( LineCommand&& cmd, DepthTestState depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
-            pBuffer->m_lineCommands.emplace_back( eastl::move( cmd ) );
+            ChunkedCommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            pBuffer->m_lineCommands.Add( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( TriangleCommand&& cmd, DepthTestState depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
-            pBuffer->m_triangleCommands.emplace_back( eastl::move( cmd ) );
+            ChunkedCommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            pBuffer->m_triangleCommands.Add( eastl::move( cmd ) );
         }
 
         EE_FORCE_INLINE void AddCommand( TextCommand&& cmd, DepthTestState depthTestState )
         {
-            CommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
-            pBuffer->m_textCommands.emplace_back( eastl::move( cmd ) );
+            ChunkedCommandBuffer* pBuffer = GetCommandBuffer( depthTestState, cmd.IsTransparent() );
+            pBuffer->m_textCommands.Add( eastl::move( cmd ) );
         }
 
         inline void Clear()
@@ -275,16 +350,16 @@ namespace EE::Drawing
             m_transparentDepthOff.Clear();
         }
 
-        CommandBuffer const& GetOpaqueDepthTestEnabledBuffer() const { return m_opaqueDepthOn; }
-        CommandBuffer const& GetOpaqueDepthTestDisabledBuffer() const { return m_opaqueDepthOff; }
-        CommandBuffer const& GetTransparentDepthTestEnabledBuffer() const { return m_transparentDepthOn; }
-        CommandBuffer const& GetTransparentDepthTestDisabledBuffer() const { return m_transparentDepthOff; }
+        ChunkedCommandBuffer const& GetOpaqueDepthTestEnabledBuffer() const { return m_opaqueDepthOn; }
+        ChunkedCommandBuffer const& GetOpaqueDepthTestDisabledBuffer() const { return m_opaqueDepthOff; }
+        ChunkedCommandBuffer const& GetTransparentDepthTestEnabledBuffer() const { return m_transparentDepthOn; }
+        ChunkedCommandBuffer const& GetTransparentDepthTestDisabledBuffer() const { return m_transparentDepthOff; }
 
     private:
 
-        inline CommandBuffer* GetCommandBuffer( DepthTestState depthTestState, bool isTransparent )
+        inline ChunkedCommandBuffer* GetCommandBuffer( DepthTestState depthTestState, bool isTransparent )
         {
-            CommandBuffer* pBuffer = nullptr;
+            ChunkedCommandBuffer* pBuffer = nullptr;
 
             if ( depthTestState == DepthTestState::EnableDepthTest )
             {
@@ -301,10 +376,10 @@ namespace EE::Drawing
     private:
 
         Threading::ThreadID         m_ID;
-        CommandBuffer               m_opaqueDepthOn;
-        CommandBuffer               m_opaqueDepthOff;
-        CommandBuffer               m_transparentDepthOn;
-        CommandBuffer               m_transparentDepthOff;
+        ChunkedCommandBuffer        m_opaqueDepthOn;
+        ChunkedCommandBuffer        m_opaqueDepthOff;
+        ChunkedCommandBuffer        m_transparentDepthOn;
+        ChunkedCommandBuffer        m_transparentDepthOff;
     };
 
     //-------------------------------------------------------------------------
@@ -317,7 +392,8 @@ namespace EE::Drawing
     {
     public:
 
-        void AddThreadCommands( ThreadCommandBuffer const& threadCommands );
+        // Merge all the thread buffers into this buffer, each command list is sized once and then filled in a single pass
+        void AddThreadCommands( ThreadCommandBuffer const* const* pThreadBuffers, int32_t numThreadBuffers );
 
         // Empties the command buffer ignoring any TTL state
         inline void Clear()
@@ -328,7 +404,7 @@ namespace EE::Drawing
             m_transparentDepthOff.Clear();
         }
 
-        // Resets the buffer, will remove all commands with an expired TTL
+        // Resets the buffer, will remove all commands with an expired TTL and compact the remaining ones
         inline void Reset( Seconds deltaTime )
         {
             m_opaqueDepthOn.Reset( deltaTime );
@@ -1,59 +1,164 @@
 #include "DebugDrawingSystem.h"
+#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
-    ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
+    namespace
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
+        // The last buffer used by this thread, tagged with the owning system since multiple drawing systems can exist
+        struct ThreadBufferCache
+        {
+            uint32_t                m_systemID = 0;
+            ThreadCommandBuffer*    m_pBuffer = nullptr;
+        };
 
-        auto const threadID = Threading::GetCurrentThreadID();
+        static std::atomic<uint32_t> g_nextSystemID = 1;
+        static thread_local ThreadBufferCache g_threadBufferCache;
+    }
+
+    //-------------------------------------------------------------------------
+
+    DrawingSystem::DrawingSystem()
+        : m_systemID( g_nextSystemID.fetch_add( 1, std::memory_order_relaxed ) )
+    {}
+
+    DrawingSystem::~DrawingSystem()
+    {
+        int32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_acquire );
+        for ( int32_t i = 0; i < numBuffers; i++ )
+        {
+            EE::Delete( m_threadCommandBuffers[i] );
+        }
+
+        for ( auto& pBuffer : m_overflowThreadCommandBuffers )
+        {
+            EE::Delete( pBuffer );
+        }
+    }
 
-        // Check for an already created buffer for this thread
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+    //-------------------------------------------------------------------------
+
+    ThreadCommandBuffer* DrawingSystem::FindThreadCommandBuffer( Threading::ThreadID threadID, int32_t numBuffers ) const
+    {
+        for ( int32_t i = 0; i < numBuffers; i++ )
         {
-            if ( pThreadBuffer->GetThreadID() == threadID )
+            if ( m_threadCommandBuffers[i]->GetThreadID() == threadID )
             {
-                return *pThreadBuffer;
+                return m_threadCommandBuffers[i];
             }
         }
 
-        // Create a new buffer
-        auto& pThreadBuffer = m_threadCommandBuffers.emplace_back( EE::New<ThreadCommandBuffer>( threadID ) );
-        return *pThreadBuffer;
+        return nullptr;
     }
 
-    DrawingSystem::~DrawingSystem()
+    ThreadCommandBuffer* DrawingSystem::FindOverflowThreadCommandBuffer( Threading::ThreadID threadID ) const
     {
-        for ( auto& pBuffer : m_threadCommandBuffers )
+        for ( auto pBuffer : m_overflowThreadCommandBuffers )
         {
-            EE::Delete( pBuffer );
+            if ( pBuffer->GetThreadID() == threadID )
+            {
+                return pBuffer;
+            }
+        }
+
+        return nullptr;
+    }
+
+    ThreadCommandBuffer& DrawingSystem::GetThreadCommandBuffer()
+    {
+        // Fast path - this thread has already used this system
+        ThreadBufferCache& cache = g_threadBufferCache;
+        if ( cache.m_systemID == m_systemID )
+        {
+            return *cache.m_pBuffer;
+        }
+
+        // Search the published buffers, published slots are never reused so no lock is needed
+        auto const threadID = Threading::GetCurrentThreadID();
+        ThreadCommandBuffer* pThreadBuffer = FindThreadCommandBuffer( threadID, m_numThreadCommandBuffers.load( std::memory_order_acquire ) );
+
+        // Search the overflow list or create and publish a new buffer
+        if ( pThreadBuffer == nullptr )
+        {
+            Threading::ScopeLock Lock( m_registrationMutex );
+
+            int32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_relaxed );
+            pThreadBuffer = FindThreadCommandBuffer( threadID, numBuffers );
+            if ( pThreadBuffer == nullptr )
+            {
+                pThreadBuffer = FindOverflowThreadCommandBuffer( threadID );
+            }
+
+            if ( pThreadBuffer == nullptr )
+            {
+                pThreadBuffer = EE::New<ThreadCommandBuffer>( threadID );
+                if ( numBuffers < s_maxThreadBuffers )
+                {
+                    m_threadCommandBuffers[numBuffers] = pThreadBuffer;
+                    m_numThreadCommandBuffers.store( numBuffers + 1, std::memory_order_release );
+                }
+                else
+                {
+                    EE_LOG_WARNING( "Debug Drawing", "Drawing System", "More than %d threads have used the drawing system, falling back to the overflow list", s_maxThreadBuffers );
+                    m_overflowThreadCommandBuffers.emplace_back( pThreadBuffer );
+                }
+            }
         }
+
+        cache.m_systemID = m_systemID;
+        cache.m_pBuffer = pThreadBuffer;
+        return *pThreadBuffer;
     }
 
+    //-------------------------------------------------------------------------
+
     void DrawingSystem::ReflectFrameCommandBuffer( Seconds const deltaTime, FrameCommandBuffer& reflectedFrameCommands )
     {
         // Reset the frame buffer for a new frame, flush old commands and only keep ones with a valid TTL
         reflectedFrameCommands.Reset( deltaTime );
 
-        // Reflect all the new commands into the frame buffer
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        int32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_acquire );
+
+        // Reflect all the new commands into the frame buffer in a single pass
+        Threading::ScopeLock Lock( m_registrationMutex );
+        if ( m_overflowThreadCommandBuffers.empty() )
+        {
+            reflectedFrameCommands.AddThreadCommands( m_threadCommandBuffers, numBuffers );
+        }
+        else
+        {
+            TVector<ThreadCommandBuffer*> allBuffers( m_threadCommandBuffers, m_threadCommandBuffers + numBuffers );
+            allBuffers.insert( allBuffers.end(), m_overflowThreadCommandBuffers.begin(), m_overflowThreadCommandBuffers.end() );
+            reflectedFrameCommands.AddThreadCommands( allBuffers.data(), (int32_t) allBuffers.size() );
+        }
+
+        for ( int32_t i = 0; i < numBuffers; i++ )
+        {
+            m_threadCommandBuffers[i]->Clear();
+        }
+
+        for ( auto pBuffer : m_overflowThreadCommandBuffers )
         {
-            reflectedFrameCommands.AddThreadCommands( *pThreadBuffer );
-            pThreadBuffer->Clear();
+            pBuffer->Clear();
         }
     }
 
     void DrawingSystem::Reset()
     {
-        Threading::ScopeLock Lock( m_commandBufferMutex );
-        for ( auto& pThreadBuffer : m_threadCommandBuffers )
+        int32_t const numBuffers = m_numThreadCommandBuffers.load( std::memory_order_acquire );
+        for ( int32_t i = 0; i < numBuffers; i++ )
+        {
+            m_threadCommandBuffers[i]->Clear();
+        }
+
+        Threading::ScopeLock Lock( m_registrationMutex );
+        for ( auto pBuffer : m_overflowThreadCommandBuffers )
         {
-            pThreadBuffer->Clear();
+            pBuffer->Clear();
         }
     }
 }
-#endif
\ No newline at end of file
+#endif
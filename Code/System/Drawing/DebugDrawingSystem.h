@@ -3,18 +3,28 @@
 #include "System/_Module/API.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Threading/Threading.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
 
 #if EE_DEVELOPMENT_TOOLS
 namespace EE::Drawing
 {
+    //-------------------------------------------------------------------------
+    // Drawing System
+    //-------------------------------------------------------------------------
+    // Each thread records into its own command buffer, buffer lookup is lock-free and is cached per thread
+    // The lock is only taken the first time a thread draws, when its buffer is created and published
+    // Buffers are never released, so each thread that ever draws permanently uses up a buffer
+    // Once the fixed buffer array is full, any new threads get buffers in a locked overflow list instead
+
     class EE_SYSTEM_API DrawingSystem
     {
+        constexpr static int32_t const s_maxThreadBuffers = 64;
 
     public:
 
-        DrawingSystem() = default;
+        DrawingSystem();
         ~DrawingSystem();
 
         // Empty all per thread buffers
@@ -32,8 +42,18 @@ namespace EE::Drawing
 
     private:
 
-        TVector<ThreadCommandBuffer*>       m_threadCommandBuffers;
-        Threading::Mutex                    m_commandBufferMutex;
+        ThreadCommandBuffer* FindThreadCommandBuffer( Threading::ThreadID threadID, int32_t numBuffers ) const;
+
+        // Needs the registration lock to be held
+        ThreadCommandBuffer* FindOverflowThreadCommandBuffer( Threading::ThreadID threadID ) const;
+
+    private:
+
+        uint32_t                            m_systemID = 0;
+        ThreadCommandBuffer*                m_threadCommandBuffers[s_maxThreadBuffers] = {};
+        std::atomic<int32_t>                m_numThreadCommandBuffers = 0;
+        TVector<ThreadCommandBuffer*>       m_overflowThreadCommandBuffers; // Protected by the registration lock
+        Threading::Mutex                    m_registrationMutex;
     };
 }
 #endif
\ No newline at end of file
@@ -97,8 +97,9 @@ namespace EE::Quantization
     {
         EE_SERIALIZE( m_data0, m_data2 );
 
-    private:
+    public:
 
+        // Exposed so that vectorized decoders can match the scalar decoding exactly
         static constexpr float const s_valueRangeMin = -Math::OneDivSqrtTwo;
         static constexpr float const s_valueRangeMax = Math::OneDivSqrtTwo;
         static constexpr float const s_valueRangeLength = s_valueRangeMax - s_valueRangeMin;
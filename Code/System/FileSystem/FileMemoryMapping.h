@@ -0,0 +1,37 @@
+#pragma once
+
+#include "FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+// Memory Mapped File
+//-------------------------------------------------------------------------
+// A read-only view of an entire file, the OS pages the file data in on access
+// The mapped memory is valid until the file is closed
+
+namespace EE::FileSystem
+{
+    class EE_SYSTEM_API MemoryMappedFile
+    {
+    public:
+
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile() { Close(); }
+
+        MemoryMappedFile( MemoryMappedFile const& ) = delete;
+        MemoryMappedFile& operator=( MemoryMappedFile const& ) = delete;
+
+        bool Open( Path const& filePath );
+        void Close();
+
+        inline bool IsOpen() const { return m_pData != nullptr; }
+        inline uint8_t const* GetData() const { EE_ASSERT( IsOpen() ); return m_pData; }
+        inline size_t GetSize() const { EE_ASSERT( IsOpen() ); return m_size; }
+
+    private:
+
+        uint8_t const*          m_pData = nullptr;
+        size_t                  m_size = 0;
+        void*                   m_pFileHandle = nullptr;
+        void*                   m_pMappingHandle = nullptr;
+    };
+}
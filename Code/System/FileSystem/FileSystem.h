@@ -55,10 +55,17 @@ namespace EE::FileSystem
 
     EE_SYSTEM_API uint64_t GetFileModifiedTime( char const* filePath );
     EE_FORCE_INLINE uint64_t GetFileModifiedTime( String const& filePath ) { return GetFileModifiedTime( filePath.c_str() ); }
+
+    EE_SYSTEM_API uint64_t GetFileSize( char const* filePath );
+    EE_FORCE_INLINE uint64_t GetFileSize( String const& filePath ) { return GetFileSize( filePath.c_str() ); }
     
     EE_SYSTEM_API bool EraseFile( char const* filePath );
     EE_FORCE_INLINE bool EraseFile( String const& filePath ) { return EraseFile( filePath.c_str() ); }
 
+    // Copy a file, overwriting the destination file if it exists
+    EE_SYSTEM_API bool DuplicateFile( char const* sourceFilePath, char const* destinationFilePath );
+    EE_FORCE_INLINE bool DuplicateFile( String const& sourceFilePath, String const& destinationFilePath ) { return DuplicateFile( sourceFilePath.c_str(), destinationFilePath.c_str() ); }
+
     EE_SYSTEM_API bool LoadFile( char const* filePath, Blob& fileData );
     EE_FORCE_INLINE bool LoadFile( String const& filePath, Blob& fileData ) { return LoadFile( filePath.c_str(), fileData ); }
     
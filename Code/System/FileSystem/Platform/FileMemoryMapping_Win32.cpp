@@ -0,0 +1,69 @@
+#ifdef _WIN32
+#include "../FileMemoryMapping.h"
+#include <windows.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    bool MemoryMappedFile::Open( Path const& filePath )
+    {
+        EE_ASSERT( filePath.IsFilePath() );
+        EE_ASSERT( !IsOpen() );
+
+        // Open file handle
+        HANDLE hFile = CreateFile( filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr );
+        if ( hFile == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        // Get file size - empty files cannot be mapped
+        LARGE_INTEGER fileSizeLI;
+        if ( !GetFileSizeEx( hFile, &fileSizeLI ) || fileSizeLI.QuadPart == 0 )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        // Map the entire file
+        HANDLE hMapping = CreateFileMapping( hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( hMapping == nullptr )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        void* pView = MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+        if ( pView == nullptr )
+        {
+            CloseHandle( hMapping );
+            CloseHandle( hFile );
+            return false;
+        }
+
+        m_pData = (uint8_t const*) pView;
+        m_size = (size_t) fileSizeLI.QuadPart;
+        m_pFileHandle = hFile;
+        m_pMappingHandle = hMapping;
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if ( !IsOpen() )
+        {
+            return;
+        }
+
+        UnmapViewOfFile( m_pData );
+        CloseHandle( (HANDLE) m_pMappingHandle );
+        CloseHandle( (HANDLE) m_pFileHandle );
+
+        m_pData = nullptr;
+        m_size = 0;
+        m_pFileHandle = nullptr;
+        m_pMappingHandle = nullptr;
+    }
+}
+#endif
@@ -127,6 +127,23 @@ namespace EE::FileSystem
         return fileWriteTime.QuadPart;
     }
 
+    uint64_t GetFileSize( char const* path )
+    {
+        ULARGE_INTEGER fileSize;
+        fileSize.QuadPart = 0;
+
+        WIN32_FIND_DATAA findData;
+        HANDLE hFind = FindFirstFileA( path, &findData );
+        if ( hFind != INVALID_HANDLE_VALUE )
+        {
+            fileSize.LowPart = findData.nFileSizeLow;
+            fileSize.HighPart = findData.nFileSizeHigh;
+            FindClose( hFind );
+        }
+
+        return fileSize.QuadPart;
+    }
+
     //-------------------------------------------------------------------------
 
     bool CreateDir( char const* path )
@@ -150,6 +167,11 @@ namespace EE::FileSystem
         return DeleteFile( path );
     }
 
+    bool DuplicateFile( char const* sourcePath, char const* destinationPath )
+    {
+        return CopyFileA( sourcePath, destinationPath, FALSE ) != 0;
+    }
+
     //-------------------------------------------------------------------------
 
     bool LoadFile( char const* pPath, Blob& fileData )
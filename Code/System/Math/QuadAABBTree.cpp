@@ -0,0 +1,884 @@
+#include "QuadAABBTree.h"
+#include "System/Math/SIMD.h"
+#include "System/Types/Color.h"
+#include "System/Drawing/DebugDrawing.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Math
+{
+    // We only need relative costs so the constant factor is dropped
+    EE_FORCE_INLINE static float GetSurfaceArea( Vector const& min, Vector const& max )
+    {
+        Float3 const size = ( max - min ).ToFloat3();
+        return ( size.m_x * size.m_y ) + ( size.m_y * size.m_z ) + ( size.m_z * size.m_x );
+    }
+
+    EE_FORCE_INLINE static float GetSurfaceArea( AABB const& box )
+    {
+        return GetSurfaceArea( box.GetMin(), box.GetMax() );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void QuadAABBTree::Clear()
+    {
+        m_nodes.clear();
+        m_leaves.clear();
+        m_freeNodes.clear();
+        m_freeLeaves.clear();
+        m_userDataToLeafMap.clear();
+        m_rootNodeIdx = InvalidIndex;
+    }
+
+    int32_t QuadAABBTree::RequestNode( int32_t parentNodeIdx )
+    {
+        int32_t nodeIdx = InvalidIndex;
+        if ( m_freeNodes.empty() )
+        {
+            nodeIdx = (int32_t) m_nodes.size();
+            m_nodes.emplace_back();
+        }
+        else
+        {
+            nodeIdx = m_freeNodes.back();
+            m_freeNodes.pop_back();
+            new ( &m_nodes[nodeIdx] ) Node();
+        }
+
+        m_nodes[nodeIdx].m_parentNodeIdx = parentNodeIdx;
+        return nodeIdx;
+    }
+
+    void QuadAABBTree::ReleaseNode( int32_t nodeIdx )
+    {
+        EE_ASSERT( nodeIdx >= 0 && nodeIdx < (int32_t) m_nodes.size() );
+        m_nodes[nodeIdx].m_numChildren = 0;
+        m_freeNodes.emplace_back( nodeIdx );
+    }
+
+    int32_t QuadAABBTree::RequestLeaf( AABB const& bounds, uint64_t userData )
+    {
+        // All boxes must have a non-zero unique userdata value as that is also used as the ID
+        EE_ASSERT( bounds.IsValid() );
+        EE_ASSERT( userData != 0 && m_userDataToLeafMap.find( userData ) == m_userDataToLeafMap.end() );
+
+        int32_t leafIdx = InvalidIndex;
+        if ( m_freeLeaves.empty() )
+        {
+            leafIdx = (int32_t) m_leaves.size();
+            m_leaves.emplace_back();
+        }
+        else
+        {
+            leafIdx = m_freeLeaves.back();
+            m_freeLeaves.pop_back();
+        }
+
+        Leaf& leaf = m_leaves[leafIdx];
+        leaf.m_bounds = bounds;
+        leaf.m_userData = userData;
+        leaf.m_parentNodeIdx = InvalidIndex;
+
+        m_userDataToLeafMap.insert( TPair<uint64_t, int32_t>( userData, leafIdx ) );
+        return leafIdx;
+    }
+
+    void QuadAABBTree::ReleaseLeaf( int32_t leafIdx )
+    {
+        EE_ASSERT( leafIdx >= 0 && leafIdx < (int32_t) m_leaves.size() );
+        m_userDataToLeafMap.erase( m_leaves[leafIdx].m_userData );
+        m_leaves[leafIdx].m_userData = 0;
+        m_freeLeaves.emplace_back( leafIdx );
+    }
+
+    //-------------------------------------------------------------------------
+
+    AABB QuadAABBTree::GetChildBounds( int32_t nodeIdx, int32_t slotIdx ) const
+    {
+        Node const& node = m_nodes[nodeIdx];
+        EE_ASSERT( slotIdx >= 0 && slotIdx < node.m_numChildren );
+        Vector const min( node.m_minX[slotIdx], node.m_minY[slotIdx], node.m_minZ[slotIdx] );
+        Vector const max( node.m_maxX[slotIdx], node.m_maxY[slotIdx], node.m_maxZ[slotIdx] );
+        return AABB::FromMinMax( min, max );
+    }
+
+    AABB QuadAABBTree::GetNodeBounds( int32_t nodeIdx ) const
+    {
+        Node const& node = m_nodes[nodeIdx];
+        EE_ASSERT( node.m_numChildren > 0 );
+
+        Vector min( node.m_minX[0], node.m_minY[0], node.m_minZ[0] );
+        Vector max( node.m_maxX[0], node.m_maxY[0], node.m_maxZ[0] );
+        for ( int32_t slotIdx = 1; slotIdx < node.m_numChildren; slotIdx++ )
+        {
+            min = Vector::Min( min, Vector( node.m_minX[slotIdx], node.m_minY[slotIdx], node.m_minZ[slotIdx] ) );
+            max = Vector::Max( max, Vector( node.m_maxX[slotIdx], node.m_maxY[slotIdx], node.m_maxZ[slotIdx] ) );
+        }
+
+        return AABB::FromMinMax( min, max );
+    }
+
+    int32_t QuadAABBTree::FindChildSlot( int32_t nodeIdx, int32_t childRef ) const
+    {
+        Node const& node = m_nodes[nodeIdx];
+        for ( int32_t slotIdx = 0; slotIdx < node.m_numChildren; slotIdx++ )
+        {
+            if ( node.m_children[slotIdx] == childRef )
+            {
+                return slotIdx;
+            }
+        }
+
+        EE_UNREACHABLE_CODE();
+        return InvalidIndex;
+    }
+
+    void QuadAABBTree::SetChildBounds( int32_t nodeIdx, int32_t slotIdx, AABB const& bounds )
+    {
+        Float3 const min = bounds.GetMin().ToFloat3();
+        Float3 const max = bounds.GetMax().ToFloat3();
+
+        Node& node = m_nodes[nodeIdx];
+        node.m_minX[slotIdx] = min.m_x;
+        node.m_minY[slotIdx] = min.m_y;
+        node.m_minZ[slotIdx] = min.m_z;
+        node.m_maxX[slotIdx] = max.m_x;
+        node.m_maxY[slotIdx] = max.m_y;
+        node.m_maxZ[slotIdx] = max.m_z;
+    }
+
+    void QuadAABBTree::SetChild( int32_t nodeIdx, int32_t slotIdx, int32_t childRef, AABB const& bounds )
+    {
+        m_nodes[nodeIdx].m_children[slotIdx] = childRef;
+        SetChildBounds( nodeIdx, slotIdx, bounds );
+
+        if ( IsLeaf( childRef ) )
+        {
+            m_leaves[DecodeLeaf( childRef )].m_parentNodeIdx = nodeIdx;
+        }
+        else
+        {
+            m_nodes[childRef].m_parentNodeIdx = nodeIdx;
+        }
+    }
+
+    void QuadAABBTree::AddChild( int32_t nodeIdx, int32_t childRef, AABB const& bounds )
+    {
+        EE_ASSERT( m_nodes[nodeIdx].m_numChildren < 4 );
+        int32_t const slotIdx = m_nodes[nodeIdx].m_numChildren++;
+        SetChild( nodeIdx, slotIdx, childRef, bounds );
+    }
+
+    void QuadAABBTree::RemoveChild( int32_t nodeIdx, int32_t slotIdx )
+    {
+        Node& node = m_nodes[nodeIdx];
+        EE_ASSERT( slotIdx >= 0 && slotIdx < node.m_numChildren );
+
+        // Keep the children packed by moving the last child into the freed slot
+        int32_t const lastSlotIdx = node.m_numChildren - 1;
+        if ( slotIdx != lastSlotIdx )
+        {
+            node.m_children[slotIdx] = node.m_children[lastSlotIdx];
+            node.m_minX[slotIdx] = node.m_minX[lastSlotIdx];
+            node.m_minY[slotIdx] = node.m_minY[lastSlotIdx];
+            node.m_minZ[slotIdx] = node.m_minZ[lastSlotIdx];
+            node.m_maxX[slotIdx] = node.m_maxX[lastSlotIdx];
+            node.m_maxY[slotIdx] = node.m_maxY[lastSlotIdx];
+            node.m_maxZ[slotIdx] = node.m_maxZ[lastSlotIdx];
+        }
+
+        node.m_children[lastSlotIdx] = InvalidIndex;
+        node.m_numChildren--;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void QuadAABBTree::InsertBox( AABB const& aabb, uint64_t userData )
+    {
+        int32_t const leafIdx = RequestLeaf( aabb, userData );
+        InsertLeaf( leafIdx );
+    }
+
+    void QuadAABBTree::RemoveBox( uint64_t userData )
+    {
+        auto iter = m_userDataToLeafMap.find( userData );
+        EE_ASSERT( iter != m_userDataToLeafMap.end() );
+        int32_t const leafIdx = iter->second;
+
+        RemoveLeaf( leafIdx );
+        ReleaseLeaf( leafIdx );
+    }
+
+    void QuadAABBTree::UpdateBox( uint64_t userData, AABB const& newBounds )
+    {
+        EE_ASSERT( newBounds.IsValid() );
+
+        auto iter = m_userDataToLeafMap.find( userData );
+        EE_ASSERT( iter != m_userDataToLeafMap.end() );
+        int32_t const leafIdx = iter->second;
+        int32_t const parentNodeIdx = m_leaves[leafIdx].m_parentNodeIdx;
+        m_leaves[leafIdx].m_bounds = newBounds;
+
+        // Small moves are refit in place, boxes that leave their parent are reinserted so the tree doesn't degrade
+        AABB const parentBounds = GetNodeBounds( parentNodeIdx );
+        if ( newBounds.GetMin().IsGreaterThanEqual3( parentBounds.GetMin() ) && newBounds.GetMax().IsLessThanEqual3( parentBounds.GetMax() ) )
+        {
+            SetChildBounds( parentNodeIdx, FindChildSlot( parentNodeIdx, EncodeLeaf( leafIdx ) ), newBounds );
+            RefitAncestors( parentNodeIdx );
+        }
+        else
+        {
+            RemoveLeaf( leafIdx );
+            InsertLeaf( leafIdx );
+        }
+    }
+
+    void QuadAABBTree::InsertLeaf( int32_t leafIdx )
+    {
+        int32_t const leafRef = EncodeLeaf( leafIdx );
+        AABB const bounds = m_leaves[leafIdx].m_bounds;
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            m_rootNodeIdx = RequestNode( InvalidIndex );
+            AddChild( m_rootNodeIdx, leafRef, bounds );
+            return;
+        }
+
+        // Descend until we find a node with a free slot
+        //-------------------------------------------------------------------------
+
+        Vector const boundsMin = bounds.GetMin();
+        Vector const boundsMax = bounds.GetMax();
+        Vector const boundsMinX = boundsMin.GetSplatX(), boundsMinY = boundsMin.GetSplatY(), boundsMinZ = boundsMin.GetSplatZ();
+        Vector const boundsMaxX = boundsMax.GetSplatX(), boundsMaxY = boundsMax.GetSplatY(), boundsMaxZ = boundsMax.GetSplatZ();
+
+        int32_t nodeIdx = m_rootNodeIdx;
+        while ( m_nodes[nodeIdx].m_numChildren == 4 )
+        {
+            Node const& node = m_nodes[nodeIdx];
+
+            // Calculate the surface area increase for all four children at once
+            Vector const minX = _mm_load_ps( node.m_minX ), minY = _mm_load_ps( node.m_minY ), minZ = _mm_load_ps( node.m_minZ );
+            Vector const maxX = _mm_load_ps( node.m_maxX ), maxY = _mm_load_ps( node.m_maxY ), maxZ = _mm_load_ps( node.m_maxZ );
+            Vector const sizeX = maxX - minX, sizeY = maxY - minY, sizeZ = maxZ - minZ;
+            Vector const combinedSizeX = Vector::Max( maxX, boundsMaxX ) - Vector::Min( minX, boundsMinX );
+            Vector const combinedSizeY = Vector::Max( maxY, boundsMaxY ) - Vector::Min( minY, boundsMinY );
+            Vector const combinedSizeZ = Vector::Max( maxZ, boundsMaxZ ) - Vector::Min( minZ, boundsMinZ );
+            Vector const area = Vector::MultiplyAdd( sizeX, sizeY, Vector::MultiplyAdd( sizeY, sizeZ, sizeZ * sizeX ) );
+            Vector const combinedArea = Vector::MultiplyAdd( combinedSizeX, combinedSizeY, Vector::MultiplyAdd( combinedSizeY, combinedSizeZ, combinedSizeZ * combinedSizeX ) );
+            Float4 const costs = ( combinedArea - area ).ToFloat4();
+
+            // Pick the child whose surface area increases the least
+            int32_t bestSlotIdx = 0;
+            for ( int32_t slotIdx = 1; slotIdx < 4; slotIdx++ )
+            {
+                if ( costs[slotIdx] < costs[bestSlotIdx] )
+                {
+                    bestSlotIdx = slotIdx;
+                }
+            }
+
+            // Replace the best leaf with a new node containing both it and the new leaf
+            int32_t const childRef = m_nodes[nodeIdx].m_children[bestSlotIdx];
+            if ( IsLeaf( childRef ) )
+            {
+                AABB const childBounds = GetChildBounds( nodeIdx, bestSlotIdx );
+                int32_t const newNodeIdx = RequestNode( nodeIdx );
+                AddChild( newNodeIdx, childRef, childBounds );
+                SetChild( nodeIdx, bestSlotIdx, newNodeIdx, childBounds );
+                nodeIdx = newNodeIdx;
+            }
+            else
+            {
+                nodeIdx = childRef;
+            }
+        }
+
+        AddChild( nodeIdx, leafRef, bounds );
+        RefitAncestors( nodeIdx );
+    }
+
+    void QuadAABBTree::RemoveLeaf( int32_t leafIdx )
+    {
+        int32_t nodeIdx = m_leaves[leafIdx].m_parentNodeIdx;
+        RemoveChild( nodeIdx, FindChildSlot( nodeIdx, EncodeLeaf( leafIdx ) ) );
+        m_leaves[leafIdx].m_parentNodeIdx = InvalidIndex;
+
+        int32_t const numRemainingChildren = m_nodes[nodeIdx].m_numChildren;
+        int32_t const parentNodeIdx = m_nodes[nodeIdx].m_parentNodeIdx;
+
+        // Only the root can ever become empty, since we collapse any non-root nodes that have a single child
+        if ( numRemainingChildren == 0 )
+        {
+            EE_ASSERT( nodeIdx == m_rootNodeIdx );
+            ReleaseNode( nodeIdx );
+            m_rootNodeIdx = InvalidIndex;
+            return;
+        }
+
+        if ( numRemainingChildren == 1 )
+        {
+            int32_t const remainingChildRef = m_nodes[nodeIdx].m_children[0];
+
+            // Replace this node with its remaining child
+            if ( parentNodeIdx != InvalidIndex )
+            {
+                AABB const childBounds = GetChildBounds( nodeIdx, 0 );
+                SetChild( parentNodeIdx, FindChildSlot( parentNodeIdx, nodeIdx ), remainingChildRef, childBounds );
+                ReleaseNode( nodeIdx );
+                nodeIdx = parentNodeIdx;
+            }
+            // Promote the remaining node to be the new root
+            else if ( !IsLeaf( remainingChildRef ) )
+            {
+                m_nodes[remainingChildRef].m_parentNodeIdx = InvalidIndex;
+                m_rootNodeIdx = remainingChildRef;
+                ReleaseNode( nodeIdx );
+                return;
+            }
+        }
+
+        RefitAncestors( nodeIdx );
+    }
+
+    void QuadAABBTree::RefitAncestors( int32_t nodeIdx )
+    {
+        while ( nodeIdx != InvalidIndex )
+        {
+            TryRotate( nodeIdx );
+
+            int32_t const parentNodeIdx = m_nodes[nodeIdx].m_parentNodeIdx;
+            if ( parentNodeIdx != InvalidIndex )
+            {
+                SetChildBounds( parentNodeIdx, FindChildSlot( parentNodeIdx, nodeIdx ), GetNodeBounds( nodeIdx ) );
+            }
+
+            nodeIdx = parentNodeIdx;
+        }
+    }
+
+    void QuadAABBTree::TryRotate( int32_t nodeIdx )
+    {
+        // Try swapping a child with one of its sibling's children (i.e. a grandchild of this node)
+        // This only changes the bounds of the sibling node, so we pick the swap that reduces the sibling's surface area the most
+        //-------------------------------------------------------------------------
+
+        Node const& node = m_nodes[nodeIdx];
+        int32_t const numChildren = node.m_numChildren;
+
+        Vector childMins[4], childMaxs[4];
+        for ( int32_t i = 0; i < numChildren; i++ )
+        {
+            childMins[i] = Vector( node.m_minX[i], node.m_minY[i], node.m_minZ[i] );
+            childMaxs[i] = Vector( node.m_maxX[i], node.m_maxY[i], node.m_maxZ[i] );
+        }
+
+        float bestGain = 0.0f;
+        int32_t bestChildSlotIdx = InvalidIndex;
+        int32_t bestSiblingSlotIdx = InvalidIndex;
+        int32_t bestGrandchildSlotIdx = InvalidIndex;
+
+        for ( int32_t siblingSlotIdx = 0; siblingSlotIdx < numChildren; siblingSlotIdx++ )
+        {
+            int32_t const siblingNodeIdx = node.m_children[siblingSlotIdx];
+            if ( IsLeaf( siblingNodeIdx ) )
+            {
+                continue;
+            }
+
+            Node const& siblingNode = m_nodes[siblingNodeIdx];
+            float const siblingArea = GetSurfaceArea( childMins[siblingSlotIdx], childMaxs[siblingSlotIdx] );
+
+            // Calculate the bounds of the sibling without each of its children
+            Vector siblingMinsWithout[4], siblingMaxsWithout[4];
+            for ( int32_t grandchildSlotIdx = 0; grandchildSlotIdx < siblingNode.m_numChildren; grandchildSlotIdx++ )
+            {
+                siblingMinsWithout[grandchildSlotIdx] = Vector( FLT_MAX );
+                siblingMaxsWithout[grandchildSlotIdx] = Vector( -FLT_MAX );
+                for ( int32_t i = 0; i < siblingNode.m_numChildren; i++ )
+                {
+                    if ( i != grandchildSlotIdx )
+                    {
+                        siblingMinsWithout[grandchildSlotIdx] = Vector::Min( siblingMinsWithout[grandchildSlotIdx], Vector( siblingNode.m_minX[i], siblingNode.m_minY[i], siblingNode.m_minZ[i] ) );
+                        siblingMaxsWithout[grandchildSlotIdx] = Vector::Max( siblingMaxsWithout[grandchildSlotIdx], Vector( siblingNode.m_maxX[i], siblingNode.m_maxY[i], siblingNode.m_maxZ[i] ) );
+                    }
+                }
+            }
+
+            for ( int32_t childSlotIdx = 0; childSlotIdx < numChildren; childSlotIdx++ )
+            {
+                if ( childSlotIdx == siblingSlotIdx )
+                {
+                    continue;
+                }
+
+                for ( int32_t grandchildSlotIdx = 0; grandchildSlotIdx < siblingNode.m_numChildren; grandchildSlotIdx++ )
+                {
+                    // The sibling's area if the child replaced this grandchild
+                    Vector const newSiblingMin = Vector::Min( siblingMinsWithout[grandchildSlotIdx], childMins[childSlotIdx] );
+                    Vector const newSiblingMax = Vector::Max( siblingMaxsWithout[grandchildSlotIdx], childMaxs[childSlotIdx] );
+                    float const gain = siblingArea - GetSurfaceArea( newSiblingMin, newSiblingMax );
+                    if ( gain > bestGain )
+                    {
+                        bestGain = gain;
+                        bestChildSlotIdx = childSlotIdx;
+                        bestSiblingSlotIdx = siblingSlotIdx;
+                        bestGrandchildSlotIdx = grandchildSlotIdx;
+                    }
+                }
+            }
+        }
+
+        // Perform the rotation
+        //-------------------------------------------------------------------------
+
+        if ( bestChildSlotIdx != InvalidIndex )
+        {
+            int32_t const siblingNodeIdx = m_nodes[nodeIdx].m_children[bestSiblingSlotIdx];
+            int32_t const childRef = m_nodes[nodeIdx].m_children[bestChildSlotIdx];
+            int32_t const grandchildRef = m_nodes[siblingNodeIdx].m_children[bestGrandchildSlotIdx];
+            AABB const childBounds = GetChildBounds( nodeIdx, bestChildSlotIdx );
+            AABB const grandchildBounds = GetChildBounds( siblingNodeIdx, bestGrandchildSlotIdx );
+
+            SetChild( siblingNodeIdx, bestGrandchildSlotIdx, childRef, childBounds );
+            SetChild( nodeIdx, bestChildSlotIdx, grandchildRef, grandchildBounds );
+            SetChildBounds( nodeIdx, bestSiblingSlotIdx, GetNodeBounds( siblingNodeIdx ) );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void QuadAABBTree::Build( TVector<AABB> const& bounds, TVector<uint64_t> const& userData )
+    {
+        EE_ASSERT( bounds.size() == userData.size() );
+
+        Clear();
+
+        uint32_t const numBoxes = (uint32_t) bounds.size();
+        if ( numBoxes == 0 )
+        {
+            return;
+        }
+
+        m_leaves.reserve( numBoxes );
+        m_nodes.reserve( numBoxes / 2 + 1 );
+        m_buildOrder.resize( numBoxes );
+        for ( uint32_t i = 0; i < numBoxes; i++ )
+        {
+            m_buildOrder[i] = RequestLeaf( bounds[i], userData[i] );
+        }
+
+        m_rootNodeIdx = BuildSubtree( InvalidIndex, 0, numBoxes );
+    }
+
+    int32_t QuadAABBTree::BuildSubtree( int32_t parentNodeIdx, uint32_t begin, uint32_t end )
+    {
+        EE_ASSERT( end > begin );
+
+        int32_t const nodeIdx = RequestNode( parentNodeIdx );
+
+        if ( end - begin <= 4 )
+        {
+            for ( uint32_t i = begin; i < end; i++ )
+            {
+                AddChild( nodeIdx, EncodeLeaf( m_buildOrder[i] ), m_leaves[m_buildOrder[i]].m_bounds );
+            }
+            return nodeIdx;
+        }
+
+        // Two levels of binary SAH splits give us the (up to) four children of this node
+        //-------------------------------------------------------------------------
+
+        uint32_t const mid = PartitionSAH( begin, end );
+        uint32_t const halves[3] = { begin, mid, end };
+
+        for ( int32_t h = 0; h < 2; h++ )
+        {
+            uint32_t const halfBegin = halves[h];
+            uint32_t const halfEnd = halves[h + 1];
+            uint32_t const quarterMid = ( halfEnd - halfBegin > 1 ) ? PartitionSAH( halfBegin, halfEnd ) : halfEnd;
+            uint32_t const quarters[3] = { halfBegin, quarterMid, halfEnd };
+
+            for ( int32_t q = 0; q < 2; q++ )
+            {
+                uint32_t const quarterBegin = quarters[q];
+                uint32_t const quarterEnd = quarters[q + 1];
+                if ( quarterBegin == quarterEnd )
+                {
+                    continue;
+                }
+
+                if ( quarterEnd - quarterBegin == 1 )
+                {
+                    AddChild( nodeIdx, EncodeLeaf( m_buildOrder[quarterBegin] ), m_leaves[m_buildOrder[quarterBegin]].m_bounds );
+                }
+                else
+                {
+                    int32_t const childNodeIdx = BuildSubtree( nodeIdx, quarterBegin, quarterEnd );
+                    AddChild( nodeIdx, childNodeIdx, GetNodeBounds( childNodeIdx ) );
+                }
+            }
+        }
+
+        return nodeIdx;
+    }
+
+    uint32_t QuadAABBTree::PartitionSAH( uint32_t begin, uint32_t end )
+    {
+        EE_ASSERT( end - begin > 1 );
+        uint32_t const medianIdx = begin + ( end - begin ) / 2;
+
+        // Bin the boxes by their centers along the longest axis of the center bounds
+        //-------------------------------------------------------------------------
+
+        Vector centersMin = m_leaves[m_buildOrder[begin]].m_bounds.GetCenter();
+        Vector centersMax = centersMin;
+        for ( uint32_t i = begin + 1; i < end; i++ )
+        {
+            Vector const& center = m_leaves[m_buildOrder[i]].m_bounds.GetCenter();
+            centersMin = Vector::Min( centersMin, center );
+            centersMax = Vector::Max( centersMax, center );
+        }
+
+        Float3 const centersRange = ( centersMax - centersMin ).ToFloat3();
+        int32_t axis = ( centersRange.m_x > centersRange.m_y ) ? 0 : 1;
+        axis = ( centersRange.m_z > centersRange[axis] ) ? 2 : axis;
+
+        // All the centers are coincident, so any split is as good as any other
+        if ( centersRange[axis] <= Math::Epsilon )
+        {
+            return medianIdx;
+        }
+
+        struct Bin
+        {
+            Vector      m_min = Vector( FLT_MAX );
+            Vector      m_max = Vector( -FLT_MAX );
+            uint32_t    m_count = 0;
+        };
+
+        Bin bins[s_numSAHBins];
+        float const axisMin = centersMin.ToFloat3()[axis];
+        float const binScale = ( s_numSAHBins * 0.9999f ) / centersRange[axis];
+        auto GetBinIdx = [&] ( int32_t leafIdx )
+        {
+            float const center = m_leaves[leafIdx].m_bounds.GetCenter().ToFloat3()[axis];
+            return Math::Min( (int32_t) ( ( center - axisMin ) * binScale ), s_numSAHBins - 1 );
+        };
+
+        for ( uint32_t i = begin; i < end; i++ )
+        {
+            AABB const& bounds = m_leaves[m_buildOrder[i]].m_bounds;
+            Bin& bin = bins[GetBinIdx( m_buildOrder[i] )];
+            bin.m_min = Vector::Min( bin.m_min, bounds.GetMin() );
+            bin.m_max = Vector::Max( bin.m_max, bounds.GetMax() );
+            bin.m_count++;
+        }
+
+        // Evaluate the cost of splitting after each bin
+        //-------------------------------------------------------------------------
+
+        float rightCosts[s_numSAHBins] = {};
+        Vector accumulatedMin( FLT_MAX ), accumulatedMax( -FLT_MAX );
+        uint32_t accumulatedCount = 0;
+        for ( int32_t binIdx = s_numSAHBins - 1; binIdx > 0; binIdx-- )
+        {
+            accumulatedMin = Vector::Min( accumulatedMin, bins[binIdx].m_min );
+            accumulatedMax = Vector::Max( accumulatedMax, bins[binIdx].m_max );
+            accumulatedCount += bins[binIdx].m_count;
+            rightCosts[binIdx] = ( accumulatedCount > 0 ) ? GetSurfaceArea( accumulatedMin, accumulatedMax ) * accumulatedCount : 0.0f;
+        }
+
+        int32_t bestSplitBinIdx = InvalidIndex;
+        float bestCost = FLT_MAX;
+        accumulatedMin = Vector( FLT_MAX );
+        accumulatedMax = Vector( -FLT_MAX );
+        accumulatedCount = 0;
+        for ( int32_t binIdx = 1; binIdx < s_numSAHBins; binIdx++ )
+        {
+            accumulatedMin = Vector::Min( accumulatedMin, bins[binIdx - 1].m_min );
+            accumulatedMax = Vector::Max( accumulatedMax, bins[binIdx - 1].m_max );
+            accumulatedCount += bins[binIdx - 1].m_count;
+
+            if ( accumulatedCount == 0 || accumulatedCount == ( end - begin ) )
+            {
+                continue;
+            }
+
+            float const cost = GetSurfaceArea( accumulatedMin, accumulatedMax ) * accumulatedCount + rightCosts[binIdx];
+            if ( cost < bestCost )
+            {
+                bestCost = cost;
+                bestSplitBinIdx = binIdx;
+            }
+        }
+
+        if ( bestSplitBinIdx == InvalidIndex )
+        {
+            return medianIdx;
+        }
+
+        // Partition the boxes around the split
+        //-------------------------------------------------------------------------
+
+        uint32_t splitIdx = begin;
+        for ( uint32_t i = begin; i < end; i++ )
+        {
+            if ( GetBinIdx( m_buildOrder[i] ) < bestSplitBinIdx )
+            {
+                eastl::swap( m_buildOrder[i], m_buildOrder[splitIdx] );
+                splitIdx++;
+            }
+        }
+
+        EE_ASSERT( splitIdx > begin && splitIdx < end );
+        return splitIdx;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void QuadAABBTree::SetBoxBounds( uint64_t userData, AABB const& newBounds )
+    {
+        EE_ASSERT( newBounds.IsValid() );
+
+        auto iter = m_userDataToLeafMap.find( userData );
+        EE_ASSERT( iter != m_userDataToLeafMap.end() );
+        int32_t const leafIdx = iter->second;
+
+        m_leaves[leafIdx].m_bounds = newBounds;
+        int32_t const parentNodeIdx = m_leaves[leafIdx].m_parentNodeIdx;
+        SetChildBounds( parentNodeIdx, FindChildSlot( parentNodeIdx, EncodeLeaf( leafIdx ) ), newBounds );
+    }
+
+    void QuadAABBTree::Refit()
+    {
+        if ( m_rootNodeIdx != InvalidIndex )
+        {
+            RefitSubtree( m_rootNodeIdx );
+        }
+    }
+
+    AABB QuadAABBTree::RefitSubtree( int32_t nodeIdx )
+    {
+        int32_t const numChildren = m_nodes[nodeIdx].m_numChildren;
+        for ( int32_t slotIdx = 0; slotIdx < numChildren; slotIdx++ )
+        {
+            int32_t const childRef = m_nodes[nodeIdx].m_children[slotIdx];
+            if ( !IsLeaf( childRef ) )
+            {
+                SetChildBounds( nodeIdx, slotIdx, RefitSubtree( childRef ) );
+            }
+        }
+
+        return GetNodeBounds( nodeIdx );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool QuadAABBTree::FindOverlaps( AABB const& queryBox, TVector<uint64_t>& outResults ) const
+    {
+        outResults.clear();
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        Vector const queryMin = queryBox.GetMin();
+        Vector const queryMax = queryBox.GetMax();
+        __m128 const queryMinX = queryMin.GetSplatX();
+        __m128 const queryMinY = queryMin.GetSplatY();
+        __m128 const queryMinZ = queryMin.GetSplatZ();
+        __m128 const queryMaxX = queryMax.GetSplatX();
+        __m128 const queryMaxY = queryMax.GetSplatY();
+        __m128 const queryMaxZ = queryMax.GetSplatZ();
+
+        TInlineVector<int32_t, 64> stack;
+        stack.emplace_back( m_rootNodeIdx );
+
+        while ( !stack.empty() )
+        {
+            Node const& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            // Test all four children at once
+            __m128 overlapX = SIMD::Int::And( _mm_cmple_ps( queryMinX, _mm_load_ps( node.m_maxX ) ), _mm_cmpge_ps( queryMaxX, _mm_load_ps( node.m_minX ) ) );
+            __m128 overlapY = SIMD::Int::And( _mm_cmple_ps( queryMinY, _mm_load_ps( node.m_maxY ) ), _mm_cmpge_ps( queryMaxY, _mm_load_ps( node.m_minY ) ) );
+            __m128 overlapZ = SIMD::Int::And( _mm_cmple_ps( queryMinZ, _mm_load_ps( node.m_maxZ ) ), _mm_cmpge_ps( queryMaxZ, _mm_load_ps( node.m_minZ ) ) );
+            int32_t const overlapMask = _mm_movemask_ps( SIMD::Int::And( overlapX, SIMD::Int::And( overlapY, overlapZ ) ) );
+
+            for ( int32_t slotIdx = 0; slotIdx < node.m_numChildren; slotIdx++ )
+            {
+                if ( ( overlapMask & ( 1 << slotIdx ) ) == 0 )
+                {
+                    continue;
+                }
+
+                int32_t const childRef = node.m_children[slotIdx];
+                if ( IsLeaf( childRef ) )
+                {
+                    outResults.emplace_back( m_leaves[DecodeLeaf( childRef )].m_userData );
+                }
+                else
+                {
+                    stack.emplace_back( childRef );
+                }
+            }
+        }
+
+        return outResults.size() > 0;
+    }
+
+    uint32_t QuadAABBTree::FindVisible( ViewVolume::CullingPlanes const& cullingPlanes, TVector<uint64_t>& outResults ) const
+    {
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return 0;
+        }
+
+        // Splat each of the view planes, since we test the four children of a node against one plane at a time
+        //-------------------------------------------------------------------------
+
+        struct SplatPlane
+        {
+            Vector m_x, m_y, m_z, m_d, m_absX, m_absY, m_absZ;
+        };
+
+        SplatPlane planes[6];
+        for ( int32_t i = 0; i < 6; i++ )
+        {
+            int32_t const groupIdx = i / 4;
+            int32_t const laneIdx = i % 4;
+            planes[i].m_x = Vector( cullingPlanes.m_x[groupIdx].ToFloat4()[laneIdx] );
+            planes[i].m_y = Vector( cullingPlanes.m_y[groupIdx].ToFloat4()[laneIdx] );
+            planes[i].m_z = Vector( cullingPlanes.m_z[groupIdx].ToFloat4()[laneIdx] );
+            planes[i].m_d = Vector( cullingPlanes.m_d[groupIdx].ToFloat4()[laneIdx] );
+            planes[i].m_absX = planes[i].m_x.GetAbs();
+            planes[i].m_absY = planes[i].m_y.GetAbs();
+            planes[i].m_absZ = planes[i].m_z.GetAbs();
+        }
+
+        //-------------------------------------------------------------------------
+
+        uint32_t numTests = 0;
+
+        TInlineVector<int32_t, 64> stack;
+        stack.emplace_back( m_rootNodeIdx );
+
+        while ( !stack.empty() )
+        {
+            Node const& node = m_nodes[stack.back()];
+            stack.pop_back();
+            numTests += node.m_numChildren;
+
+            Vector const minX = _mm_load_ps( node.m_minX ), maxX = _mm_load_ps( node.m_maxX );
+            Vector const minY = _mm_load_ps( node.m_minY ), maxY = _mm_load_ps( node.m_maxY );
+            Vector const minZ = _mm_load_ps( node.m_minZ ), maxZ = _mm_load_ps( node.m_maxZ );
+            Vector const centerX = ( minX + maxX ) * Vector::Half, extentsX = ( maxX - minX ) * Vector::Half;
+            Vector const centerY = ( minY + maxY ) * Vector::Half, extentsY = ( maxY - minY ) * Vector::Half;
+            Vector const centerZ = ( minZ + maxZ ) * Vector::Half, extentsZ = ( maxZ - minZ ) * Vector::Half;
+
+            __m128 outside = _mm_setzero_ps();
+            __m128 intersects = _mm_setzero_ps();
+            for ( SplatPlane const& plane : planes )
+            {
+                Vector const distance = Vector::MultiplyAdd( plane.m_x, centerX, Vector::MultiplyAdd( plane.m_y, centerY, Vector::MultiplyAdd( plane.m_z, centerZ, plane.m_d ) ) );
+                Vector const radius = Vector::MultiplyAdd( plane.m_absX, extentsX, Vector::MultiplyAdd( plane.m_absY, extentsY, plane.m_absZ * extentsZ ) );
+                outside = SIMD::Int::Or( outside, ( distance + radius ).LessThan( Vector::Zero ) );
+                intersects = SIMD::Int::Or( intersects, ( distance - radius ).LessThan( Vector::Zero ) );
+            }
+
+            int32_t const outsideMask = _mm_movemask_ps( outside );
+            int32_t const intersectsMask = _mm_movemask_ps( intersects );
+
+            for ( int32_t slotIdx = 0; slotIdx < node.m_numChildren; slotIdx++ )
+            {
+                if ( outsideMask & ( 1 << slotIdx ) )
+                {
+                    continue;
+                }
+
+                int32_t const childRef = node.m_children[slotIdx];
+                if ( IsLeaf( childRef ) )
+                {
+                    outResults.emplace_back( m_leaves[DecodeLeaf( childRef )].m_userData );
+                }
+                else if ( intersectsMask & ( 1 << slotIdx ) )
+                {
+                    stack.emplace_back( childRef );
+                }
+                else // Fully inside, so no need to test anything below it
+                {
+                    AddAllLeaves( childRef, outResults );
+                }
+            }
+        }
+
+        return numTests;
+    }
+
+    void QuadAABBTree::AddAllLeaves( int32_t nodeIdx, TVector<uint64_t>& outResults ) const
+    {
+        TInlineVector<int32_t, 64> stack;
+        stack.emplace_back( nodeIdx );
+
+        while ( !stack.empty() )
+        {
+            Node const& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            for ( int32_t slotIdx = 0; slotIdx < node.m_numChildren; slotIdx++ )
+            {
+                int32_t const childRef = node.m_children[slotIdx];
+                if ( IsLeaf( childRef ) )
+                {
+                    outResults.emplace_back( m_leaves[DecodeLeaf( childRef )].m_userData );
+                }
+                else
+                {
+                    stack.emplace_back( childRef );
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    void QuadAABBTree::DrawDebug( Drawing::DrawContext& drawingContext ) const
+    {
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return;
+        }
+
+        drawingContext.DrawWireBox( GetNodeBounds( m_rootNodeIdx ), Colors::Cyan, 1.0f, Drawing::DepthTestState::EnableDepthTest );
+
+        TInlineVector<int32_t, 64> stack;
+        stack.emplace_back( m_rootNodeIdx );
+
+        while ( !stack.empty() )
+        {
+            int32_t const nodeIdx = stack.back();
+            stack.pop_back();
+
+            Node const& node = m_nodes[nodeIdx];
+            for ( int32_t slotIdx = 0; slotIdx < node.m_numChildren; slotIdx++ )
+            {
+                int32_t const childRef = node.m_children[slotIdx];
+                if ( IsLeaf( childRef ) )
+                {
+                    drawingContext.DrawWireBox( GetChildBounds( nodeIdx, slotIdx ), Colors::Lime, 2.0f, Drawing::DepthTestState::EnableDepthTest );
+                }
+                else
+                {
+                    drawingContext.DrawWireBox( GetChildBounds( nodeIdx, slotIdx ), Colors::Cyan, 1.0f, Drawing::DepthTestState::EnableDepthTest );
+                    stack.emplace_back( childRef );
+                }
+            }
+        }
+    }
+    #endif
+}
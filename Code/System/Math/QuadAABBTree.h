@@ -0,0 +1,148 @@
+#pragma once
+
+#include "System/Math/ViewVolume.h"
+#include "System/Types/Arrays.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Drawing { class DrawContext; }
+
+//-------------------------------------------------------------------------
+// Quad AABB Tree
+//-------------------------------------------------------------------------
+// A 4-wide (QBVH style) alternative to the binary AABB tree
+//
+// * Each node stores the bounds of its four children in SoA form, so a single SIMD test checks all four children
+// * Queries are iterative and use an explicit stack
+// * Static geometry should be bulk built (binned SAH) and refit when moved
+// * Dynamic inserts/removes refit the path to the root and apply tree rotations to limit the degradation of the tree
+//
+// As with the binary tree, boxes are identified by their user data which needs to be unique and non-zero
+
+namespace EE::Math
+{
+    class EE_SYSTEM_API QuadAABBTree
+    {
+        constexpr static int32_t const s_numSAHBins = 12;
+
+        struct alignas( 16 ) Node
+        {
+            float           m_minX[4] = { 0, 0, 0, 0 };
+            float           m_minY[4] = { 0, 0, 0, 0 };
+            float           m_minZ[4] = { 0, 0, 0, 0 };
+            float           m_maxX[4] = { 0, 0, 0, 0 };
+            float           m_maxY[4] = { 0, 0, 0, 0 };
+            float           m_maxZ[4] = { 0, 0, 0, 0 };
+            int32_t         m_children[4] = { InvalidIndex, InvalidIndex, InvalidIndex, InvalidIndex }; // See 'EncodeLeaf'
+            int32_t         m_parentNodeIdx = InvalidIndex;
+            int32_t         m_numChildren = 0;                  // Children are always packed into the first N slots
+        };
+
+        static_assert( sizeof( Node ) == 128, "Nodes should be exactly two cache lines" );
+
+        struct Leaf
+        {
+            AABB            m_bounds;
+            uint64_t        m_userData = 0;
+            int32_t         m_parentNodeIdx = InvalidIndex;
+        };
+
+        // Child references: positive values are node indices, values below 'InvalidIndex' are encoded leaf indices
+        EE_FORCE_INLINE static bool IsLeaf( int32_t childRef ) { return childRef < InvalidIndex; }
+        EE_FORCE_INLINE static int32_t EncodeLeaf( int32_t leafIdx ) { return -( leafIdx + 2 ); }
+        EE_FORCE_INLINE static int32_t DecodeLeaf( int32_t childRef ) { return -( childRef + 2 ); }
+
+    public:
+
+        inline bool IsEmpty() const { return m_rootNodeIdx == InvalidIndex; }
+        inline int32_t GetNumBoxes() const { return (int32_t) m_userDataToLeafMap.size(); }
+        void Clear();
+
+        // Dynamic Updates
+        //-------------------------------------------------------------------------
+
+        void InsertBox( AABB const& aabb, uint64_t userData );
+        void RemoveBox( uint64_t userData );
+
+        // Updates the box and refits the path to the root, boxes that leave their parent's bounds are reinserted
+        void UpdateBox( uint64_t userData, AABB const& newBounds );
+
+        EE_FORCE_INLINE void InsertBox( AABB const& aabb, void* pUserData ) { InsertBox( aabb, reinterpret_cast<uint64_t>( pUserData ) ); }
+        EE_FORCE_INLINE void RemoveBox( void* pUserData ) { RemoveBox( reinterpret_cast<uint64_t>( pUserData ) ); }
+        EE_FORCE_INLINE void UpdateBox( void* pUserData, AABB const& newBounds ) { UpdateBox( reinterpret_cast<uint64_t>( pUserData ), newBounds ); }
+
+        // Bulk Updates
+        //-------------------------------------------------------------------------
+
+        // Replace the contents of the tree with the supplied boxes, the tree is built top-down using a binned surface area heuristic
+        void Build( TVector<AABB> const& bounds, TVector<uint64_t> const& userData );
+
+        // Sets a box's bounds without updating the tree, 'Refit' needs to be called once all boxes have been updated
+        void SetBoxBounds( uint64_t userData, AABB const& newBounds );
+        EE_FORCE_INLINE void SetBoxBounds( void* pUserData, AABB const& newBounds ) { SetBoxBounds( reinterpret_cast<uint64_t>( pUserData ), newBounds ); }
+
+        // Recalculate all node bounds, this doesn't change the structure of the tree
+        void Refit();
+
+        // Queries
+        //-------------------------------------------------------------------------
+
+        bool FindOverlaps( AABB const& queryBox, TVector<uint64_t>& outResults ) const;
+
+        template<typename T>
+        bool FindOverlaps( AABB const& queryBox, TVector<T*>& outResults ) const
+        {
+            return FindOverlaps( queryBox, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
+        // Adds all boxes that aren't fully outside the planes, returns the number of bounding volume tests performed
+        uint32_t FindVisible( ViewVolume::CullingPlanes const& planes, TVector<uint64_t>& outResults ) const;
+
+        template<typename T>
+        uint32_t FindVisible( ViewVolume::CullingPlanes const& planes, TVector<T*>& outResults ) const
+        {
+            return FindVisible( planes, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        void DrawDebug( Drawing::DrawContext& drawingContext ) const;
+        #endif
+
+    private:
+
+        int32_t RequestNode( int32_t parentNodeIdx );
+        void ReleaseNode( int32_t nodeIdx );
+        int32_t RequestLeaf( AABB const& bounds, uint64_t userData );
+        void ReleaseLeaf( int32_t leafIdx );
+
+        AABB GetChildBounds( int32_t nodeIdx, int32_t slotIdx ) const;
+        AABB GetNodeBounds( int32_t nodeIdx ) const;
+        int32_t FindChildSlot( int32_t nodeIdx, int32_t childRef ) const;
+        void SetChildBounds( int32_t nodeIdx, int32_t slotIdx, AABB const& bounds );
+        void SetChild( int32_t nodeIdx, int32_t slotIdx, int32_t childRef, AABB const& bounds );
+        void AddChild( int32_t nodeIdx, int32_t childRef, AABB const& bounds );
+        void RemoveChild( int32_t nodeIdx, int32_t slotIdx );
+
+        void InsertLeaf( int32_t leafIdx );
+        void RemoveLeaf( int32_t leafIdx );
+        void RefitAncestors( int32_t nodeIdx );
+        void TryRotate( int32_t nodeIdx );
+
+        int32_t BuildSubtree( int32_t parentNodeIdx, uint32_t begin, uint32_t end );
+        uint32_t PartitionSAH( uint32_t begin, uint32_t end );
+        AABB RefitSubtree( int32_t nodeIdx );
+
+        void AddAllLeaves( int32_t nodeIdx, TVector<uint64_t>& outResults ) const;
+
+    private:
+
+        TVector<Node>                           m_nodes;
+        TVector<Leaf>                           m_leaves;
+        TVector<int32_t>                        m_freeNodes;
+        TVector<int32_t>                        m_freeLeaves;
+        THashMap<uint64_t, int32_t>             m_userDataToLeafMap;
+        TVector<int32_t>                        m_buildOrder;           // Scratch memory for the bulk build
+        int32_t                                 m_rootNodeIdx = InvalidIndex;
+    };
+}
@@ -64,6 +64,19 @@ namespace EE
             }
         }
 
+        // Float Operations
+        //-------------------------------------------------------------------------
+
+        // Returns ( a * b ) + c, uses a fused multiply-add when available
+        EE_FORCE_INLINE __m128 MultiplyAdd( __m128 a, __m128 b, __m128 c )
+        {
+            #if defined( __AVX2__ ) || defined( __FMA__ )
+            return _mm_fmadd_ps( a, b, c );
+            #else
+            return _mm_add_ps( _mm_mul_ps( a, b ), c );
+            #endif
+        }
+
         //-------------------------------------------------------------------------
 
         static __m128 const g_sinCoefficients0 = { -0.16666667f, +0.0083333310f, -0.00019840874f, +2.7525562e-06f };
@@ -26,6 +26,15 @@ namespace EE
         EE_FORCE_INLINE static Transform FromTranslationAndScale( Vector const& translation, float uniformScale ) { return Transform( Quaternion::Identity, translation, uniformScale ); }
         EE_FORCE_INLINE static Transform FromRotationBetweenVectors( Vector const sourceVector, Vector const targetVector ) { return Transform( Quaternion::FromRotationBetweenNormalizedVectors( sourceVector, targetVector ) ); }
 
+        // Create a transform from a rotation and a packed translation/scale vector (uniform scale is stored in the W component)
+        EE_FORCE_INLINE static Transform FromRotationAndTranslationScale( Quaternion const& rotation, Vector const& translationScale )
+        {
+            Transform transform( NoInit );
+            transform.m_rotation = rotation;
+            transform.m_translationScale = translationScale;
+            return transform;
+        }
+
         inline static Transform Lerp( Transform const& from, Transform const& to, float t );
         inline static Transform Slerp( Transform const& from, Transform const& to, float t );
 
@@ -499,6 +499,34 @@ namespace EE::Math
 
     //-------------------------------------------------------------------------
 
+    ViewVolume::CullingPlanes ViewVolume::GetCullingPlanes() const
+    {
+        // Padding planes have a zero normal and a positive distance so they never reject anything
+        Float4 planes[8];
+        for ( auto i = 0u; i < 6; i++ )
+        {
+            planes[i] = m_viewPlanes[i].ToFloat4();
+        }
+        planes[6] = planes[7] = Float4( 0.0f, 0.0f, 0.0f, 1.0f );
+
+        //-------------------------------------------------------------------------
+
+        CullingPlanes cullingPlanes;
+        for ( auto i = 0u; i < 2; i++ )
+        {
+            Float4 const* p = &planes[i * 4];
+            cullingPlanes.m_x[i] = Vector( p[0].m_x, p[1].m_x, p[2].m_x, p[3].m_x );
+            cullingPlanes.m_y[i] = Vector( p[0].m_y, p[1].m_y, p[2].m_y, p[3].m_y );
+            cullingPlanes.m_z[i] = Vector( p[0].m_z, p[1].m_z, p[2].m_z, p[3].m_z );
+            cullingPlanes.m_d[i] = Vector( p[0].m_w, p[1].m_w, p[2].m_w, p[3].m_w );
+            cullingPlanes.m_absX[i] = cullingPlanes.m_x[i].GetAbs();
+            cullingPlanes.m_absY[i] = cullingPlanes.m_y[i].GetAbs();
+            cullingPlanes.m_absZ[i] = cullingPlanes.m_z[i].GetAbs();
+        }
+
+        return cullingPlanes;
+    }
+
     ViewVolume::IntersectionResult ViewVolume::Intersect( AABB const& aabb ) const
     {
         Vector const center( aabb.GetCenter() );
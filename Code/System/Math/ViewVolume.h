@@ -49,6 +49,81 @@ namespace EE::Math
             return verticalFOV;
         }
 
+        // The view planes transposed so that a bounding volume can be tested against 4 planes at once
+        // The 6 view planes are padded out to 8 with planes that every volume is fully in front of
+        struct CullingPlanes
+        {
+            EE_FORCE_INLINE IntersectionResult Intersect( AABB const& aabb ) const
+            {
+                Vector const extents = aabb.GetExtents();
+                Vector const extentsX = extents.GetSplatX();
+                Vector const extentsY = extents.GetSplatY();
+                Vector const extentsZ = extents.GetSplatZ();
+
+                Vector radius[2];
+                for ( int32_t i = 0; i < 2; i++ )
+                {
+                    radius[i] = Vector::MultiplyAdd( m_absX[i], extentsX, Vector::MultiplyAdd( m_absY[i], extentsY, m_absZ[i] * extentsZ ) );
+                }
+
+                return Intersect( aabb.GetCenter(), radius );
+            }
+
+            EE_FORCE_INLINE IntersectionResult Intersect( OBB const& obb ) const
+            {
+                // The projected radius of the box onto a plane normal is the sum of the projections of each of the box axes
+                Vector const axisX = obb.m_orientation.RotateVector( Vector::UnitX ) * obb.m_extents.GetSplatX();
+                Vector const axisY = obb.m_orientation.RotateVector( Vector::UnitY ) * obb.m_extents.GetSplatY();
+                Vector const axisZ = obb.m_orientation.RotateVector( Vector::UnitZ ) * obb.m_extents.GetSplatZ();
+
+                Vector radius[2];
+                for ( int32_t i = 0; i < 2; i++ )
+                {
+                    Vector const projectedX = Vector::MultiplyAdd( m_x[i], axisX.GetSplatX(), Vector::MultiplyAdd( m_y[i], axisX.GetSplatY(), m_z[i] * axisX.GetSplatZ() ) );
+                    Vector const projectedY = Vector::MultiplyAdd( m_x[i], axisY.GetSplatX(), Vector::MultiplyAdd( m_y[i], axisY.GetSplatY(), m_z[i] * axisY.GetSplatZ() ) );
+                    Vector const projectedZ = Vector::MultiplyAdd( m_x[i], axisZ.GetSplatX(), Vector::MultiplyAdd( m_y[i], axisZ.GetSplatY(), m_z[i] * axisZ.GetSplatZ() ) );
+                    radius[i] = projectedX.GetAbs() + projectedY.GetAbs() + projectedZ.GetAbs();
+                }
+
+                return Intersect( obb.m_center, radius );
+            }
+
+        private:
+
+            EE_FORCE_INLINE IntersectionResult Intersect( Vector const& center, Vector const radius[2] ) const
+            {
+                Vector const centerX = center.GetSplatX();
+                Vector const centerY = center.GetSplatY();
+                Vector const centerZ = center.GetSplatZ();
+
+                bool intersects = false;
+                for ( int32_t i = 0; i < 2; i++ )
+                {
+                    Vector const distance = Vector::MultiplyAdd( m_x[i], centerX, Vector::MultiplyAdd( m_y[i], centerY, Vector::MultiplyAdd( m_z[i], centerZ, m_d[i] ) ) );
+
+                    // Is outside
+                    if ( ( distance + radius[i] ).IsAnyLessThan( Vector::Zero ) )
+                    {
+                        return IntersectionResult::FullyOutside;
+                    }
+
+                    intersects |= ( distance - radius[i] ).IsAnyLessThan( Vector::Zero );
+                }
+
+                return intersects ? IntersectionResult::Intersects : IntersectionResult::FullyInside;
+            }
+
+        public:
+
+            Vector              m_x[2];
+            Vector              m_y[2];
+            Vector              m_z[2];
+            Vector              m_d[2];
+            Vector              m_absX[2];
+            Vector              m_absY[2];
+            Vector              m_absZ[2];
+        };
+
         // Set of world space corners for the view volume
         // Order: Near BL, Near TL, Near TR, Near BR, Far BL, Far TL, Far TR, Far BR
         union VolumeCorners
@@ -134,6 +209,7 @@ namespace EE::Math
         inline Plane const& GetViewPlane( PlaneID p ) const { return GetViewPlane( (uint32_t) p ); }
         inline Plane const& GetViewPlane( uint32_t p ) const { EE_ASSERT( p < 6 ); return m_viewPlanes[p]; }
         VolumeCorners GetCorners() const; // The first 4 points are the near plane corners, the last 4 are the far plane corners
+        CullingPlanes GetCullingPlanes() const;
 
         // Bounds and Intersection tests
         //-------------------------------------------------------------------------
@@ -0,0 +1,75 @@
+#include "ResourceArchive.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ResourceArchive::Open( FileSystem::Path const& archivePath )
+    {
+        EE_ASSERT( !IsOpen() );
+
+        if ( !m_file.Open( archivePath ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Failed to open resource archive: %s", archivePath.c_str() );
+            return false;
+        }
+
+        // Validate header
+        //-------------------------------------------------------------------------
+
+        uint8_t const* pArchiveData = m_file.GetData();
+        size_t const archiveSize = m_file.GetSize();
+
+        Header const* pHeader = reinterpret_cast<Header const*>( pArchiveData );
+        if ( archiveSize < sizeof( Header ) || pHeader->m_magic != s_magic || pHeader->m_version != s_version )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Invalid or outdated resource archive: %s", archivePath.c_str() );
+            m_file.Close();
+            return false;
+        }
+
+        if ( archiveSize < sizeof( Header ) + ( sizeof( Entry ) * pHeader->m_numEntries ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Truncated resource archive: %s", archivePath.c_str() );
+            m_file.Close();
+            return false;
+        }
+
+        // The entry table immediately follows the header
+        m_pEntries = reinterpret_cast<Entry const*>( pArchiveData + sizeof( Header ) );
+        m_numEntries = pHeader->m_numEntries;
+        return true;
+    }
+
+    void ResourceArchive::Close()
+    {
+        m_file.Close();
+        m_pEntries = nullptr;
+        m_numEntries = 0;
+    }
+
+    bool ResourceArchive::TryGetResourceData( ResourceID const& resourceID, uint8_t const*& pOutData, size_t& outSize ) const
+    {
+        EE_ASSERT( IsOpen() );
+        EE_ASSERT( resourceID.IsValid() );
+
+        uint32_t const resourcePathID = resourceID.GetPathID();
+        auto pEntry = eastl::lower_bound( m_pEntries, m_pEntries + m_numEntries, resourcePathID, [] ( Entry const& entry, uint32_t ID ) { return entry.m_resourcePathID < ID; } );
+        if ( pEntry == m_pEntries + m_numEntries || pEntry->m_resourcePathID != resourcePathID )
+        {
+            return false;
+        }
+
+        if ( pEntry->m_compression != Compression::None )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Unsupported compression for resource: %s", resourceID.c_str() );
+            return false;
+        }
+
+        EE_ASSERT( pEntry->m_offset + pEntry->m_size <= m_file.GetSize() );
+        pOutData = m_file.GetData() + pEntry->m_offset;
+        outSize = (size_t) pEntry->m_size;
+        return true;
+    }
+}
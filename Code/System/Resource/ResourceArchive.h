@@ -0,0 +1,72 @@
+#pragma once
+
+#include "ResourceID.h"
+#include "System/FileSystem/FileMemoryMapping.h"
+
+//-------------------------------------------------------------------------
+// Resource Archive
+//-------------------------------------------------------------------------
+// A single file containing all the compiled resources for a packaged build
+//
+// Layout:  [Header][Entry Table][Resource Data...]
+//
+// * The entry table is sorted by resource path ID, so lookups are a binary search
+// * Each resource's data starts at an aligned offset and is used in place from the memory mapped file (no copies)
+//
+// Archives are built offline from the compiled resource directory (see the resource compiler's '-archive' option)
+
+namespace EE::Resource
+{
+    class EE_SYSTEM_API ResourceArchive
+    {
+    public:
+
+        constexpr static char const* const s_archiveFilename = "Resources.earc";
+        constexpr static uint32_t const s_magic = 0x45415243; // 'EARC'
+        constexpr static uint32_t const s_version = 1;
+        constexpr static uint32_t const s_dataAlignment = 64;
+
+        // Entry compression - no codec is currently supported so all entries are stored uncompressed
+        enum class Compression : uint32_t
+        {
+            None = 0,
+        };
+
+        struct Header
+        {
+            uint32_t            m_magic = s_magic;
+            uint32_t            m_version = s_version;
+            uint32_t            m_numEntries = 0;
+            uint32_t            m_dataAlignment = s_dataAlignment;
+        };
+
+        struct Entry
+        {
+            uint32_t            m_resourcePathID = 0;           // See 'ResourceID::GetPathID()'
+            Compression         m_compression = Compression::None;
+            uint64_t            m_offset = 0;                   // Offset of the data from the start of the archive
+            uint64_t            m_size = 0;                     // Size of the stored data
+            uint64_t            m_uncompressedSize = 0;
+        };
+
+        static_assert( sizeof( Header ) == 16, "The archive header is part of the file format, update the archive version if it changes" );
+        static_assert( sizeof( Entry ) == 32, "The archive entry is part of the file format, update the archive version if it changes" );
+
+    public:
+
+        bool Open( FileSystem::Path const& archivePath );
+        void Close();
+        inline bool IsOpen() const { return m_file.IsOpen(); }
+
+        inline uint32_t GetNumEntries() const { return m_numEntries; }
+
+        // Get a view of the resource data within the archive, this is only valid while the archive is open
+        bool TryGetResourceData( ResourceID const& resourceID, uint8_t const*& pOutData, size_t& outSize ) const;
+
+    private:
+
+        FileSystem::MemoryMappedFile        m_file;
+        Entry const*                        m_pEntries = nullptr;
+        uint32_t                            m_numEntries = 0;
+    };
+}
@@ -53,8 +53,12 @@ namespace EE
 
             TVector<ResourceTypeID> const& GetLoadableTypes() const { return m_loadableTypes; }
 
+            // Can multiple resources be loaded (i.e. deserialized) at the same time on different threads
+            inline bool IsParallelLoadingSupported() const { return m_isParallelLoadingSupported; }
+
             // This function loads is responsible to deserialize the compiled resource data, read the resource header for install dependencies and to create the new runtime resource object
-            bool Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const;
+            bool Load( ResourceID const& resourceID, uint8_t const* pRawData, size_t rawDataSize, ResourceRecord* pResourceRecord ) const;
+            inline bool Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const { return Load( resourceID, rawData.data(), rawData.size(), pResourceRecord ); }
 
             // This function will destroy the created resource object
             void Unload( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const;
@@ -79,6 +83,7 @@ namespace EE
         protected:
 
             TVector<ResourceTypeID>          m_loadableTypes;
+            bool                             m_isParallelLoadingSupported = true;    // Loaders that modify shared state in 'LoadInternal' need to disable this
         };
     }
 }
\ No newline at end of file
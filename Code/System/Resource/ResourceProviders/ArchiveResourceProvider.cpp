@@ -0,0 +1,37 @@
+#include "ArchiveResourceProvider.h"
+#include "System/Resource/ResourceRequest.h"
+#include "System/Resource/ResourceSettings.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ArchiveResourceProvider::IsReady() const
+    {
+        return m_archive.IsOpen();
+    }
+
+    bool ArchiveResourceProvider::Initialize()
+    {
+        return m_archive.Open( GetArchivePath( m_settings ) );
+    }
+
+    void ArchiveResourceProvider::Shutdown()
+    {
+        m_archive.Close();
+    }
+
+    void ArchiveResourceProvider::RequestRawResource( ResourceRequest* pRequest )
+    {
+        uint8_t const* pRawResourceData = nullptr;
+        size_t rawResourceDataSize = 0;
+        m_archive.TryGetResourceData( pRequest->GetResourceID(), pRawResourceData, rawResourceDataSize );
+        pRequest->OnRawResourceRequestComplete( pRawResourceData, rawResourceDataSize );
+    }
+
+    void ArchiveResourceProvider::CancelRequest( ResourceRequest* pRequest )
+    {
+         // Do Nothing
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "System/Resource/ResourceProvider.h"
+#include "System/Resource/ResourceArchive.h"
+
+//-------------------------------------------------------------------------
+// Provides resources directly from a memory mapped resource archive
+// Requests complete immediately with a view into the archive, so no file IO is needed per resource
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    class ResourceSettings;
+
+    //-------------------------------------------------------------------------
+
+    class EE_SYSTEM_API ArchiveResourceProvider final : public ResourceProvider
+    {
+
+    public:
+
+        ArchiveResourceProvider( ResourceSettings const& settings ) : ResourceProvider( settings ) {}
+        virtual bool IsReady() const override final;
+
+        // Get the path of the archive for the compiled resource directory
+        static FileSystem::Path GetArchivePath( ResourceSettings const& settings ) { return settings.m_compiledResourcePath + ResourceArchive::s_archiveFilename; }
+
+    private:
+
+        virtual bool Initialize() override;
+        virtual void Shutdown() override;
+        virtual void RequestRawResource( ResourceRequest* pRequest ) override;
+        virtual void CancelRequest( ResourceRequest* pRequest ) override;
+
+    private:
+
+        ResourceArchive     m_archive;
+    };
+}
@@ -60,6 +60,23 @@ namespace EE::Resource
         }
     }
 
+    void ResourceRequest::OnRawResourceRequestComplete( uint8_t const* pRawResourceData, size_t rawResourceDataSize )
+    {
+        // Raw resource failed to load
+        if ( pRawResourceData == nullptr || rawResourceDataSize == 0 )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Request", "Failed to find resource data (%s)", m_pResourceRecord->GetResourceID().c_str() );
+            m_stage = ResourceRequest::Stage::Complete;
+            m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
+        }
+        else // Continue the load operation
+        {
+            m_pRawResourceDataView = pRawResourceData;
+            m_rawResourceDataViewSize = rawResourceDataSize;
+            m_stage = ResourceRequest::Stage::LoadResource;
+        }
+    }
+
     void ResourceRequest::SwitchToLoadTask()
     {
         EE_ASSERT( m_type == Type::Unload );
@@ -123,6 +140,8 @@ namespace EE::Resource
 
             case Stage::LoadResource:
             {
+                m_pRawResourceDataView = nullptr;
+                m_rawResourceDataViewSize = 0;
                 m_stage = Stage::Complete;
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Unloaded );
             }
@@ -269,11 +288,12 @@ namespace EE::Resource
     {
         EE_PROFILE_FUNCTION_RESOURCE();
         EE_ASSERT( m_stage == ResourceRequest::Stage::LoadResource );
-        EE_ASSERT( m_rawResourcePath.IsValid() );
+        EE_ASSERT( m_pRawResourceDataView != nullptr || m_rawResourcePath.IsValid() );
 
-        // Read file
+        // Read file - only needed if the provider didnt supply the data directly
         //-------------------------------------------------------------------------
 
+        if ( m_pRawResourceDataView == nullptr )
         {
             EE_PROFILE_SCOPE_IO( "Read File" );
             EE_PROFILE_TAG( "filename", m_rawResourcePath.GetFilename().c_str() );
@@ -289,6 +309,9 @@ namespace EE::Resource
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
                 return;
             }
+
+            m_pRawResourceDataView = m_rawResourceData.data();
+            m_rawResourceDataViewSize = m_rawResourceData.size();
         }
 
         // Load resource
@@ -304,13 +327,20 @@ namespace EE::Resource
             #endif
 
             // Load the resource
-            EE_ASSERT( !m_rawResourceData.empty() );
+            EE_ASSERT( m_pRawResourceDataView != nullptr && m_rawResourceDataViewSize > 0 );
 
             #if EE_DEVELOPMENT_TOOLS
             ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_loadTime );
             #endif
 
-            if ( !m_pResourceLoader->Load( GetResourceID(), m_rawResourceData, m_pResourceRecord ) )
+            bool const loadSucceeded = m_pResourceLoader->Load( GetResourceID(), m_pRawResourceDataView, m_rawResourceDataViewSize, m_pResourceRecord );
+
+            // Release raw data
+            m_rawResourceData.clear();
+            m_pRawResourceDataView = nullptr;
+            m_rawResourceDataViewSize = 0;
+
+            if ( !loadSucceeded )
             {
                 EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load compiled resource data (%s)", m_pResourceRecord->GetResourceID().c_str() );
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
@@ -318,9 +348,6 @@ namespace EE::Resource
                 m_stage = ResourceRequest::Stage::Complete;
                 return;
             }
-
-            // Release raw data
-            m_rawResourceData.clear();
         }
 
         // Load dependencies
@@ -73,6 +73,9 @@ namespace EE::Resource
 
         inline Stage GetStage() const { return m_stage; }
 
+        // Is this request waiting to load (read and deserialize) its resource and can that be done concurrently with other requests
+        inline bool IsReadyForParallelLoad() const { return m_stage == Stage::LoadResource && m_pResourceLoader->IsParallelLoadingSupported(); }
+
         inline ResourceRecord const* GetResourceRecord() const { return m_pResourceRecord; }
         inline ResourceID const& GetResourceID() const { return m_pResourceRecord->GetResourceID(); }
         inline ResourceTypeID GetResourceTypeID() const { return m_pResourceRecord->GetResourceTypeID(); }
@@ -89,6 +92,10 @@ namespace EE::Resource
         // Called by the resource provider once the request operation completes and provides the raw resource data
         void OnRawResourceRequestComplete( String const& filePath );
 
+        // Called by the resource provider once the request operation completes and provides a view of the raw resource data
+        // The data is not copied, so it needs to remain valid until the resource is loaded
+        void OnRawResourceRequestComplete( uint8_t const* pRawResourceData, size_t rawResourceDataSize );
+
         // This will interrupt a load task and convert it into an unload task
         void SwitchToLoadTask();
 
@@ -114,6 +121,8 @@ namespace EE::Resource
         ResourceLoader*                         m_pResourceLoader = nullptr;
         FileSystem::Path                        m_rawResourcePath;
         Blob                                    m_rawResourceData;
+        uint8_t const*                          m_pRawResourceDataView = nullptr;       // Externally owned raw data, only set when the provider supplies the data directly
+        size_t                                  m_rawResourceDataViewSize = 0;
         InstallDependencyList                   m_pendingInstallDependencies;
         InstallDependencyList                   m_installDependencies;
         Type                                    m_type = Type::Invalid;
@@ -97,6 +97,26 @@ namespace EE::Resource
                 return false;
             }
 
+            // Compile Cache
+            //-------------------------------------------------------------------------
+
+            if ( ini.TryGetString( "Resource:CompileCacheDirectoryName", tmp ) )
+            {
+                m_compileCachePath = m_workingDirectoryPath + tmp;
+                if ( !m_compileCachePath.IsValid() )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid compile cache path: %s", m_compileCachePath.c_str() );
+                    return false;
+                }
+
+                m_compileCachePath.MakeIntoDirectoryPath();
+            }
+            else
+            {
+                EE_LOG_ERROR( "Resource", "Resource Settings", "Failed to read compile cache path from ini file" );
+                return false;
+            }
+
             // Resource Compiler
             //-------------------------------------------------------------------------
 
@@ -382,25 +382,65 @@ namespace EE::Resource
     {
         EE_PROFILE_FUNCTION_RESOURCE();
 
+        struct ParallelLoadTask final : public ITaskSet
+        {
+            ParallelLoadTask( ResourceRequest::RequestContext& context, TVector<ResourceRequest*>& requests )
+                : m_context( context )
+                , m_requests( requests )
+            {
+                m_SetSize = (uint32_t) requests.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    EE_ASSERT( m_requests[i]->IsReadyForParallelLoad() );
+                    m_requests[i]->Update( m_context );
+                }
+            }
+
+        private:
+
+            ResourceRequest::RequestContext&            m_context;
+            TVector<ResourceRequest*>&                  m_requests;
+        };
+
         //-------------------------------------------------------------------------
 
+        // The context is only read by the requests so can be shared across threads, the load/unload functions lock the system internally
+        ResourceRequest::RequestContext context;
+        context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
+        context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
+        context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
+        context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
+
+        // Serial stages
+        //-------------------------------------------------------------------------
+        // Raw resource requests, dependency waits, install and unload stages are all processed in order on this task
+        // Any requests that are ready to load (IO + deserialization) are gathered and loaded concurrently afterwards
+
+        m_parallelLoadRequests.clear();
+
         // We dont have to worry about this loop even if the m_activeRequests array is modified from another thread since we only access the array in 2 places and both use locks
         for ( int32_t i = (int32_t) m_activeRequests.size() - 1; i >= 0; i-- )
         {
-            ResourceRequest::RequestContext context;
-            context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
-            context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
-            context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
-            context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
-
-            //-------------------------------------------------------------------------
-
             bool isRequestComplete = false;
 
             ResourceRequest* pRequest = m_activeRequests[i];
             if ( pRequest->IsActive() )
             {
-                isRequestComplete = pRequest->Update( context );
+                if ( !pRequest->IsReadyForParallelLoad() )
+                {
+                    isRequestComplete = pRequest->Update( context );
+                }
+
+                // Requests that received their raw data immediately can be loaded in this same pass
+                if ( pRequest->IsReadyForParallelLoad() )
+                {
+                    m_parallelLoadRequests.emplace_back( pRequest );
+                    continue;
+                }
             }
             else
             {
@@ -416,6 +456,38 @@ namespace EE::Resource
                 m_activeRequests.erase_unsorted( m_activeRequests.begin() + i );
             }
         }
+
+        // Parallel load stage
+        //-------------------------------------------------------------------------
+
+        if ( m_parallelLoadRequests.empty() )
+        {
+            return;
+        }
+
+        if ( m_parallelLoadRequests.size() == 1 )
+        {
+            m_parallelLoadRequests[0]->Update( context );
+        }
+        else
+        {
+            EE_PROFILE_SCOPE_RESOURCE( "Parallel Load Resources" );
+            ParallelLoadTask loadTask( context, m_parallelLoadRequests );
+            m_taskSystem.ScheduleTask( &loadTask );
+            m_taskSystem.WaitForTask( &loadTask );
+        }
+
+        // Remove any requests that failed to load
+        for ( auto pRequest : m_parallelLoadRequests )
+        {
+            if ( pRequest->IsComplete() )
+            {
+                m_completedRequests.emplace_back( pRequest );
+                m_activeRequests.erase_unsorted( VectorFind( m_activeRequests, pRequest ) );
+            }
+        }
+
+        m_parallelLoadRequests.clear();
     }
 
     //-------------------------------------------------------------------------
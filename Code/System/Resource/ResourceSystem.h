@@ -149,6 +149,7 @@ namespace EE::Resource
         TVector<PendingRequest>                                 m_pendingRequests;
         TVector<ResourceRequest*>                               m_activeRequests;
         TVector<ResourceRequest*>                               m_completedRequests;
+        TVector<ResourceRequest*>                               m_parallelLoadRequests;     // Requests that are ready to load, gathered each processing pass
 
         // ASync
         AsyncTask                                               m_asyncProcessingTask;
@@ -1,6 +1,7 @@
 #include "TypeDescriptors.h"
 #include "TypeRegistry.h"
 #include "System/Math/Math.h"
+#include "System/Math/Matrix.h"
 #include "System/Log.h"
 
 //-------------------------------------------------------------------------
@@ -77,6 +78,89 @@ namespace EE::TypeSystem
 
             return resolvedPath;
         }
+
+        // Can a property value be written with a plain memory copy
+        static bool IsTriviallyCopyableProperty( PropertyInfo const& propertyInfo )
+        {
+            if ( propertyInfo.IsEnumProperty() )
+            {
+                return true;
+            }
+
+            switch ( GetCoreType( propertyInfo.m_typeID ) )
+            {
+                case CoreTypeID::Bool:
+                case CoreTypeID::Uint8:
+                case CoreTypeID::Int8:
+                case CoreTypeID::Uint16:
+                case CoreTypeID::Int16:
+                case CoreTypeID::Uint32:
+                case CoreTypeID::Int32:
+                case CoreTypeID::Uint64:
+                case CoreTypeID::Int64:
+                case CoreTypeID::Float:
+                case CoreTypeID::Double:
+                case CoreTypeID::UUID:
+                case CoreTypeID::StringID:
+                case CoreTypeID::TypeID:
+                case CoreTypeID::Color:
+                case CoreTypeID::Float2:
+                case CoreTypeID::Float3:
+                case CoreTypeID::Float4:
+                case CoreTypeID::Vector:
+                case CoreTypeID::Quaternion:
+                case CoreTypeID::Matrix:
+                case CoreTypeID::Transform:
+                case CoreTypeID::Microseconds:
+                case CoreTypeID::Milliseconds:
+                case CoreTypeID::Seconds:
+                case CoreTypeID::Percentage:
+                case CoreTypeID::Degrees:
+                case CoreTypeID::Radians:
+                case CoreTypeID::EulerAngles:
+                case CoreTypeID::IntRange:
+                case CoreTypeID::FloatRange:
+                case CoreTypeID::BitFlags:
+                case CoreTypeID::TBitFlags:
+                case CoreTypeID::ResourceTypeID:
+                {
+                    return true;
+                }
+                break;
+
+                default:
+                {
+                    return false;
+                }
+                break;
+            }
+        }
+
+        // Does a property (or any of its nested properties) hold a resource pointer
+        static bool DoesPropertyReferenceResources( TypeRegistry const& typeRegistry, PropertyInfo const& propertyInfo )
+        {
+            CoreTypeID const coreType = GetCoreType( propertyInfo.m_typeID );
+            if ( coreType == CoreTypeID::ResourcePtr || coreType == CoreTypeID::TResourcePtr )
+            {
+                return true;
+            }
+
+            if ( propertyInfo.IsStructureProperty() )
+            {
+                TypeInfo const* pStructureTypeInfo = typeRegistry.GetTypeInfo( propertyInfo.m_typeID );
+                EE_ASSERT( pStructureTypeInfo != nullptr );
+
+                for ( auto const& childPropertyInfo : pStructureTypeInfo->m_properties )
+                {
+                    if ( DoesPropertyReferenceResources( typeRegistry, childPropertyInfo ) )
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -163,6 +247,9 @@ namespace EE::TypeSystem
         // Reset descriptor
         m_typeID = pTypeInstance->GetTypeID();
         m_properties.clear();
+        m_pPrototypeTypeInfo = nullptr;
+        m_prototypePatches.clear();
+        m_prototypeValues.clear();
 
         // Fill property values
         PropertyPath path;
@@ -191,33 +278,187 @@ namespace EE::TypeSystem
                 m_properties.erase_unsorted( m_properties.begin() + i );
             }
         }
+
+        // The patches refer to the property list so the prototype is no longer valid
+        m_pPrototypeTypeInfo = nullptr;
+        m_prototypePatches.clear();
+        m_prototypeValues.clear();
     }
 
-    void* TypeDescriptor::SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const
+    void TypeDescriptor::CompilePrototype( TypeRegistry const& typeRegistry )
     {
-        EE_ASSERT( pTypeInfo != nullptr );
-        EE_ASSERT( IsValid() && pTypeInfo->m_ID == m_typeID );
+        EE_ASSERT( IsValid() );
+
+        m_pPrototypeTypeInfo = typeRegistry.GetTypeInfo( m_typeID );
+        EE_ASSERT( m_pPrototypeTypeInfo != nullptr );
+
+        m_prototypePatches.clear();
+        m_prototypeValues.clear();
+
+        //-------------------------------------------------------------------------
 
         for ( auto const& propertyValue : m_properties )
         {
             EE_ASSERT( propertyValue.IsValid() );
+            PrototypePatch& patch = m_prototypePatches.emplace_back();
+
+            // Resolve the path to a fixed offset, this is only possible if the path doesnt go through a dynamic array
+            TypeInfo const* pResolvedTypeInfo = m_pPrototypeTypeInfo;
+            PropertyInfo const* pResolvedPropertyInfo = nullptr;
+            uint32_t offset = 0;
+            bool isArrayElement = false;
+
+            size_t const numPathElements = propertyValue.m_path.GetNumElements();
+            for ( size_t i = 0; i < numPathElements; i++ )
+            {
+                PropertyPath::PathElement const& pathElement = propertyValue.m_path[i];
+
+                pResolvedPropertyInfo = ( pResolvedTypeInfo != nullptr ) ? pResolvedTypeInfo->GetPropertyInfo( pathElement.m_propertyID ) : nullptr;
+                if ( pResolvedPropertyInfo == nullptr || pResolvedPropertyInfo->IsDynamicArrayProperty() )
+                {
+                    pResolvedPropertyInfo = nullptr;
+                    break;
+                }
+
+                offset += pResolvedPropertyInfo->m_offset;
+
+                isArrayElement = pResolvedPropertyInfo->IsStaticArrayProperty();
+                if ( isArrayElement )
+                {
+                    EE_ASSERT( pathElement.m_arrayElementIdx >= 0 && pathElement.m_arrayElementIdx < pResolvedPropertyInfo->m_arraySize );
+                    offset += pathElement.m_arrayElementIdx * pResolvedPropertyInfo->m_arrayElementSize;
+                }
+
+                pResolvedTypeInfo = IsCoreType( pResolvedPropertyInfo->m_typeID ) ? nullptr : typeRegistry.GetTypeInfo( pResolvedPropertyInfo->m_typeID );
+            }
 
-            // Resolve a property path for a given instance
-            auto resolvedPath = ResolvePropertyPath( typeRegistry, pTypeInfo, (uint8_t*) pTypeInstance, propertyValue.m_path );
-            if ( !resolvedPath.IsValid() )
+            // Unresolvable paths fall back to the per-instance path resolution
+            if ( pResolvedPropertyInfo == nullptr )
             {
-                EE_LOG_ERROR( "TypeSystem", "Type Descriptor", "Tried to set the value for an invalid property (%s) for type (%s)", propertyValue.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
                 continue;
             }
 
-            // Set actual property value
-            auto const& resolvedProperty = resolvedPath.m_pathElements.back();
-            Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyValue.m_byteValue, resolvedProperty.m_pAddress );
+            patch.m_pPropertyInfo = pResolvedPropertyInfo;
+            patch.m_offset = offset;
+
+            // Pre-convert trivially copyable values
+            if ( IsTriviallyCopyableProperty( *pResolvedPropertyInfo ) )
+            {
+                uint32_t const valueSize = isArrayElement ? pResolvedPropertyInfo->m_arrayElementSize : pResolvedPropertyInfo->m_size;
+
+                alignas( 16 ) uint8_t nativeValue[sizeof( Matrix )];
+                EE_ASSERT( valueSize > 0 && valueSize <= sizeof( nativeValue ) );
+                Conversion::ConvertBinaryToNativeType( typeRegistry, *pResolvedPropertyInfo, propertyValue.m_byteValue, nativeValue );
+
+                patch.m_valueOffset = (uint32_t) m_prototypeValues.size();
+                patch.m_valueSize = valueSize;
+                m_prototypeValues.insert( m_prototypeValues.end(), nativeValue, nativeValue + valueSize );
+            }
+        }
+    }
+
+    void* TypeDescriptor::SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const
+    {
+        EE_ASSERT( pTypeInfo != nullptr );
+        EE_ASSERT( IsValid() && pTypeInfo->m_ID == m_typeID );
+
+        // Apply the precompiled patches
+        if ( HasCompiledPrototype() )
+        {
+            EE_ASSERT( pTypeInfo == m_pPrototypeTypeInfo );
+            EE_ASSERT( m_prototypePatches.size() == m_properties.size() );
+
+            int32_t const numPatches = (int32_t) m_prototypePatches.size();
+            for ( int32_t i = 0; i < numPatches; i++ )
+            {
+                ApplyPrototypePatch( typeRegistry, pTypeInfo, pTypeInstance, i );
+            }
+
+            return pTypeInstance;
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( auto const& propertyValue : m_properties )
+        {
+            SetPropertyValue( typeRegistry, pTypeInfo, pTypeInstance, propertyValue );
         }
 
         return pTypeInstance;
     }
 
+    void TypeDescriptor::ApplyPrototypePatch( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, int32_t propertyIdx ) const
+    {
+        uint8_t* const pTypeInstanceAddress = reinterpret_cast<uint8_t*>( pTypeInstance );
+        PrototypePatch const& patch = m_prototypePatches[propertyIdx];
+        if ( patch.m_valueSize > 0 )
+        {
+            memcpy( pTypeInstanceAddress + patch.m_offset, m_prototypeValues.data() + patch.m_valueOffset, patch.m_valueSize );
+        }
+        else if ( patch.m_pPropertyInfo != nullptr )
+        {
+            Conversion::ConvertBinaryToNativeType( typeRegistry, *patch.m_pPropertyInfo, m_properties[propertyIdx].m_byteValue, pTypeInstanceAddress + patch.m_offset );
+        }
+        else
+        {
+            SetPropertyValue( typeRegistry, pTypeInfo, pTypeInstance, m_properties[propertyIdx] );
+        }
+    }
+
+    void TypeDescriptor::SetPropertyValue( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, PropertyDescriptor const& propertyValue ) const
+    {
+        EE_ASSERT( propertyValue.IsValid() );
+
+        // Resolve a property path for a given instance
+        auto resolvedPath = ResolvePropertyPath( typeRegistry, pTypeInfo, (uint8_t*) pTypeInstance, propertyValue.m_path );
+        if ( !resolvedPath.IsValid() )
+        {
+            EE_LOG_ERROR( "TypeSystem", "Type Descriptor", "Tried to set the value for an invalid property (%s) for type (%s)", propertyValue.m_path.ToString().c_str(), pTypeInfo->m_ID.ToStringID().c_str() );
+            return;
+        }
+
+        // Set actual property value
+        auto const& resolvedProperty = resolvedPath.m_pathElements.back();
+        Conversion::ConvertBinaryToNativeType( typeRegistry, *resolvedProperty.m_pPropertyInfo, propertyValue.m_byteValue, resolvedProperty.m_pAddress );
+    }
+
+    void TypeDescriptor::ResetTypeInstance( TypeRegistry const& typeRegistry, IReflectedType* pTypeInstance ) const
+    {
+        EE_ASSERT( IsValid() && pTypeInstance != nullptr && pTypeInstance->GetTypeID() == m_typeID );
+
+        TypeInfo const* pTypeInfo = HasCompiledPrototype() ? m_pPrototypeTypeInfo : typeRegistry.GetTypeInfo( m_typeID );
+        EE_ASSERT( pTypeInfo != nullptr );
+
+        // Reset all properties that dont reference resources back to the type defaults
+        for ( auto const& propertyInfo : pTypeInfo->m_properties )
+        {
+            if ( !DoesPropertyReferenceResources( typeRegistry, propertyInfo ) )
+            {
+                pTypeInfo->ResetToDefault( pTypeInstance, propertyInfo.m_ID );
+            }
+        }
+
+        // Re-apply the described values for those properties
+        int32_t const numProperties = (int32_t) m_properties.size();
+        for ( int32_t i = 0; i < numProperties; i++ )
+        {
+            PropertyInfo const* pRootPropertyInfo = pTypeInfo->GetPropertyInfo( m_properties[i].m_path.FirstElement().m_propertyID );
+            if ( pRootPropertyInfo == nullptr || DoesPropertyReferenceResources( typeRegistry, *pRootPropertyInfo ) )
+            {
+                continue;
+            }
+
+            if ( HasCompiledPrototype() )
+            {
+                ApplyPrototypePatch( typeRegistry, pTypeInfo, pTypeInstance, i );
+            }
+            else
+            {
+                SetPropertyValue( typeRegistry, pTypeInfo, pTypeInstance, m_properties[i] );
+            }
+        }
+    }
+
     //-------------------------------------------------------------------------
 
     void TypeDescriptorCollection::Reset()
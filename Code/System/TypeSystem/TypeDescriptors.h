@@ -100,6 +100,15 @@ namespace EE::TypeSystem
     {
         EE_SERIALIZE( m_typeID, m_properties );
 
+        // A precompiled property value write, there is one patch per property in the same order as the property list
+        struct PrototypePatch
+        {
+            PropertyInfo const*                                     m_pPropertyInfo = nullptr;  // Null if the property path cannot be resolved statically
+            uint32_t                                                m_offset = 0;               // Offset of the property from the start of the type instance
+            uint32_t                                                m_valueOffset = 0;          // Offset of the pre-converted native value in the value buffer
+            uint32_t                                                m_valueSize = 0;            // Size of the pre-converted native value, 0 if the value needs to be converted on each instantiation
+        };
+
     public:
 
         TypeDescriptor() = default;
@@ -136,7 +145,7 @@ namespace EE::TypeSystem
         template<typename T>
         [[nodiscard]] inline T* CreateTypeInstance( TypeRegistry const& typeRegistry ) const
         {
-            TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( m_typeID );
+            TypeInfo const* pTypeInfo = HasCompiledPrototype() ? m_pPrototypeTypeInfo : typeRegistry.GetTypeInfo( m_typeID );
             return CreateTypeInstance<T>( typeRegistry, pTypeInfo );
         }
 
@@ -162,7 +171,7 @@ namespace EE::TypeSystem
         template<typename T>
         [[nodiscard]] inline T* CreateTypeInstanceInPlace( TypeRegistry const& typeRegistry, void* pAllocatedMemoryForInstance ) const
         {
-            TypeInfo const* pTypeInfo = typeRegistry.GetTypeInfo( m_typeID );
+            TypeInfo const* pTypeInfo = HasCompiledPrototype() ? m_pPrototypeTypeInfo : typeRegistry.GetTypeInfo( m_typeID );
             return CreateTypeInstanceInPlace<T>( typeRegistry, pTypeInfo, pAllocatedMemoryForInstance );
         }
 
@@ -176,6 +185,19 @@ namespace EE::TypeSystem
             T* pCreatedType = CreateTypeInstanceInPlace<T>( typeRegistry, pTypeInfo, pTypeInstance );
         }
 
+        // Prototype
+        //-------------------------------------------------------------------------
+        // Compiling the prototype resolves all property paths once, so that instantiating the type becomes a default construction followed by a list of fixed offset writes
+        // Trivially copyable values are also pre-converted to their native representation, so they are written with a single copy
+        // Only compile the prototype for descriptors that will no longer be modified (i.e. loaded resources), since the patches refer to the property list
+
+        void CompilePrototype( TypeRegistry const& typeRegistry );
+        inline bool HasCompiledPrototype() const { return m_pPrototypeTypeInfo != nullptr; }
+
+        // Reset an existing instance of the described type back to the described values, this is used to recycle instances instead of recreating them
+        // Properties that reference resources are left untouched since changing them would require the instance to be reloaded
+        void ResetTypeInstance( TypeRegistry const& typeRegistry, IReflectedType* pTypeInstance ) const;
+
         // Properties
         //-------------------------------------------------------------------------
 
@@ -186,11 +208,20 @@ namespace EE::TypeSystem
     private:
 
         void* SetPropertyValues( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance ) const;
+        void SetPropertyValue( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, PropertyDescriptor const& propertyValue ) const;
+        void ApplyPrototypePatch( TypeRegistry const& typeRegistry, TypeInfo const* pTypeInfo, void* pTypeInstance, int32_t propertyIdx ) const;
 
     public:
 
         TypeID                                                      m_typeID;
         TInlineVector<PropertyDescriptor, 6>                        m_properties;
+
+    private:
+
+        // Not-serialized - compiled at runtime
+        TypeInfo const*                                             m_pPrototypeTypeInfo = nullptr;
+        TInlineVector<PrototypePatch, 6>                            m_prototypePatches;
+        Blob                                                        m_prototypeValues;
     };
 
     //-------------------------------------------------------------------------
@@ -1,96 +1,251 @@
 #include "StringID.h"
-#include "System/Memory/Memory.h"
 #include "System/Encoding/Hash.h"
 #include "System/Threading/Threading.h"
 #include "String.h"
-#include "EASTL/hash_map.h"
+#include <atomic>
 
 //-------------------------------------------------------------------------
+// String ID Table
+//-------------------------------------------------------------------------
+// StringIDs are created during static initialization, so the table is constant initialized and all its memory
+// comes directly from the system heap rather than the engine allocator.
+//
+// Each shard owns an open addressed slot array that is only ever modified under the shard lock. Entries are
+// published with a release store and never move or get removed, so readers can probe the slots without locking.
+// When a shard grows, the old slot array is retired (not freed) since readers might still be probing it.
 
 namespace EE
 {
-    class StringID_CustomAllocator
+    namespace
     {
-    public:
+        using CachedString = StringID::CachedString;
+        using Slot = std::atomic<CachedString const*>;
 
-        EASTL_ALLOCATOR_EXPLICIT StringID_CustomAllocator( const char* pName = EASTL_NAME_VAL( EASTL_ALLOCATOR_DEFAULT_NAME ) ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x ) {}
-        StringID_CustomAllocator( const StringID_CustomAllocator& x, const char* pName ) {}
-        StringID_CustomAllocator& operator=( const StringID_CustomAllocator& x ) { return *this; }
-        const char* get_name() const { return "StringID"; }
-        void set_name( const char* pName ) {}
+        static_assert( sizeof( Slot ) == sizeof( CachedString const* ), "The debugger reads the slots as raw pointers" );
 
-        void* allocate( size_t n, int flags = 0 )
-        {
-            return allocate( n, EASTL_SYSTEM_ALLOCATOR_MIN_ALIGNMENT, 0, flags );
-        }
+        //-------------------------------------------------------------------------
 
-        void* allocate( size_t n, size_t alignment, size_t offset, int flags = 0 )
+        struct SlotArray
         {
-            size_t adjustedAlignment = ( alignment > EA_PLATFORM_PTR_SIZE ) ? alignment : EA_PLATFORM_PTR_SIZE;
+            inline Slot* GetSlots() { return reinterpret_cast<Slot*>( this + 1 ); }
+            inline Slot const* GetSlots() const { return reinterpret_cast<Slot const*>( this + 1 ); }
 
-            void* p = new char[n + adjustedAlignment + EA_PLATFORM_PTR_SIZE];
-            void* pPlusPointerSize = (void*) ( (uintptr_t) p + EA_PLATFORM_PTR_SIZE );
-            void* pAligned = (void*) ( ( (uintptr_t) pPlusPointerSize + adjustedAlignment - 1 ) & ~( adjustedAlignment - 1 ) );
+        public:
 
-            void** pStoredPtr = (void**) pAligned - 1;
-            EASTL_ASSERT( pStoredPtr >= p );
-            *( pStoredPtr ) = p;
+            uint32_t                        m_mask = 0;
+            SlotArray*                      m_pRetired = nullptr;
+        };
 
-            EASTL_ASSERT( ( (size_t) pAligned & ~( alignment - 1 ) ) == (size_t) pAligned );
-            return pAligned;
-        }
+        // A block of string storage, the memory immediately follows the header
+        struct ArenaBlock
+        {
+            ArenaBlock*                     m_pPrevious = nullptr;
+            uint32_t                        m_size = 0;
+            uint32_t                        m_used = 0;
+        };
+
+        //-------------------------------------------------------------------------
 
-        void deallocate( void* p, size_t n )
+        class StringTableShard
         {
-            if ( p != nullptr )
+            constexpr static uint32_t const s_initialNumSlots = 256;
+            constexpr static uint32_t const s_arenaBlockSize = 16 * 1024;
+
+        public:
+
+            ~StringTableShard()
             {
-                void* pOriginalAllocation = *( (void**) p - 1 );
-                delete[]( char* )pOriginalAllocation;
+                SlotArray* pSlotArray = m_pSlotArray.load( std::memory_order_relaxed );
+                while ( pSlotArray != nullptr )
+                {
+                    SlotArray* pRetired = pSlotArray->m_pRetired;
+                    delete[] reinterpret_cast<char*>( pSlotArray );
+                    pSlotArray = pRetired;
+                }
+
+                while ( m_pArena != nullptr )
+                {
+                    ArenaBlock* pPrevious = m_pArena->m_pPrevious;
+                    delete[] reinterpret_cast<char*>( m_pArena );
+                    m_pArena = pPrevious;
+                }
             }
-        }
-    };
 
-    inline bool operator==( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return true; }
-    inline bool operator!=( const StringID_CustomAllocator&, const StringID_CustomAllocator& ) { return false; }
+            // Lock-free
+            CachedString const* Find( uint32_t ID ) const
+            {
+                SlotArray const* pSlotArray = m_pSlotArray.load( std::memory_order_acquire );
+                return ( pSlotArray != nullptr ) ? FindInSlots( pSlotArray, ID ) : nullptr;
+            }
 
-    //-------------------------------------------------------------------------
+            CachedString const* FindOrAdd( uint32_t ID, char const* pStr, size_t length, StringID::DebuggerInfo& debuggerInfo, uint32_t shardIdx )
+            {
+                CachedString const* pEntry = Find( ID );
+                if ( pEntry != nullptr )
+                {
+                    return pEntry;
+                }
 
-    using CachedString = eastl::basic_string<char, StringID_CustomAllocator>;
+                //-------------------------------------------------------------------------
 
-    class StringIDHashMap : public eastl::hash_map<uint32_t, CachedString, eastl::hash<uint32_t>, eastl::equal_to<uint32_t>, StringID_CustomAllocator>
-    {
-    public:
-      
-        eastl::hash_node<value_type, false> const* const* GetBuckets() const { return mpBucketArray; }
-    };
+                Threading::ScopeLock lock( m_mutex );
 
-    //-------------------------------------------------------------------------
+                // Another thread could have added it while we were waiting on the lock
+                SlotArray* pSlotArray = m_pSlotArray.load( std::memory_order_relaxed );
+                if ( pSlotArray != nullptr )
+                {
+                    pEntry = FindInSlots( pSlotArray, ID );
+                    if ( pEntry != nullptr )
+                    {
+                        return pEntry;
+                    }
+                }
+
+                // Keep the load factor under 50% so that probe sequences stay short
+                if ( pSlotArray == nullptr || ( m_numEntries + 1 ) * 2 > ( pSlotArray->m_mask + 1 ) )
+                {
+                    pSlotArray = Grow( pSlotArray );
+                    debuggerInfo.m_pShardSlots[shardIdx] = reinterpret_cast<CachedString const* const*>( pSlotArray->GetSlots() );
+                    debuggerInfo.m_shardSlotMasks[shardIdx] = pSlotArray->m_mask;
+                }
+
+                pEntry = CreateEntry( ID, pStr, length );
+                InsertIntoSlots( pSlotArray, pEntry, std::memory_order_release );
+                m_numEntries++;
+                return pEntry;
+            }
+
+        private:
+
+            static CachedString const* FindInSlots( SlotArray const* pSlotArray, uint32_t ID )
+            {
+                Slot const* pSlots = pSlotArray->GetSlots();
+                uint32_t slotIdx = ( ID >> StringID::s_numShardBits ) & pSlotArray->m_mask;
+                while ( true )
+                {
+                    CachedString const* pEntry = pSlots[slotIdx].load( std::memory_order_acquire );
+                    if ( pEntry == nullptr || pEntry->m_ID == ID )
+                    {
+                        return pEntry;
+                    }
+
+                    slotIdx = ( slotIdx + 1 ) & pSlotArray->m_mask;
+                }
+            }
+
+            static void InsertIntoSlots( SlotArray* pSlotArray, CachedString const* pEntry, std::memory_order order )
+            {
+                Slot* pSlots = pSlotArray->GetSlots();
+                uint32_t slotIdx = ( pEntry->m_ID >> StringID::s_numShardBits ) & pSlotArray->m_mask;
+                while ( pSlots[slotIdx].load( std::memory_order_relaxed ) != nullptr )
+                {
+                    slotIdx = ( slotIdx + 1 ) & pSlotArray->m_mask;
+                }
 
-    StringIDHashMap g_stringCache;
-    Threading::Mutex g_stringCacheMutex;
+                pSlots[slotIdx].store( pEntry, order );
+            }
+
+            // Rehash into a new slot array and publish it, the previous array is retired since readers might still be using it
+            SlotArray* Grow( SlotArray* pSlotArray )
+            {
+                uint32_t const numSlots = ( pSlotArray == nullptr ) ? s_initialNumSlots : ( pSlotArray->m_mask + 1 ) * 2;
+
+                char* pMemory = new char[sizeof( SlotArray ) + sizeof( Slot ) * numSlots];
+                SlotArray* pNewSlotArray = new ( pMemory ) SlotArray();
+                pNewSlotArray->m_mask = numSlots - 1;
+                pNewSlotArray->m_pRetired = pSlotArray;
+
+                Slot* pNewSlots = pNewSlotArray->GetSlots();
+                for ( uint32_t i = 0; i < numSlots; i++ )
+                {
+                    new ( &pNewSlots[i] ) Slot( nullptr );
+                }
+
+                if ( pSlotArray != nullptr )
+                {
+                    Slot const* pSlots = pSlotArray->GetSlots();
+                    for ( uint32_t i = 0; i <= pSlotArray->m_mask; i++ )
+                    {
+                        CachedString const* pEntry = pSlots[i].load( std::memory_order_relaxed );
+                        if ( pEntry != nullptr )
+                        {
+                            InsertIntoSlots( pNewSlotArray, pEntry, std::memory_order_relaxed );
+                        }
+                    }
+                }
+
+                m_pSlotArray.store( pNewSlotArray, std::memory_order_release );
+                return pNewSlotArray;
+            }
+
+            CachedString const* CreateEntry( uint32_t ID, char const* pStr, size_t length )
+            {
+                uint32_t const requiredSize = (uint32_t) ( ( sizeof( CachedString ) + length + 1 + alignof( CachedString ) - 1 ) & ~( alignof( CachedString ) - 1 ) );
+
+                // Allocate a new block if needed, strings larger than a block get a dedicated one
+                if ( m_pArena == nullptr || ( m_pArena->m_size - m_pArena->m_used ) < requiredSize )
+                {
+                    uint32_t const blockSize = ( requiredSize > s_arenaBlockSize ) ? requiredSize : s_arenaBlockSize;
+                    char* pMemory = new char[sizeof( ArenaBlock ) + blockSize];
+                    ArenaBlock* pBlock = new ( pMemory ) ArenaBlock();
+                    pBlock->m_pPrevious = m_pArena;
+                    pBlock->m_size = blockSize;
+                    m_pArena = pBlock;
+                }
+
+                char* pEntryMemory = reinterpret_cast<char*>( m_pArena + 1 ) + m_pArena->m_used;
+                m_pArena->m_used += requiredSize;
+
+                CachedString* pEntry = new ( pEntryMemory ) CachedString();
+                pEntry->m_ID = ID;
+                pEntry->m_length = (uint32_t) length;
+                memcpy( pEntryMemory + sizeof( CachedString ), pStr, length + 1 );
+                return pEntry;
+            }
+
+        private:
+
+            std::atomic<SlotArray*>         m_pSlotArray = nullptr;
+            ArenaBlock*                     m_pArena = nullptr;
+            uint32_t                        m_numEntries = 0;
+            Threading::Mutex                m_mutex;
+        };
+
+        //-------------------------------------------------------------------------
+
+        StringTableShard g_stringTableShards[StringID::s_numShards];
+        StringID::DebuggerInfo g_debuggerInfo;
+
+        EE_FORCE_INLINE StringTableShard& GetShard( uint32_t ID ) { return g_stringTableShards[ID & ( StringID::s_numShards - 1 )]; }
+    }
 
     // Natvis/Debugger info to print out human-readable strings
-    StringID::DebuggerInfo g_debuggerInfo;
     EE::StringID::DebuggerInfo const* StringID::s_pDebuggerInfo = &g_debuggerInfo;
 
     //-------------------------------------------------------------------------
 
     StringID::StringID( char const* pStr )
     {
-        if ( pStr != nullptr && strlen( pStr ) > 0 )
+        if ( pStr == nullptr )
         {
-            m_ID = Hash::GetHash32( pStr );
+            return;
+        }
+
+        size_t const length = strlen( pStr );
+        if ( length > 0 )
+        {
+            m_ID = Hash::XXHash::GetHash32( pStr, length );
 
             // Cache the string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter == g_stringCache.end() )
+            uint32_t const shardIdx = m_ID & ( s_numShards - 1 );
+            CachedString const* pEntry = g_stringTableShards[shardIdx].FindOrAdd( m_ID, pStr, length, g_debuggerInfo, shardIdx );
+
+            #if EE_DEVELOPMENT_TOOLS
+            if ( pEntry->m_length != length || memcmp( pEntry->GetString(), pStr, length ) != 0 )
             {
-                g_stringCache[m_ID] = CachedString( pStr );
-                g_debuggerInfo.m_pBuckets = g_stringCache.GetBuckets();
-                g_debuggerInfo.m_numBuckets = g_stringCache.bucket_count();
+                EE_TRACE_ASSERT( "StringID hash collision: '%s' and '%s' both hash to %u", pStr, pEntry->GetString(), m_ID );
             }
+            #endif
         }
     }
 
@@ -105,17 +260,14 @@ namespace EE
             return nullptr;
         }
 
+        // Get cached string
+        CachedString const* pEntry = GetShard( m_ID ).Find( m_ID );
+        if ( pEntry != nullptr )
         {
-            // Get cached string
-            Threading::ScopeLock lock( g_stringCacheMutex );
-            auto iter = g_stringCache.find( m_ID );
-            if ( iter != g_stringCache.end() )
-            {
-                return iter->second.c_str();
-            }
+            return pEntry->GetString();
         }
 
         // ID likely directly created via uint32_t
         return nullptr;
     }
-}
\ No newline at end of file
+}
@@ -10,34 +10,36 @@
 // Deterministic numeric ID generated from a string
 // StringIDs are CASE-SENSITIVE!
 // Uses the 32bit default hash
-
-namespace eastl
-{
-    template <typename Value, bool bCacheHashCode>
-    struct hash_node;
-
-    template <typename T1, typename T2>
-    struct pair;
-}
-
-//-------------------------------------------------------------------------
+//
+// The strings are interned in a sharded table: lookups are lock-free, inserts only lock the shard they hash to
+// and the strings themselves are stored in per-shard arenas that live for the lifetime of the application
 
 namespace EE
 {
-    class StringID_CustomAllocator;
-
-    //-------------------------------------------------------------------------
-
     class EE_SYSTEM_API StringID
     {
     public:
 
-        using StringIDHashNode = eastl::hash_node<eastl::pair<const uint32_t, eastl::basic_string<char, EE::StringID_CustomAllocator>>, false>;
+        constexpr static uint32_t const s_numShardBits = 6;
+        constexpr static uint32_t const s_numShards = 1 << s_numShardBits;
+        static_assert( s_numShardBits == 6, "Esoterica.natvis hardcodes the shard mask (63) and shift (6), update the natvis when changing this" );
+
+        // An interned string, the null-terminated string data immediately follows the entry
+        struct CachedString
+        {
+            inline char const* GetString() const { return reinterpret_cast<char const*>( this + 1 ); }
+
+        public:
+
+            uint32_t                        m_ID;
+            uint32_t                        m_length;
+        };
 
+        // Open addressed slot arrays per shard, indexed by ( ID >> s_numShardBits ) & mask with linear probing
         struct DebuggerInfo
         {
-            StringIDHashNode const* const*  m_pBuckets = nullptr;
-            size_t                          m_numBuckets = 0;
+            CachedString const* const*      m_pShardSlots[s_numShards] = {};
+            uint32_t                        m_shardSlotMasks[s_numShards] = {};
         };
 
         static DebuggerInfo const*          s_pDebuggerInfo;